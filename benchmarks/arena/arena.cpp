@@ -0,0 +1,305 @@
+///
+/// @file:   arena.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares materializing DIE trees and names with one heap allocation per object
+///          against materializing them in an image arena
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_sections.hpp"
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/die_cursor.hpp"
+#include "dwarf/image_arena.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+    // counts all allocations of the process
+    size_t allocation_count = 0;
+}
+
+auto
+operator new(size_t const size) -> void *
+{
+    ++allocation_count;
+    if(void * const p = std::malloc(size > 0 ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+auto
+operator delete(void * const p) noexcept -> void
+{
+    std::free(p);
+}
+
+auto
+operator delete(void * const p, size_t) noexcept -> void
+{
+    std::free(p);
+}
+
+namespace
+{
+    struct HeapNode final
+    {
+        dwarf::Tag tag = {};
+        std::string name = {};
+        HeapNode * parent = nullptr;
+        HeapNode * first_child = nullptr;
+        HeapNode * next_sibling = nullptr;
+    };
+
+    struct ArenaNode final
+    {
+        dwarf::Tag tag = {};
+        std::string_view name = {};
+        ArenaNode * parent = nullptr;
+        ArenaNode * first_child = nullptr;
+        ArenaNode * next_sibling = nullptr;
+    };
+
+    ///
+    /// @brief Builds a tree of all entries of all units, the roots are the unit entries
+    /// @param create creates a node with a tag and a name
+    ///
+    template<typename NODE_T, typename CREATE_T>
+    auto
+    build_tree(dwarf::DebugSections const & sections, std::vector<NODE_T *> & roots, CREATE_T && create) -> size_t
+    {
+        size_t count = 0;
+        std::vector<NODE_T *> parents;
+        std::vector<NODE_T *> last_children;
+
+        for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+            dwarf::Unit const unit(sections, unit_header);
+            dwarf::DieCursor cursor(unit);
+            parents.clear();
+            last_children.clear();
+
+            while(cursor.next()) {
+                std::string_view name;
+                cursor.read_attributes([&](dwarf::AttributeSpecification const & specification, dwarf::AttributeValue const & value)
+                {
+                    if(specification.attribute == dwarf::Attribute::dw_at_name) {
+                        name = value.as_string();
+                    }
+                });
+
+                parents.resize(cursor.depth());
+                last_children.resize(cursor.depth() + 1, nullptr);
+
+                NODE_T * const node = create(cursor.die().tag(), name);
+                ++count;
+
+                if(parents.empty()) {
+                    roots.push_back(node);
+                }
+                else {
+                    node->parent = parents.back();
+                    if(last_children.back() != nullptr) {
+                        last_children.back()->next_sibling = node;
+                    }
+                    else {
+                        parents.back()->first_child = node;
+                    }
+                }
+                last_children.back() = node;
+
+                if(cursor.die().has_children()) {
+                    parents.push_back(node);
+                    last_children.push_back(nullptr);
+                }
+            }
+        }
+
+        return count;
+    }
+
+    auto
+    delete_tree(HeapNode * node) -> void
+    {
+        while(node != nullptr) {
+            delete_tree(node->first_child);
+            HeapNode * const next = node->next_sibling;
+            delete node;
+            node = next;
+        }
+    }
+
+    struct Result final
+    {
+        size_t nodes = 0;
+        size_t allocations = 0;
+        size_t resident_bytes = 0;
+    };
+
+    ///
+    /// @brief Runs a function in a child process and measures the allocations and the growth of the
+    ///     resident set size while the function runs
+    /// @param func the function, returns the number of nodes built
+    ///
+    template<typename FUNC_T>
+    auto
+    measure_footprint(FUNC_T && func) -> Result
+    {
+        int fds[2] = {};
+        if(pipe(fds) != 0) {
+            return {};
+        }
+
+        std::cout.flush();
+        pid_t const pid = fork();
+        if(pid == 0) {
+            close(fds[0]);
+            size_t const rss = bench::resident_bytes();
+            size_t const allocations = allocation_count;
+
+            Result result;
+            result.nodes = func();
+            result.allocations = allocation_count - allocations;
+            result.resident_bytes = bench::resident_bytes() - rss;
+
+            auto const written = write(fds[1], &result, sizeof(result));
+            _exit(written == sizeof(result) ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+
+        close(fds[1]);
+        Result result;
+        if(pid < 0 || read(fds[0], &result, sizeof(result)) != sizeof(result)) {
+            result = {};
+        }
+        close(fds[0]);
+        if(pid > 0) {
+            waitpid(pid, nullptr, 0);
+        }
+
+        return result;
+    }
+
+    auto
+    print(std::string_view const name, Result const & result) -> void
+    {
+        std::cout << name << ": " << result.nodes << " nodes, "
+            << result.allocations << " allocations, "
+            << result.resident_bytes / 1024 << " KiB resident" << std::endl;
+    }
+}
+
+auto
+main() -> int
+{
+    std::span<char const> const data(tests_example_program_example_program_exe);
+    dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+
+    // the trees of several binary images are kept alive at the same time
+    size_t const images = 64;
+
+    // each footprint is measured in a fresh process, so freed memory of one is not reused by the other
+    Result const heap_result = measure_footprint([&]() {
+        std::vector<HeapNode *> roots;
+        size_t nodes = 0;
+        for(size_t i = 0; i < images; ++i) {
+            nodes += build_tree<HeapNode>(sections, roots, [](dwarf::Tag const tag, std::string_view const name) {
+                return new HeapNode{tag, std::string(name)};
+            });
+        }
+        return nodes;
+    });
+    print("heap ", heap_result);
+
+    Result const arena_result = measure_footprint([&]() {
+        std::vector<std::unique_ptr<dwarf::ImageArena>> arenas;
+        std::vector<ArenaNode *> roots;
+        size_t nodes = 0;
+        for(size_t i = 0; i < images; ++i) {
+            auto & arena = *arenas.emplace_back(std::make_unique<dwarf::ImageArena>());
+            nodes += build_tree<ArenaNode>(sections, roots, [&](dwarf::Tag const tag, std::string_view const name) {
+                return arena.create<ArenaNode>(tag, arena.intern(name));
+            });
+        }
+        return nodes;
+    });
+    print("arena", arena_result);
+
+    // the allocations of parsing the units, common to both
+    Result const parse_result = measure_footprint([&]() {
+        std::vector<ArenaNode *> roots;
+        ArenaNode node;
+        size_t nodes = 0;
+        for(size_t i = 0; i < images; ++i) {
+            nodes += build_tree<ArenaNode>(sections, roots, [&](dwarf::Tag, std::string_view) {
+                node = ArenaNode{};
+                return &node;
+            });
+        }
+        return nodes;
+    });
+    print("parse", parse_result);
+
+    bench::measure("build, heap", heap_result.nodes, [&]() {
+        std::vector<HeapNode *> roots;
+        for(size_t i = 0; i < images; ++i) {
+            build_tree<HeapNode>(sections, roots, [](dwarf::Tag const tag, std::string_view const name) {
+                return new HeapNode{tag, std::string(name)};
+            });
+        }
+        bench::do_not_optimize(roots.back());
+        for(auto * const root : roots) {
+            delete_tree(root);
+        }
+    });
+
+    bench::measure("build, arena", arena_result.nodes, [&]() {
+        std::vector<ArenaNode *> roots;
+        for(size_t i = 0; i < images; ++i) {
+            dwarf::ImageArena arena;
+            build_tree<ArenaNode>(sections, roots, [&](dwarf::Tag const tag, std::string_view const name) {
+                return arena.create<ArenaNode>(tag, arena.intern(name));
+            });
+            bench::do_not_optimize(roots.back());
+        }
+    });
+
+    {
+        std::vector<HeapNode *> roots;
+        for(size_t i = 0; i < images; ++i) {
+            build_tree<HeapNode>(sections, roots, [](dwarf::Tag const tag, std::string_view const name) {
+                return new HeapNode{tag, std::string(name)};
+            });
+        }
+        bench::measure("teardown, heap", heap_result.nodes, [&]() {
+            for(auto * const root : roots) {
+                delete_tree(root);
+            }
+        }, 1);
+    }
+
+    {
+        std::vector<std::unique_ptr<dwarf::ImageArena>> arenas;
+        std::vector<ArenaNode *> roots;
+        for(size_t i = 0; i < images; ++i) {
+            auto & arena = *arenas.emplace_back(std::make_unique<dwarf::ImageArena>());
+            build_tree<ArenaNode>(sections, roots, [&](dwarf::Tag const tag, std::string_view const name) {
+                return arena.create<ArenaNode>(tag, arena.intern(name));
+            });
+        }
+        bench::measure("teardown, arena", arena_result.nodes, [&]() {
+            arenas.clear();
+        }, 1);
+    }
+
+    return heap_result.nodes == arena_result.nodes ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,78 @@
+///
+/// @file:   attribute.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares fetching a single attribute by scanning all attributes with DIE::attribute()
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_info/die_tree.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+auto
+main() -> int
+{
+    std::span<char const> const data(tests_example_program_example_program_exe);
+    dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+    dwarf::DieTree const tree(sections);
+
+    std::vector<dwarf::DIE> dies;
+    for(dwarf::DieIndex i = 0; i < tree.size(); ++i) {
+        dies.push_back(tree.die(i));
+    }
+
+    size_t direct_offsets = 0;
+    size_t attributes = 0;
+    for(auto const & die : dies) {
+        for(auto const & specification : die.abbrev()->attributes()) {
+            direct_offsets += specification.offset != dwarf::unknown_attribute_offset ? 1 : 0;
+            ++attributes;
+        }
+    }
+    std::cout << "entries: " << dies.size() << ", attributes: " << attributes
+        << ", at a fixed offset: " << direct_offsets << std::endl;
+
+    size_t const repetitions = 1000;
+    bool is_equal = true;
+
+    for(auto const attribute : {dwarf::Attribute::dw_at_name, dwarf::Attribute::dw_at_type}) {
+        std::string const name(magic_enum::enum_name(attribute));
+        uint64_t expected = 0;
+        uint64_t actual = 0;
+
+        bench::measure(name + ", scan all attributes", dies.size() * repetitions, [&]() {
+            expected = 0;
+            for(size_t r = 0; r < repetitions; ++r) {
+                for(auto const & die : dies) {
+                    die.for_each_attribute([&](dwarf::AttributeSpecification const & specification, dwarf::AttributeValue const & value) {
+                        if(specification.attribute == attribute) {
+                            expected += value.as_unsigned() + value.as_block().size();
+                        }
+                    });
+                }
+            }
+            bench::do_not_optimize(expected);
+        });
+
+        bench::measure(name + ", DIE::attribute()", dies.size() * repetitions, [&]() {
+            actual = 0;
+            for(size_t r = 0; r < repetitions; ++r) {
+                for(auto const & die : dies) {
+                    auto const value = die.attribute(attribute);
+                    actual += value.as_unsigned() + value.as_block().size();
+                }
+            }
+            bench::do_not_optimize(actual);
+        });
+
+        is_equal = is_equal && expected == actual;
+    }
+
+    std::cout << "results equal: " << (is_equal ? "yes" : "no") << std::endl;
+
+    return is_equal ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,255 @@
+///
+/// @file:   benchmark.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Minimal helpers to time code in benchmarks
+/// @details On Linux the hardware counters of perf_event_open are read around each run. Without
+///          access to them, e.g. in containers or with perf_event_paranoid > 2, only the time is
+///          printed. BENCH_PERF=0 in the environment disables the counters.
+///
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+namespace bench
+{
+    ///
+    /// @brief Prevents the compiler from optimizing away the computation of a value
+    ///
+    template<typename T>
+    inline auto
+    do_not_optimize(T const & value) noexcept -> void
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /// @class bench::PerfCounters
+    ///
+    /// @brief The hardware counters of the calling thread, opened once for all benchmarks
+    /// @details The events are inherited by the threads the calling thread starts afterwards, so
+    ///     the counts of a multi-threaded benchmark include its workers. The events are opened
+    ///     one by one, not as a group, because inherited events cannot be read as a group.
+    ///
+    class PerfCounters final
+    {
+    public:
+        enum Event : size_t
+        {
+            cycles,
+            instructions,
+            branch_misses,
+            cache_misses,
+            count
+        };
+
+        /// @brief The names printed in front of the counts per item
+        static constexpr std::array<std::string_view, count> names = {"cyc", "ins", "brm", "llc"};
+
+        using Values = std::array<double, count>;
+
+        PerfCounters()
+        {
+#if defined(__linux__)
+            char const * const enabled = std::getenv("BENCH_PERF");
+            if(enabled != nullptr && std::string_view(enabled) == "0") {
+                std::printf("perf events disabled with BENCH_PERF=0, timing only\n");
+                return;
+            }
+
+            int error = 0;
+            constexpr std::array<uint64_t, count> configs = {
+                PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES
+            };
+
+            for(size_t i = 0; i < count; ++i) {
+                perf_event_attr attr = {};
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = configs[i];
+                attr.disabled = 1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.inherit = 1;
+                attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+                if(fds_[i] < 0 && !is_available_) {
+                    error = errno;
+                }
+                is_available_ |= fds_[i] >= 0;
+            }
+
+            if(!is_available_) {
+                std::printf("perf events unavailable (%s), timing only\n", std::strerror(error));
+            }
+#else
+            std::printf("perf events unavailable on this system, timing only\n");
+#endif
+        }
+
+        PerfCounters(PerfCounters const &) = delete;
+        auto operator=(PerfCounters const &) -> PerfCounters & = delete;
+
+        ~PerfCounters()
+        {
+#if defined(__linux__)
+            for(int const fd : fds_) {
+                if(fd >= 0) {
+                    close(fd);
+                }
+            }
+#endif
+        }
+
+        [[nodiscard]] auto
+        is_available() const noexcept -> bool
+        {
+            return is_available_;
+        }
+
+        ///
+        /// @brief Returns true if the event is counted, some processors lack e.g. the cache misses
+        ///
+        [[nodiscard]] auto
+        is_available(Event const event) const noexcept -> bool
+        {
+            return fds_[event] >= 0;
+        }
+
+        auto
+        start() noexcept -> void
+        {
+#if defined(__linux__)
+            for(int const fd : fds_) {
+                if(fd >= 0) {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        ///
+        /// @brief Stops counting and returns the counts since start(), scaled if the events were multiplexed
+        ///
+        [[nodiscard]] auto
+        stop() noexcept -> Values
+        {
+            Values res = {};
+#if defined(__linux__)
+            for(int const fd : fds_) {
+                if(fd >= 0) {
+                    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+                }
+            }
+
+            for(size_t i = 0; i < count; ++i) {
+                // value, time enabled, time running
+                std::array<uint64_t, 3> data = {};
+                if(fds_[i] < 0 || read(fds_[i], data.data(), sizeof(data)) != sizeof(data) || data[2] == 0) {
+                    continue;
+                }
+                res[i] = static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]);
+            }
+#endif
+            return res;
+        }
+
+    private:
+        std::array<int, count> fds_ = {-1, -1, -1, -1};
+        bool is_available_ = false;
+    };
+
+    inline auto
+    perf_counters() -> PerfCounters &
+    {
+        static PerfCounters counters;
+        return counters;
+    }
+
+    ///
+    /// @brief Runs a function several times and prints the fastest run
+    /// @details With hardware counters the cycles, instructions, branch misses and last level cache
+    ///          misses of the fastest run are printed per item as well
+    /// @param name the name printed in front of the result
+    /// @param items the number of items processed by one run, used to print the time per item
+    /// @param func the function to time
+    /// @return the fastest run in seconds
+    ///
+    template<typename FUNC_T>
+    inline auto
+    measure(std::string_view const name, size_t const items, FUNC_T && func, size_t const repetitions = 10) -> double
+    {
+        auto & counters = perf_counters();
+        double best = 0.0;
+        PerfCounters::Values best_counts = {};
+
+        for(size_t i = 0; i < repetitions; ++i) {
+            counters.start();
+            auto const start = std::chrono::steady_clock::now();
+            func();
+            auto const stop = std::chrono::steady_clock::now();
+            auto const counts = counters.stop();
+
+            double const seconds = std::chrono::duration<double>(stop - start).count();
+            if(i == 0 || seconds < best) {
+                best = seconds;
+                best_counts = counts;
+            }
+        }
+
+        double const per_item = 1.0 / static_cast<double>(std::max<size_t>(items, 1));
+        std::printf("%-40.*s %10.3f ms %8.2f ns/item", static_cast<int>(name.size()), name.data(),
+            best * 1e3, best * 1e9 * per_item);
+
+        if(counters.is_available()) {
+            for(size_t i = 0; i < PerfCounters::count; ++i) {
+                if(counters.is_available(static_cast<PerfCounters::Event>(i))) {
+                    std::printf(" %9.2f %.*s", best_counts[i] * per_item, static_cast<int>(PerfCounters::names[i].size()),
+                        PerfCounters::names[i].data());
+                }
+            }
+            if(best_counts[PerfCounters::cycles] > 0.0) {
+                std::printf(" %5.2f IPC", best_counts[PerfCounters::instructions] / best_counts[PerfCounters::cycles]);
+            }
+        }
+        std::printf("\n");
+
+        return best;
+    }
+
+    ///
+    /// @brief Returns the resident set size of the process in bytes
+    /// @return 0 if the size is not available, e.g. on systems without /proc
+    ///
+    inline auto
+    resident_bytes() -> size_t
+    {
+        size_t total_pages = 0;
+        size_t resident_pages = 0;
+
+        std::ifstream statm("/proc/self/statm");
+        if(!(statm >> total_pages >> resident_pages)) {
+            return 0;
+        }
+
+        return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+}
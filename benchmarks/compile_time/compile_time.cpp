@@ -0,0 +1,62 @@
+///
+/// @file:   compile_time.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Parses a large generated fixture at compile time, compiled by the benchmark_compile_time target
+///
+
+#include "dwarf/debug_abbrev/dubug_abbrev_parser.hpp"
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/unit_header/full_and_partial_compilation_unit_header.hpp"
+#include "dwarf/debug_sections.hpp"
+#include "large_fixture.h"
+
+namespace
+{
+    constexpr std::span<char const> data(large_fixture);
+
+    /// @brief The example program contains three units
+    constexpr size_t units_per_copy = 3;
+
+    [[nodiscard]] constexpr auto
+    count_units() -> size_t
+    {
+        dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+
+        size_t res = 0;
+        for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+            if(unit_header.version() >= 5) {
+                dwarf::FullAndPartialCompilationUnitHeader const header(unit_header);
+                res += header.address_size() == 8 ? 1 : 0;
+            }
+            else {
+                ++res;
+            }
+        }
+
+        return res;
+    }
+
+    [[nodiscard]] constexpr auto
+    count_abbreviations() -> size_t
+    {
+        dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+        dwarf::DebugAbbrevParser parser(sections.debug_abbrev);
+
+        size_t res = 0;
+        while(parser.next()) {
+            res += parser.is_tag() ? 1 : 0;
+        }
+
+        return res;
+    }
+}
+
+static_assert(count_units() == units_per_copy * large_fixture_copies);
+static_assert(count_abbreviations() % large_fixture_copies == 0);
+
+auto
+main() -> int
+{
+    return 0;
+}
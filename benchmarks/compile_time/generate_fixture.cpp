@@ -0,0 +1,129 @@
+///
+/// @file:   generate_fixture.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Generates a large fixture by repeating the debug sections of the example program
+///
+
+#include "pei/pei.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t file_alignment = 0x200;
+
+    // offsets of the fields in the headers
+    constexpr size_t virtual_size_offset = offsetof(pei::SectionHeader::DataStructure, virtual_size);
+    constexpr size_t size_of_raw_data_offset = offsetof(pei::SectionHeader::DataStructure, size_of_raw_data);
+    constexpr size_t pointer_to_raw_data_offset = offsetof(pei::SectionHeader::DataStructure, pointer_to_raw_data);
+    constexpr size_t pointer_to_symbol_table_offset = offsetof(pei::FileHeader::DataStructure, pointer_to_symbol_table);
+
+    auto
+    write_u32(std::vector<char> & data, size_t const index, uint32_t const value) -> void
+    {
+        for(size_t i = 0; i < sizeof(value); ++i) {
+            data[index + i] = static_cast<char>((value >> (i * 8)) & 0xff);
+        }
+    }
+
+    ///
+    /// @brief Repeats the content of a section, all following file offsets are moved
+    ///
+    auto
+    repeat_section(std::vector<char> & file, std::string_view const name, size_t const copies) -> bool
+    {
+        std::span<char const> const data(file);
+        pei::SectionTable const section_table(data);
+        pei::FileHeader const file_header(data);
+
+        size_t section_index = section_table.number_of_sections();
+        for(size_t i = 0; i < section_table.number_of_sections(); ++i) {
+            if(section_table.get_section(i).name() == name) {
+                section_index = i;
+            }
+        }
+        if(section_index == section_table.number_of_sections()) {
+            return false;
+        }
+
+        auto const section = section_table.get_section(section_index);
+        auto const content = section.data();
+        size_t const begin = section.pointer_to_raw_data();
+        size_t const old_size = section.size_of_raw_data();
+        size_t const new_content_size = content.size() * copies;
+        size_t const new_size = (new_content_size + file_alignment - 1) / file_alignment * file_alignment;
+        size_t const delta = new_size - old_size;
+
+        std::vector<char> res(file.begin(), file.begin() + begin);
+        for(size_t i = 0; i < copies; ++i) {
+            res.insert(res.end(), content.begin(), content.end());
+        }
+        res.resize(begin + new_size);
+        res.insert(res.end(), file.begin() + begin + old_size, file.end());
+
+        // move the sections and the symbol table behind the repeated section
+        for(size_t i = 0; i < section_table.number_of_sections(); ++i) {
+            auto const other = section_table.get_section(i);
+            if(i == section_index) {
+                write_u32(res, other.base_index() + virtual_size_offset, static_cast<uint32_t>(new_content_size));
+                write_u32(res, other.base_index() + size_of_raw_data_offset, static_cast<uint32_t>(new_size));
+            }
+            else if(other.pointer_to_raw_data() > begin) {
+                write_u32(res, other.base_index() + pointer_to_raw_data_offset, static_cast<uint32_t>(other.pointer_to_raw_data() + delta));
+            }
+        }
+
+        if(file_header.pointer_to_symbol_table() > begin) {
+            write_u32(res, file_header.base_index() + pointer_to_symbol_table_offset, 
+                static_cast<uint32_t>(file_header.pointer_to_symbol_table() + delta));
+        }
+
+        file = std::move(res);
+        return true;
+    }
+}
+
+///
+/// @brief Writes a header with a constexpr array in the format of FileToHeader
+/// @details usage: generate_fixture <output header> <copies>
+///
+auto
+main(int argc, char ** argv) -> int
+{
+    if(argc != 3) {
+        std::cerr << "usage: generate_fixture <output header> <copies>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string const output = argv[1];
+    size_t const copies = std::strtoul(argv[2], nullptr, 10);
+    if(copies == 0) {
+        std::cerr << "copies must be greater than 0" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<char> file(tests_example_program_example_program_exe.begin(), tests_example_program_example_program_exe.end());
+    if(!repeat_section(file, ".debug_info", copies) || !repeat_section(file, ".debug_abbrev", copies)) {
+        std::cerr << "the example program has no debug sections" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream ost(output);
+    ost << "///\n/// @brief: Generated by generate_fixture, the debug sections of the example program repeated "
+        << copies << " times\n///\n\n";
+    ost << "#pragma once\n\n#include <array>\n#include <cstddef>\n\n";
+    ost << "constexpr size_t large_fixture_copies = " << copies << ";\n\n";
+    ost << "constexpr std::array<char, " << file.size() << "> large_fixture = {\n";
+    for(size_t i = 0; i < file.size(); ++i) {
+        ost << static_cast<int>(file[i]) << (i + 1 < file.size() ? "," : "") << ((i + 1) % 32 == 0 ? "\n" : "");
+    }
+    ost << "\n};\n";
+
+    return ost ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,57 @@
+///
+/// @file:   measure_command.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Runs a command and prints its wall time and peak memory
+///
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+///
+/// @brief usage: measure_command <command> [arguments...]
+/// @return the exit code of the command
+///
+auto
+main(int argc, char ** argv) -> int
+{
+    if(argc < 2) {
+        std::fprintf(stderr, "usage: measure_command <command> [arguments...]\n");
+        return EXIT_FAILURE;
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+
+    pid_t const pid = fork();
+    if(pid < 0) {
+        std::perror("fork");
+        return EXIT_FAILURE;
+    }
+
+    if(pid == 0) {
+        execvp(argv[1], argv + 1);
+        std::perror("execvp");
+        _exit(127);
+    }
+
+    int status = 0;
+    rusage usage = {};
+    if(wait4(pid, &status, 0, &usage) < 0) {
+        std::perror("wait4");
+        return EXIT_FAILURE;
+    }
+
+    auto const stop = std::chrono::steady_clock::now();
+    double const seconds = std::chrono::duration<double>(stop - start).count();
+
+    // ru_maxrss is in kilobytes on Linux
+    std::printf("wall time:   %.3f s\n", seconds);
+    std::printf("user time:   %.3f s\n", static_cast<double>(usage.ru_utime.tv_sec) + static_cast<double>(usage.ru_utime.tv_usec) * 1e-6);
+    std::printf("peak memory: %.1f MB\n", static_cast<double>(usage.ru_maxrss) / 1024.0);
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : EXIT_FAILURE;
+}
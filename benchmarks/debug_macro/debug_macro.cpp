@@ -0,0 +1,92 @@
+///
+/// @file:   debug_macro.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares looking up a macro at a source location in the dwarf::MacroIndex against
+///          replaying the macro information of the unit up to the location for each lookup
+/// @details The units import a table of 4000 predefined macros, about the number of macros a
+///          C++ translation unit including the standard library defines.
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_macro/debug_macro.hpp"
+#include "dwarf_fixture.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+    ///
+    /// @brief Returns the definition of a macro at a line of the primary file by replaying the tables
+    ///
+    auto
+    replay(dwarf::Unit const & unit, uint64_t const offset, std::string_view const name, uint64_t const line,
+        size_t depth = 0) -> dwarf::MacroEntry
+    {
+        dwarf::MacroEntry res = {};
+        dwarf::MacroTable const table(unit, offset);
+        for(auto const & entry : table.entries()) {
+            if(depth == 1 && entry.line >= line && (entry.is_define() || entry.is_undef() || entry.opcode == dwarf::MacroInformation::dw_macro_start_file)) {
+                break;
+            }
+
+            if(entry.opcode == dwarf::MacroInformation::dw_macro_start_file) {
+                ++depth;
+            }
+            else if(entry.opcode == dwarf::MacroInformation::dw_macro_end_file) {
+                --depth;
+            }
+            else if(entry.opcode == dwarf::MacroInformation::dw_macro_import) {
+                auto const imported = replay(unit, entry.offset, name, line, depth);
+                res = imported.text.empty() ? res : imported;
+            }
+            else if(entry.name() == name) {
+                res = entry.is_define() ? entry : dwarf::MacroEntry{};
+            }
+        }
+        return res;
+    }
+}
+
+auto
+main() -> int
+{
+    auto const data = fixture::make_macro_units(4000);
+    auto const sections = data.sections();
+
+    std::vector<std::string> names;
+    for(size_t i = 0; i < 64; ++i) {
+        names.push_back(i % 2 == 0 ? "GENERATED_" + std::to_string(i * 61) : "LOCAL");
+    }
+
+    bench::measure("macro index, build", 1, [&]() {
+        dwarf::MacroIndex const index(sections);
+        bench::do_not_optimize(index);
+    });
+
+    dwarf::MacroIndex const index(sections);
+    auto const & unit_macros = index.units().front();
+    size_t found = 0;
+    bench::measure("macro index, find at file:line", names.size(), [&]() {
+        found = 0;
+        for(size_t i = 0; i < names.size(); ++i) {
+            found += unit_macros.find(names[i], 1, 2 + i % 5) != nullptr;
+        }
+        bench::do_not_optimize(found);
+    });
+
+    dwarf::Unit const unit(sections, *dwarf::DebugInfo(sections.debug_info).begin());
+    auto const offset = dwarf::DIE(unit, unit.first_die_offset()).attribute(dwarf::Attribute::dw_at_macros).as_unsigned();
+    size_t replayed = 0;
+    bench::measure("replay of the macro information", names.size(), [&]() {
+        replayed = 0;
+        for(size_t i = 0; i < names.size(); ++i) {
+            replayed += !replay(unit, offset, names[i], 2 + i % 5).text.empty();
+        }
+        bench::do_not_optimize(replayed);
+    });
+
+    return found == replayed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,83 @@
+///
+/// @file:   decode_column.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares decoding an array of structures element by element with decoding it column by column
+///
+
+#include "benchmark.hpp"
+#include "dwarf/types/column_decoder.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+auto
+main() -> int
+{
+    std::span<char const> const data(tests_example_program_example_program_exe);
+    dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+    dwarf::TypeGraph const type_graph(sections);
+    dwarf::TypeLayouts type_layouts(type_graph);
+
+    // struct tm, nine int members
+    dwarf::TypeId const id = type_graph.find("tm");
+    auto const layout = type_layouts.layout(id);
+    size_t const stride = type_graph.node(id).byte_size;
+    if(layout.empty() || stride == 0) {
+        std::cerr << "struct tm not found" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    size_t const count = size_t(1) << 20;
+    std::vector<char> elements(count * stride);
+    std::mt19937 random(42);
+    for(auto & c : elements) {
+        c = static_cast<char>(random());
+    }
+
+#if defined(__AVX2__)
+    std::cout << "AVX2: enabled" << std::endl;
+#else
+    std::cout << "AVX2: disabled" << std::endl;
+#endif
+    std::cout << "elements: " << count << ", fields: " << layout.size() << ", stride: " << stride << " bytes" << std::endl;
+
+    std::vector<std::vector<int32_t>> columns(layout.size(), std::vector<int32_t>(count));
+    std::vector<std::vector<int64_t>> wide_columns(layout.size(), std::vector<int64_t>(count));
+
+    bench::measure("per element, per field (int32)", count * layout.size(), [&]() {
+        for(size_t i = 0; i < count; ++i) {
+            std::span<char const> const element(elements.data() + i * stride, stride);
+            for(size_t f = 0; f < layout.size(); ++f) {
+                columns[f][i] = dwarf::details::convert_leaf_value<int32_t>(layout[f], layout[f].extract(element));
+            }
+        }
+        bench::do_not_optimize(columns.front().front());
+    });
+    auto const expected = columns;
+
+    bench::measure("decode_column (int32)", count * layout.size(), [&]() {
+        for(size_t f = 0; f < layout.size(); ++f) {
+            dwarf::decode_column<int32_t>(elements, stride, layout[f], columns[f]);
+        }
+        bench::do_not_optimize(columns.front().front());
+    });
+    bool is_equal = columns == expected;
+
+    bench::measure("decode_column (int64)", count * layout.size(), [&]() {
+        for(size_t f = 0; f < layout.size(); ++f) {
+            dwarf::decode_column<int64_t>(elements, stride, layout[f], wide_columns[f]);
+        }
+        bench::do_not_optimize(wide_columns.front().front());
+    });
+
+    for(size_t f = 0; f < layout.size(); ++f) {
+        is_equal = is_equal && std::equal(wide_columns[f].begin(), wide_columns[f].end(), expected[f].begin());
+    }
+    std::cout << "results equal: " << (is_equal ? "yes" : "no") << std::endl;
+
+    return is_equal ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,139 @@
+///
+/// @file:   die_tree.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares the size and the traversal speed of the structure of arrays DIE tree
+///          with a tree of heap allocated nodes
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_info/die_tree.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    struct Node final
+    {
+        dwarf::Tag tag = {};
+        uint32_t abbrev_code = 0;
+        uint64_t offset = 0;
+        Node * parent = nullptr;
+        Node * first_child = nullptr;
+        Node * next_sibling = nullptr;
+    };
+
+    ///
+    /// @brief Builds a pointer based copy of a tree, one allocation per node
+    ///
+    auto
+    build_nodes(dwarf::DieTree const & tree, std::vector<std::unique_ptr<Node>> & nodes) -> void
+    {
+        for(dwarf::DieIndex i = 0; i < tree.size(); ++i) {
+            nodes.push_back(std::make_unique<Node>(Node{tree.tag(i), tree.abbrev_code(i), tree.offset(i)}));
+        }
+        for(dwarf::DieIndex i = 0; i < tree.size(); ++i) {
+            auto const link = [&](dwarf::DieIndex const index) {
+                return index != dwarf::invalid_die_index ? nodes[index].get() : nullptr;
+            };
+            nodes[i]->parent = link(tree.parent(i));
+            nodes[i]->first_child = link(tree.first_child(i));
+            nodes[i]->next_sibling = link(tree.next_sibling(i));
+        }
+    }
+
+    auto
+    count_members(dwarf::DieTree const & tree, dwarf::DieIndex index) -> size_t
+    {
+        size_t count = 0;
+        for(; index != dwarf::invalid_die_index; index = tree.next_sibling(index)) {
+            count += tree.tag(index) == dwarf::Tag::dw_tag_member ? 1 : 0;
+            count += count_members(tree, tree.first_child(index));
+        }
+        return count;
+    }
+
+    auto
+    count_members(Node const * node) -> size_t
+    {
+        size_t count = 0;
+        for(; node != nullptr; node = node->next_sibling) {
+            count += node->tag == dwarf::Tag::dw_tag_member ? 1 : 0;
+            count += count_members(node->first_child);
+        }
+        return count;
+    }
+}
+
+auto
+main() -> int
+{
+    std::span<char const> const data(tests_example_program_example_program_exe);
+    dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+
+    dwarf::DieTree const tree(sections);
+    std::vector<std::unique_ptr<Node>> nodes;
+    build_nodes(tree, nodes);
+
+    double const dies = static_cast<double>(tree.size());
+    // the usual overhead of a heap allocation
+    size_t const allocation_overhead = 16;
+
+    std::cout << "entries: " << tree.size() << std::endl;
+    std::cout << ".debug_info:   " << static_cast<double>(sections.debug_info.size()) / dies << " bytes/DIE" << std::endl;
+    std::cout << "DieTree:       " << static_cast<double>(tree.bytes()) / dies << " bytes/DIE" << std::endl;
+    std::cout << "pointer tree:  " << sizeof(Node) + sizeof(Node *) + allocation_overhead << " bytes/DIE" << std::endl;
+
+    size_t const repetitions = 1000;
+    size_t expected = 0;
+    size_t actual = 0;
+
+    bench::measure("build DieTree", tree.size(), [&]() {
+        dwarf::DieTree const built(sections);
+        bench::do_not_optimize(built.size());
+    });
+
+    bench::measure("traverse pointer tree", tree.size() * repetitions, [&]() {
+        expected = 0;
+        for(size_t r = 0; r < repetitions; ++r) {
+            for(size_t u = 0; u < tree.unit_count(); ++u) {
+                expected += count_members(nodes[tree.unit_root(u)].get());
+            }
+        }
+        bench::do_not_optimize(expected);
+    });
+
+    bench::measure("traverse DieTree", tree.size() * repetitions, [&]() {
+        actual = 0;
+        for(size_t r = 0; r < repetitions; ++r) {
+            for(size_t u = 0; u < tree.unit_count(); ++u) {
+                actual += count_members(tree, tree.unit_root(u));
+            }
+        }
+        bench::do_not_optimize(actual);
+    });
+
+    bench::measure("scan DieTree tags", tree.size() * repetitions, [&]() {
+        // the tag of an entry is a lookup in the small abbreviation table
+        std::vector<uint8_t> is_member;
+        for(auto const & abbrev : tree.abbrevs()) {
+            is_member.push_back(abbrev.tag == dwarf::Tag::dw_tag_member ? 1 : 0);
+        }
+
+        actual = 0;
+        for(size_t r = 0; r < repetitions; ++r) {
+            for(auto const abbrev_index : tree.abbrev_indices()) {
+                actual += is_member[abbrev_index];
+            }
+        }
+        bench::do_not_optimize(actual);
+    });
+
+    std::cout << "members: " << actual / repetitions << ", results equal: " << (actual == expected ? "yes" : "no") << std::endl;
+
+    return actual == expected ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,96 @@
+///
+/// @file:   dwarf_dump.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares printing the abbreviations with the ostream operator<< against
+///          dwarf::BufferedWriter, and formatting the units of a large .debug_info section on one
+///          against several threads
+/// @details The output is written to /dev/null, a generated section with many small units is used
+///
+
+#include "benchmark.hpp"
+#include "dwarf/dump/dwarf_dump.hpp"
+#include "dwarf_fixture.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#if !defined(_WIN32)
+
+auto
+main() -> int
+{
+    std::span<char const> const exe(tests_example_program_example_program_exe);
+    dwarf::DebugSections const exe_sections = dwarf::get_debug_sections(exe);
+    std::FILE * const null = std::fopen("/dev/null", "w");
+    if(null == nullptr) {
+        return EXIT_FAILURE;
+    }
+
+    size_t abbreviations = 0;
+    for(dwarf::DebugAbbrevParser parser(exe_sections.debug_abbrev); parser.next();) {
+        abbreviations += parser.is_tag() ? 1 : 0;
+    }
+
+    {
+        std::ofstream ost("/dev/null");
+        bench::measure("abbrev, ostream operator<<", abbreviations, [&]() {
+            ost << dwarf::DebugAbbrevParser(exe_sections.debug_abbrev);
+        });
+    }
+
+    bench::measure("abbrev, buffered writer", abbreviations, [&]() {
+        dwarf::BufferedWriter writer(null);
+        dwarf::dump_abbrev(writer, exe_sections.debug_abbrev);
+    });
+
+    std::vector<uint64_t> signatures;
+    for(uint64_t i = 0; i < 100000; ++i) {
+        signatures.push_back((i + 1) * 0x9e3779b97f4a7c15);
+    }
+    auto const data = fixture::make_type_units(signatures);
+
+    dwarf::DebugSections sections = {};
+    sections.debug_info = data.debug_info;
+    sections.debug_abbrev = data.debug_abbrev;
+
+    size_t units = 0;
+    for([[maybe_unused]] dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+        ++units;
+    }
+
+    dwarf::BufferedWriter sequential;
+    dwarf::dump_debug_info(sequential, sections, 1);
+    dwarf::BufferedWriter parallel;
+    dwarf::dump_debug_info(parallel, sections, 4);
+    bool const is_equal = sequential.view() == parallel.view();
+
+    bench::measure("info, 1 thread", units, [&]() {
+        dwarf::BufferedWriter writer(null);
+        dwarf::dump_debug_info(writer, sections, 1);
+    });
+
+    bench::measure("info, 4 threads", units, [&]() {
+        dwarf::BufferedWriter writer(null);
+        dwarf::dump_debug_info(writer, sections, 4);
+    });
+
+    std::fclose(null);
+
+    return is_equal ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else
+
+auto
+main() -> int
+{
+    std::cout << "/dev/null is not available on this platform" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+#endif
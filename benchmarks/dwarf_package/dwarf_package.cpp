@@ -0,0 +1,87 @@
+///
+/// @file:   dwarf_package.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares finding the split unit of a skeleton unit in a DWARF package through the
+///          .debug_cu_index hash table against scanning the units of the package
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/split_dwarf/dwarf_package.hpp"
+#include "dwarf_fixture.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+auto
+main() -> int
+{
+    size_t const unit_count = 4096;
+
+    std::vector<fixture::SplitUnit> units;
+    fixture::DebugSectionsData skeleton_data;
+    for(uint64_t i = 0; i < unit_count; ++i) {
+        uint64_t const dwo_id = (i + 1) * 0x9e3779b97f4a7c15;
+        units.emplace_back(dwo_id, "unit" + std::to_string(i) + ".cpp", "int");
+        fixture::append_skeleton_unit(skeleton_data, dwo_id, "unit.dwo", "/");
+    }
+
+    auto const dwp = fixture::make_dwp(units);
+    dwarf::DwarfPackage const package(dwp);
+
+    dwarf::DebugSections skeleton_sections = {};
+    skeleton_sections.debug_info = skeleton_data.debug_info;
+    skeleton_sections.debug_abbrev = skeleton_data.debug_abbrev;
+
+    std::vector<dwarf::Unit> skeletons;
+    for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(skeleton_sections.debug_info)) {
+        skeletons.emplace_back(skeleton_sections, unit_header);
+    }
+
+    // every 64th skeleton unit, the scan visits on average half of the package
+    std::vector<dwarf::Unit> lookups;
+    for(size_t i = 0; i < skeletons.size(); i += 64) {
+        lookups.push_back(skeletons[i]);
+    }
+
+    uint64_t expected = 0;
+    bench::measure("scan .debug_info.dwo", lookups.size(), [&]() {
+        expected = 0;
+        for(auto const & skeleton : lookups) {
+            for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(package.sections().debug_info)) {
+                dwarf::Unit const unit(package.sections(), unit_header);
+                if(unit.dwo_id() == skeleton.dwo_id()) {
+                    expected += unit.offset();
+                    break;
+                }
+            }
+        }
+        bench::do_not_optimize(expected);
+    });
+
+    uint64_t actual = 0;
+    bench::measure(".debug_cu_index", lookups.size(), [&]() {
+        actual = 0;
+        for(auto const & skeleton : lookups) {
+            auto const sections = package.find_unit_sections(skeleton.dwo_id());
+            actual += sections.has_value() ? static_cast<uint64_t>(sections->debug_info.data() - package.sections().debug_info.data()) : 0;
+        }
+        bench::do_not_optimize(actual);
+    });
+
+    size_t found = 0;
+    bench::measure(".debug_cu_index, split unit", lookups.size(), [&]() {
+        found = 0;
+        for(auto const & skeleton : lookups) {
+            found += package.find_split_unit(skeleton).has_value() ? 1 : 0;
+        }
+        bench::do_not_optimize(found);
+    });
+
+    std::cout << "units: " << package.cu_index().unit_count() << ", slots: " << package.cu_index().slot_count() << std::endl;
+
+    return expected == actual && found == lookups.size() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
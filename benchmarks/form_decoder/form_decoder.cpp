@@ -0,0 +1,64 @@
+///
+/// @file:   form_decoder.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares decoding all attribute values with the form table and with a switch over all forms
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_info/die_tree.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+auto
+main() -> int
+{
+    std::span<char const> const data(tests_example_program_example_program_exe);
+    dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+    dwarf::DieTree const tree(sections);
+
+    std::vector<dwarf::DIE> dies;
+    size_t attributes = 0;
+    for(dwarf::DieIndex i = 0; i < tree.size(); ++i) {
+        dies.push_back(tree.die(i));
+        attributes += dies.back().abbrev()->attributes().size();
+    }
+    std::cout << "entries: " << dies.size() << ", attribute values: " << attributes << std::endl;
+
+    size_t const repetitions = 1000;
+
+    auto const decode_all = [&](auto && read) {
+        uint64_t res = 0;
+        for(size_t r = 0; r < repetitions; ++r) {
+            for(auto const & die : dies) {
+                auto const & encoding = die.unit().encoding();
+                size_t index = die.attributes_offset();
+                for(auto const & specification : die.abbrev()->attributes()) {
+                    auto const value = read(sections.debug_info, index, specification.form, specification.implicit_const, encoding);
+                    res += value.value;
+                }
+            }
+        }
+        return res;
+    };
+
+    uint64_t expected = 0;
+    uint64_t actual = 0;
+
+    bench::measure("switch", attributes * repetitions, [&]() {
+        expected = decode_all([](auto && ... args) { return details::read_form_switch(args...); });
+        bench::do_not_optimize(expected);
+    });
+
+    bench::measure("form table", attributes * repetitions, [&]() {
+        actual = decode_all([](auto && ... args) { return dwarf::read_form(args...); });
+        bench::do_not_optimize(actual);
+    });
+
+    std::cout << "results equal: " << (actual == expected ? "yes" : "no") << std::endl;
+
+    return actual == expected ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,62 @@
+///
+/// @file:   incremental_index.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares building the index of a binary with 5000 compilation units against updating
+///          the index after one compilation unit changed
+/// @details The changed unit gets an additional function, so all units after it move. The update
+///          alternates between the two binaries, each update parses one unit.
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_info/incremental_index.hpp"
+#include "dwarf_fixture.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+auto
+main() -> int
+{
+    size_t const unit_count = 5000;
+
+    std::vector<fixture::CompileUnit> units;
+    for(size_t i = 0; i < unit_count; ++i) {
+        units.push_back({"unit" + std::to_string(i), 0x1000 + i * 0x10000, 20 + i % 40, i});
+    }
+    auto const original = fixture::make_compile_units(units);
+
+    ++units[unit_count / 2].functions;
+    auto const changed = fixture::make_compile_units(units);
+
+    std::cout << ".debug_info: " << original.debug_info.size() / 1024 << " KiB, units: " << unit_count << std::endl;
+
+    dwarf::IncrementalIndex index;
+    bench::measure("build", unit_count, [&]() {
+        index = dwarf::IncrementalIndex(original.sections());
+        bench::do_not_optimize(index);
+    });
+
+    dwarf::IndexUpdate unchanged = {};
+    bench::measure("update, no change", unit_count, [&]() {
+        unchanged = index.update(original.sections());
+        bench::do_not_optimize(unchanged);
+    });
+
+    dwarf::IndexUpdate update = {};
+    bool is_changed = false;
+    bench::measure("update, one unit changed", unit_count, [&]() {
+        is_changed = !is_changed;
+        update = index.update(is_changed ? changed.sections() : original.sections());
+        bench::do_not_optimize(update);
+    });
+
+    std::cout << "one unit changed: " << update.reused << " reused, " << update.parsed << " parsed" << std::endl;
+
+    dwarf::IncrementalIndex const expected(is_changed ? changed.sections() : original.sections());
+    std::string const name = "unit" + std::to_string(unit_count - 1) + "_0";
+
+    return unchanged.parsed == 0 && update.parsed == 1 && index.find_name(name) == expected.find_name(name)
+        ? EXIT_SUCCESS : EXIT_FAILURE;
+}
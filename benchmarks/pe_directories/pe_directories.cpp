@@ -0,0 +1,97 @@
+///
+/// @file:   pe_directories.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares looking up the exports of a DLL in the hashed pei::ExportIndex against a binary
+///          search of the name pointer table of the export directory, as the loader does, and reading
+///          the build identity of the debug directory against hashing the whole file
+///
+
+#include "benchmark.hpp"
+#include "dwarf_fixture.hpp"
+#include "pei/pei.hpp"
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+auto
+main() -> int
+{
+    // about the number of exports of kernel32.dll
+    size_t const count = 1600;
+    std::vector<fixture::DllExport> exports;
+    for(size_t i = 0; i < count; ++i) {
+        exports.push_back({"ExportedFunction" + std::to_string(i * 7919 % count), static_cast<uint32_t>(i * 0x20)});
+    }
+    auto const dll = fixture::make_dll("bench.dll", exports, 0x180000000, fixture::make_codeview("0123456789abcdef", 1));
+
+    std::mt19937 random(42);
+    std::vector<std::string_view> names;
+    std::vector<uint64_t> addresses;
+    for(size_t i = 0; i < 1024; ++i) {
+        auto const & entry = exports[random() % count];
+        names.push_back(entry.name);
+        addresses.push_back(0x180001000 + entry.offset + random() % 0x20);
+    }
+
+    bench::measure("export index, build", count, [&]() {
+        pei::ExportIndex const index(dll);
+        bench::do_not_optimize(index);
+    });
+
+    pei::ExportIndex const index(dll);
+    size_t by_name = 0;
+    bench::measure("export index, find by name", names.size(), [&]() {
+        by_name = 0;
+        for(auto const name : names) {
+            by_name += index.find(name)->rva;
+        }
+        bench::do_not_optimize(by_name);
+    });
+
+    pei::ExportDirectory const directory(dll);
+    size_t searched = 0;
+    bench::measure("name pointer table, binary search", names.size(), [&]() {
+        searched = 0;
+        for(auto const name : names) {
+            uint32_t low = 0;
+            uint32_t high = directory.number_of_names();
+            while(low < high) {
+                uint32_t const middle = low + (high - low) / 2;
+                if(directory.name(middle) < name) {
+                    low = middle + 1;
+                }
+                else {
+                    high = middle;
+                }
+            }
+            searched += directory.function(directory.name_ordinal(low)).rva;
+        }
+        bench::do_not_optimize(searched);
+    });
+
+    size_t by_address = 0;
+    bench::measure("export index, find by address", addresses.size(), [&]() {
+        by_address = 0;
+        for(auto const address : addresses) {
+            by_address += index.find(address)->rva;
+        }
+        bench::do_not_optimize(by_address);
+    });
+
+    pei::ImageKey key = {};
+    bench::measure("debug directory, build identity", 1, [&]() {
+        key = pei::DebugDirectory(dll).key();
+        bench::do_not_optimize(key);
+    });
+
+    size_t hash = 0;
+    bench::measure("whole file, hash", 1, [&]() {
+        hash = std::hash<std::string_view>()(std::string_view(dll.data(), dll.size()));
+        bench::do_not_optimize(hash);
+    });
+
+    return by_name == searched && by_address > 0 && key.is_stable() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,129 @@
+///
+/// @file:   generate_corpus.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Writes a synthetic corpus of debug sections into a directory, one file per section
+/// @details Usage: generate_dwarf_corpus <output directory> [--units=N] [--depth=N] [--children=N]
+///          [--forms=string,data4,...] [--rows=N]
+///          The sections are written in blocks, so the corpus may be larger than the memory.
+///          Read it with dwarf_reader_bench <output directory>.
+///
+
+#include "synthetic_corpus.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    constexpr size_t block_size = 64 * 1024 * 1024;
+
+    auto
+    parse_forms(std::string_view list) -> std::vector<dwarf::Form>
+    {
+        std::vector<dwarf::Form> res;
+        while(!list.empty()) {
+            auto const end = std::min(list.find(','), list.size());
+            res.push_back(corpus::find_form(list.substr(0, end)).form);
+            list.remove_prefix(std::min(end + 1, list.size()));
+        }
+        return res;
+    }
+
+    auto
+    parse_options(int const argc, char const * const * const argv, corpus::CorpusOptions & options) -> void
+    {
+        for(int i = 2; i < argc; ++i) {
+            std::string_view const argument(argv[i]);
+            auto const value = argument.substr(std::min(argument.find('=') + 1, argument.size()));
+
+            if(argument.starts_with("--units=")) {
+                options.units = std::stoull(std::string(value));
+            }
+            else if(argument.starts_with("--depth=")) {
+                options.depth = std::stoull(std::string(value));
+            }
+            else if(argument.starts_with("--children=")) {
+                options.children = std::stoull(std::string(value));
+            }
+            else if(argument.starts_with("--forms=")) {
+                options.forms = parse_forms(value);
+            }
+            else if(argument.starts_with("--rows=")) {
+                options.line_rows = std::stoull(std::string(value));
+            }
+            else {
+                throw std::range_error("unknown option: " + std::string(argument));
+            }
+        }
+    }
+
+    auto
+    write(std::ofstream & file, corpus::Bytes & bytes) -> void
+    {
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        bytes.clear();
+    }
+}
+
+auto
+main(int argc, char * argv[]) -> int
+{
+    if(argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <output directory> [--units=N] [--depth=N] [--children=N] "
+            "[--forms=string,data4,...] [--rows=N]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    try {
+        corpus::CorpusOptions options;
+        parse_options(argc, argv, options);
+
+        std::filesystem::path const directory(argv[1]);
+        std::filesystem::create_directories(directory);
+        std::ofstream info(directory / "debug_info", std::ios::binary);
+        std::ofstream line(directory / "debug_line", std::ios::binary);
+
+        corpus::CorpusSections sections;
+        corpus::CorpusGenerator generator(options, sections);
+
+        size_t info_size = 0;
+        for(size_t i = 0; i < options.units; ++i) {
+            generator.append_unit(sections);
+            if(sections.debug_info.size() >= block_size) {
+                info_size += sections.debug_info.size();
+                write(info, sections.debug_info);
+                write(line, sections.debug_line);
+            }
+        }
+        info_size += sections.debug_info.size();
+        write(info, sections.debug_info);
+        write(line, sections.debug_line);
+
+        std::ofstream abbrev(directory / "debug_abbrev", std::ios::binary);
+        write(abbrev, sections.debug_abbrev);
+        std::ofstream str(directory / "debug_str", std::ios::binary);
+        write(str, sections.debug_str);
+
+        if(!info || !line || !abbrev || !str) {
+            std::cerr << "writing to " << directory << " failed" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << options.units << " units with " << generator.entries_per_unit() << " entries each, "
+            << info_size << " bytes of .debug_info" << std::endl;
+    }
+    catch(std::exception const & e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+///
+/// @file:   reader.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Microbenchmarks of the building blocks of the reader: LEB128 decoding, abbreviation
+///          parsing, unit header iteration, section lookup and walking the entries
+/// @details Usage: dwarf_reader_bench [corpus directory]
+///          The corpus is written by generate_dwarf_corpus. Without a directory a corpus of 1000
+///          units is generated in memory.
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_abbrev/debug_abbrev_table.hpp"
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/die_cursor.hpp"
+#include "dwarf/mapped_file.hpp"
+#include "synthetic_corpus.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace
+{
+    ///
+    /// @brief Returns LEB128 numbers of 1 to 10 bytes, most of them short as in .debug_info
+    ///
+    auto
+    make_leb128_numbers(size_t const count) -> corpus::Bytes
+    {
+        std::mt19937_64 random(42);
+        std::discrete_distribution<size_t> bytes({60, 25, 10, 3, 1, 1});
+
+        corpus::Bytes res;
+        for(size_t i = 0; i < count; ++i) {
+            size_t const bits = 7 * (bytes(random) + 1);
+            uint64_t value = random() >> (64 - std::min<size_t>(bits, 64));
+            do {
+                uint8_t const byte = value & 0x7f;
+                value >>= 7;
+                res.push_back(static_cast<char>(value != 0 ? byte | 0x80 : byte));
+            } while(value != 0);
+        }
+        return res;
+    }
+}
+
+auto
+main(int argc, char * argv[]) -> int
+{
+    // the corpus, mapped from the files of generate_dwarf_corpus or generated in memory
+    std::vector<dwarf::MappedFile> files;
+    corpus::CorpusSections generated;
+    dwarf::DebugSections sections = {};
+    if(argc > 1) {
+        std::filesystem::path const directory(argv[1]);
+        for(auto const & [suffix, member] : dwarf::debug_section_names) {
+            auto const path = directory / ("debug_" + std::string(suffix));
+            if(std::filesystem::exists(path)) {
+                sections.*member = files.emplace_back(path).data();
+            }
+        }
+    }
+    else {
+        generated = corpus::make_corpus(corpus::CorpusOptions{});
+        sections = corpus::debug_sections(generated);
+    }
+
+    std::cout << "corpus: " << sections.debug_info.size() << " bytes of .debug_info" << std::endl;
+
+    std::span<char const> const exe(tests_example_program_example_program_exe);
+
+    // LEB128
+    size_t const numbers = 1 << 20;
+    auto const leb128 = make_leb128_numbers(numbers);
+    uint64_t unsigned_sum = 0;
+    bench::measure("uleb128", numbers, [&]() {
+        unsigned_sum = 0;
+        for(size_t index = 0; index < leb128.size();) {
+            auto const res = details::uleb128<uint64_t>(leb128, index);
+            unsigned_sum += res.val;
+            index += res.bytes_read;
+        }
+        bench::do_not_optimize(unsigned_sum);
+    });
+
+    bench::measure("sleb128", numbers, [&]() {
+        int64_t sum = 0;
+        for(size_t index = 0; index < leb128.size();) {
+            auto const res = details::sleb128<int64_t>(leb128, index);
+            sum += res.val;
+            index += res.bytes_read;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    // abbreviations of the example program
+    auto const exe_sections = dwarf::get_debug_sections(exe);
+    size_t abbreviations = 0;
+    for(dwarf::DebugAbbrevParser parser(exe_sections.debug_abbrev); parser.next();) {
+        abbreviations += parser.is_tag() ? 1 : 0;
+    }
+
+    bench::measure("abbrev parser", abbreviations, [&]() {
+        size_t count = 0;
+        for(dwarf::DebugAbbrevParser parser(exe_sections.debug_abbrev); parser.next();) {
+            count += parser.is_form() ? 1 : 0;
+        }
+        bench::do_not_optimize(count);
+    });
+
+    bench::measure("abbrev table", abbreviations, [&]() {
+        size_t count = 0;
+        for(size_t offset = 0; offset < exe_sections.debug_abbrev.size();) {
+            dwarf::DebugAbbrevTable const table(exe_sections.debug_abbrev, offset);
+            count += table.size();
+            if(table.size() == 0) {
+                break;
+            }
+
+            // the table ends behind the terminating 0 of the last declaration
+            dwarf::DebugAbbrevParser parser(exe_sections.debug_abbrev, offset);
+            while(parser.next() && !parser.is_end_of_table()) {}
+            offset = parser.get_index();
+        }
+        bench::do_not_optimize(count);
+    });
+
+    // unit headers of the corpus
+    size_t units = 0;
+    for([[maybe_unused]] dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+        ++units;
+    }
+
+    bench::measure("unit headers", units, [&]() {
+        size_t size = 0;
+        for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+            size += unit_header.unit_length();
+        }
+        bench::do_not_optimize(size);
+    });
+
+    // sections of the example program
+    bench::measure("find_section", 1, [&]() {
+        pei::SectionTable const section_table(exe);
+        auto const section = section_table.find_section(".debug_info");
+        bench::do_not_optimize(section);
+    }, 1000);
+
+    bench::measure("get_debug_sections", 1, [&]() {
+        auto const debug_sections = dwarf::get_debug_sections(exe);
+        bench::do_not_optimize(debug_sections);
+    }, 1000);
+
+    // entries of the corpus
+    size_t entries = 0;
+    for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+        dwarf::Unit const unit(sections, unit_header);
+        for(dwarf::DieCursor cursor(unit); cursor.next();) {
+            ++entries;
+        }
+    }
+
+    bench::measure("walk entries", entries, [&]() {
+        size_t count = 0;
+        for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+            dwarf::Unit const unit(sections, unit_header);
+            for(dwarf::DieCursor cursor(unit); cursor.next();) {
+                count += static_cast<size_t>(cursor.die().tag());
+            }
+        }
+        bench::do_not_optimize(count);
+    });
+
+    bench::measure("walk entries and attributes", entries, [&]() {
+        uint64_t sum = 0;
+        for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+            dwarf::Unit const unit(sections, unit_header);
+            for(dwarf::DieCursor cursor(unit); cursor.next();) {
+                cursor.read_attributes([&](auto const &, dwarf::AttributeValue const & value) {
+                    sum += value.as_unsigned();
+                });
+            }
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    std::cout << units << " units, " << entries << " entries" << std::endl;
+
+    return unsigned_sum > 0 && entries >= units && units > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,439 @@
+///
+/// @file:   synthetic_corpus.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Generates synthetic .debug_info, .debug_abbrev, .debug_line and .debug_str sections
+///          of any size to measure how the reader scales
+///
+
+#pragma once
+
+#include "dwarf/debug_sections.hpp"
+#include "dwarf/dwarf_tags.hpp"
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace corpus
+{
+    /// @brief The content of a section
+    using Bytes = std::vector<char>;
+
+    /// @class corpus::FormAttribute
+    ///
+    /// @brief A form the generator can write and the attribute it is written for
+    ///
+    struct FormAttribute final
+    {
+        dwarf::Form form;
+        dwarf::Attribute attribute;
+        /// @brief The name of the form without the DW_FORM_ prefix
+        std::string_view name;
+    };
+
+    /// @brief The forms of the attributes of the generated entries, each form is used for a different attribute
+    constexpr std::array<FormAttribute, 11> supported_forms = {{
+        {dwarf::Form::dw_form_string,       dwarf::Attribute::dw_at_name,                   "string"},
+        {dwarf::Form::dw_form_strp,         dwarf::Attribute::dw_at_linkage_name,           "strp"},
+        {dwarf::Form::dw_form_data1,        dwarf::Attribute::dw_at_byte_size,              "data1"},
+        {dwarf::Form::dw_form_data2,        dwarf::Attribute::dw_at_decl_file,              "data2"},
+        {dwarf::Form::dw_form_data4,        dwarf::Attribute::dw_at_decl_line,              "data4"},
+        {dwarf::Form::dw_form_data8,        dwarf::Attribute::dw_at_const_value,            "data8"},
+        {dwarf::Form::dw_form_udata,        dwarf::Attribute::dw_at_decl_column,            "udata"},
+        {dwarf::Form::dw_form_sdata,        dwarf::Attribute::dw_at_data_member_location,   "sdata"},
+        {dwarf::Form::dw_form_ref4,         dwarf::Attribute::dw_at_type,                   "ref4"},
+        {dwarf::Form::dw_form_flag_present, dwarf::Attribute::dw_at_external,               "flag_present"},
+        {dwarf::Form::dw_form_exprloc,      dwarf::Attribute::dw_at_location,               "exprloc"}
+    }};
+
+    ///
+    /// @brief Returns the entry of a form in corpus::supported_forms
+    /// @param name the name of the form without the DW_FORM_ prefix, e.g. "data4"
+    ///
+    [[nodiscard]] inline auto
+    find_form(std::string_view const name) -> FormAttribute const &
+    {
+        for(auto const & entry : supported_forms) {
+            if(entry.name == name) {
+                return entry;
+            }
+        }
+
+        throw std::range_error("unsupported form: " + std::string(name));
+    }
+
+    /// @class corpus::CorpusOptions
+    ///
+    /// @brief The shape of the generated compilation units
+    ///
+    struct CorpusOptions final
+    {
+        /// @brief The number of compilation units
+        size_t units = 1000;
+        /// @brief The depth of the tree of entries below the unit entry
+        size_t depth = 3;
+        /// @brief The number of children of every entry above the last level
+        size_t children = 4;
+        /// @brief The forms of the attributes of every entry below the unit entry
+        std::vector<dwarf::Form> forms = {
+            dwarf::Form::dw_form_string, dwarf::Form::dw_form_data1, dwarf::Form::dw_form_data4,
+            dwarf::Form::dw_form_udata, dwarf::Form::dw_form_ref4};
+        /// @brief The number of rows of the line number program of every unit
+        size_t line_rows = 16;
+    };
+
+    /// @class corpus::CorpusSections
+    ///
+    /// @brief The generated sections, or the part of them not yet written to a file
+    ///
+    struct CorpusSections final
+    {
+        Bytes debug_info;
+        Bytes debug_abbrev;
+        Bytes debug_line;
+        Bytes debug_str;
+    };
+
+    /// @class corpus::CorpusGenerator
+    ///
+    /// @brief Appends one compilation unit at a time to the sections
+    /// @details All units share one abbreviation table and the strings of .debug_str, so only
+    ///     .debug_info and .debug_line grow with the number of units. The generator keeps the
+    ///     total size of the sections, the caller may write the appended data to a file and clear
+    ///     the buffers between two units. The units use the 32-bit DWARF format, std::range_error
+    ///     is thrown if .debug_line grows beyond 4 GiB.
+    ///
+    class CorpusGenerator final
+    {
+    public:
+
+        ///
+        /// @brief constructor
+        /// @details Appends the abbreviation table and the strings to the sections
+        ///
+        CorpusGenerator(CorpusOptions options, CorpusSections & sections)
+            : options_(std::move(options))
+        {
+            for(auto const form : options_.forms) {
+                static_cast<void>(find(form));
+            }
+
+            append_abbreviations(sections.debug_abbrev);
+
+            // the strings of the entries at the same position of every unit
+            for(size_t i = 0; i < entries_per_unit(); ++i) {
+                string_offsets_.push_back(static_cast<uint32_t>(sections.debug_str.size()));
+                append_string(sections.debug_str, "_ZN6corpus6member" + std::to_string(i) + "E");
+            }
+        }
+
+        ///
+        /// @brief Returns the number of entries of every unit, including the unit entry
+        ///
+        [[nodiscard]] auto
+        entries_per_unit() const noexcept -> size_t
+        {
+            size_t res = 1;
+            size_t level = 1;
+            for(size_t i = 0; i < options_.depth; ++i) {
+                level *= options_.children;
+                res += level;
+            }
+            return res;
+        }
+
+        [[nodiscard]] auto
+        options() const noexcept -> CorpusOptions const &
+        {
+            return options_;
+        }
+
+        ///
+        /// @brief Appends the next unit to .debug_info and its line number program to .debug_line
+        ///
+        auto
+        append_unit(CorpusSections & sections) -> void
+        {
+            size_t const line_offset = line_size_;
+            size_t const line_begin = sections.debug_line.size();
+            append_line_program(sections.debug_line);
+            line_size_ += sections.debug_line.size() - line_begin;
+            if(line_size_ > std::numeric_limits<uint32_t>::max()) {
+                throw std::range_error(".debug_line exceeds the 32-bit DWARF format");
+            }
+
+            auto & info = sections.debug_info;
+            size_t const offset = info.size();
+            append<uint32_t>(info, 0);              // unit_length
+            append<uint16_t>(info, 5);              // version
+            append<uint8_t>(info, 0x01);            // DW_UT_compile
+            append<uint8_t>(info, 8);               // address_size
+            append<uint32_t>(info, 0);              // debug_abbrev_offset
+
+            append<uint8_t>(info, 1);
+            append_string(info, "unit" + std::to_string(units_) + ".cpp");
+            append<uint8_t>(info, 0x21);            // DW_LANG_C_plus_plus_14
+            append<uint64_t>(info, low_pc());
+            append<uint64_t>(info, options_.line_rows * 4);
+            append<uint32_t>(info, line_offset);
+
+            size_t entry = 1;
+            size_t const first_child = info.size() - offset;
+            if(options_.depth > 0) {
+                for(size_t i = 0; i < options_.children; ++i) {
+                    append_entry(info, 1, entry, first_child);
+                }
+            }
+            append<uint8_t>(info, 0);
+            finish_unit(info, offset);
+
+            ++units_;
+        }
+
+    private:
+        [[nodiscard]] static auto
+        find(dwarf::Form const form) -> FormAttribute const &
+        {
+            for(auto const & entry : supported_forms) {
+                if(entry.form == form) {
+                    return entry;
+                }
+            }
+
+            throw std::range_error("unsupported form: " + std::to_string(static_cast<int>(form)));
+        }
+
+        template<typename T>
+        static auto
+        append(Bytes & bytes, T const value) -> void
+        {
+            for(size_t i = 0; i < sizeof(T); ++i) {
+                bytes.push_back(static_cast<char>(static_cast<uint64_t>(value) >> (i * 8)));
+            }
+        }
+
+        static auto
+        append_uleb128(Bytes & bytes, uint64_t value) -> void
+        {
+            do {
+                uint8_t const byte = value & 0x7f;
+                value >>= 7;
+                bytes.push_back(static_cast<char>(value != 0 ? byte | 0x80 : byte));
+            } while(value != 0);
+        }
+
+        static auto
+        append_sleb128(Bytes & bytes, int64_t value) -> void
+        {
+            bool more = true;
+            while(more) {
+                uint8_t const byte = value & 0x7f;
+                value >>= 7;
+                more = !((value == 0 && (byte & 0x40) == 0) || (value == -1 && (byte & 0x40) != 0));
+                bytes.push_back(static_cast<char>(more ? byte | 0x80 : byte));
+            }
+        }
+
+        static auto
+        append_string(Bytes & bytes, std::string_view const str) -> void
+        {
+            bytes.insert(bytes.end(), str.begin(), str.end());
+            bytes.push_back('\0');
+        }
+
+        static auto
+        finish_unit(Bytes & bytes, size_t const offset) -> void
+        {
+            auto const length = static_cast<uint32_t>(bytes.size() - offset - sizeof(uint32_t));
+            for(size_t i = 0; i < sizeof(uint32_t); ++i) {
+                bytes[offset + i] = static_cast<char>(length >> (i * 8));
+            }
+        }
+
+        [[nodiscard]] auto
+        low_pc() const noexcept -> uint64_t
+        {
+            return 0x140001000 + units_ * options_.line_rows * 4;
+        }
+
+        ///
+        /// @brief 1: DW_TAG_compile_unit, 2: DW_TAG_structure_type with children, 3: DW_TAG_member
+        ///
+        auto
+        append_abbreviations(Bytes & abbrev) const -> void
+        {
+            abbrev.insert(abbrev.end(), {
+                1, 0x11, 1,
+                0x03, 0x08,     // DW_AT_name, DW_FORM_string
+                0x13, 0x0b,     // DW_AT_language, DW_FORM_data1
+                0x11, 0x01,     // DW_AT_low_pc, DW_FORM_addr
+                0x12, 0x07,     // DW_AT_high_pc, DW_FORM_data8
+                0x10, 0x17,     // DW_AT_stmt_list, DW_FORM_sec_offset
+                0, 0});
+
+            for(uint8_t code = 2; code <= 3; ++code) {
+                append<uint8_t>(abbrev, code);
+                append_uleb128(abbrev, static_cast<uint64_t>(code == 2 ? dwarf::Tag::dw_tag_structure_type : dwarf::Tag::dw_tag_member));
+                append<uint8_t>(abbrev, code == 2 ? 1 : 0);
+                for(auto const form : options_.forms) {
+                    append_uleb128(abbrev, static_cast<uint64_t>(find(form).attribute));
+                    append_uleb128(abbrev, static_cast<uint64_t>(form));
+                }
+                append<uint16_t>(abbrev, 0);
+            }
+
+            append<uint8_t>(abbrev, 0);
+        }
+
+        ///
+        /// @brief Appends an entry and its children in prefix order
+        /// @param entry the index of the entry in its unit, counts up
+        /// @param first_child the offset of the first child of the unit entry, referenced by DW_FORM_ref4
+        ///
+        auto
+        append_entry(Bytes & info, size_t const level, size_t & entry, size_t const first_child) const -> void
+        {
+            bool const has_children = level < options_.depth;
+            size_t const index = entry++;
+
+            append<uint8_t>(info, has_children ? 2 : 3);
+            for(auto const form : options_.forms) {
+                switch (form)
+                {
+                case dwarf::Form::dw_form_string:
+                    append_string(info, "member" + std::to_string(index));
+                    break;
+                case dwarf::Form::dw_form_strp:
+                    append<uint32_t>(info, string_offsets_[index]);
+                    break;
+                case dwarf::Form::dw_form_data1:
+                    append<uint8_t>(info, index);
+                    break;
+                case dwarf::Form::dw_form_data2:
+                    append<uint16_t>(info, index);
+                    break;
+                case dwarf::Form::dw_form_data4:
+                    append<uint32_t>(info, index * 3 + 1);
+                    break;
+                case dwarf::Form::dw_form_data8:
+                    append<uint64_t>(info, index * 0x9e3779b97f4a7c15);
+                    break;
+                case dwarf::Form::dw_form_udata:
+                    append_uleb128(info, index * 37);
+                    break;
+                case dwarf::Form::dw_form_sdata:
+                    append_sleb128(info, static_cast<int64_t>(index * 8) - 64);
+                    break;
+                case dwarf::Form::dw_form_ref4:
+                    append<uint32_t>(info, first_child);
+                    break;
+                case dwarf::Form::dw_form_exprloc:
+                    // DW_OP_fbreg <offset>
+                    append<uint8_t>(info, 2);
+                    append<uint8_t>(info, 0x91);
+                    append<uint8_t>(info, (index * 8) & 0x3f);
+                    break;
+                default:    // dw_form_flag_present
+                    break;
+                }
+            }
+
+            if(has_children) {
+                for(size_t i = 0; i < options_.children; ++i) {
+                    append_entry(info, level + 1, entry, first_child);
+                }
+                append<uint8_t>(info, 0);
+            }
+        }
+
+        ///
+        /// @brief Appends a DWARF 5 line number program with one sequence of line_rows rows
+        ///
+        auto
+        append_line_program(Bytes & line) const -> void
+        {
+            size_t const offset = line.size();
+            append<uint32_t>(line, 0);              // unit_length
+            append<uint16_t>(line, 5);              // version
+            append<uint8_t>(line, 8);               // address_size
+            append<uint8_t>(line, 0);               // segment_selector_size
+            size_t const header_length_offset = line.size();
+            append<uint32_t>(line, 0);              // header_length
+            line.insert(line.end(), {
+                1,                                  // minimum_instruction_length
+                1,                                  // maximum_operations_per_instruction
+                1,                                  // default_is_stmt
+                -5,                                 // line_base
+                14,                                 // line_range
+                13,                                 // opcode_base
+                0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, // standard_opcode_lengths
+                1, 0x01, 0x08,                      // directory format: DW_LNCT_path, DW_FORM_string
+                1});                                // directories_count
+            append_string(line, "/corpus");
+            line.insert(line.end(), {
+                2, 0x01, 0x08, 0x02, 0x0b,          // file format: DW_LNCT_path, DW_LNCT_directory_index
+                2});                                // file_names_count, the file register starts at 1
+            for(size_t i = 0; i < 2; ++i) {
+                append_string(line, "unit" + std::to_string(units_) + ".cpp");
+                append<uint8_t>(line, 0);
+            }
+
+            auto const header_length = static_cast<uint32_t>(line.size() - header_length_offset - sizeof(uint32_t));
+            for(size_t i = 0; i < sizeof(uint32_t); ++i) {
+                line[header_length_offset + i] = static_cast<char>(header_length >> (i * 8));
+            }
+
+            // DW_LNE_set_address
+            line.insert(line.end(), {0, 9, 2});
+            append<uint64_t>(line, low_pc());
+            for(size_t i = 0; i < options_.line_rows; ++i) {
+                // DW_LNS_copy for the first row, then special opcodes: address += 4, line += 1 + i % 3
+                append<uint8_t>(line, i == 0 ? 1 : 13 + (1 + i % 3 + 5) + 14 * 4);
+            }
+            // DW_LNS_advance_pc to high_pc, DW_LNE_end_sequence
+            line.insert(line.end(), {2, 4, 0, 1, 1});
+
+            finish_unit(line, offset);
+        }
+
+        CorpusOptions options_;
+        size_t units_ = 0;
+        size_t line_size_ = 0;
+        /// @brief The offsets of the linkage names of the entries of a unit in .debug_str
+        std::vector<uint32_t> string_offsets_;
+    };
+
+    ///
+    /// @brief Generates all units in memory
+    ///
+    [[nodiscard]] inline auto
+    make_corpus(CorpusOptions const & options) -> CorpusSections
+    {
+        CorpusSections res;
+        CorpusGenerator generator(options, res);
+        for(size_t i = 0; i < options.units; ++i) {
+            generator.append_unit(res);
+        }
+        return res;
+    }
+
+    ///
+    /// @brief Returns the generated sections as dwarf::DebugSections
+    ///
+    [[nodiscard]] inline auto
+    debug_sections(CorpusSections const & sections) noexcept -> dwarf::DebugSections
+    {
+        dwarf::DebugSections res = {};
+        res.debug_info = sections.debug_info;
+        res.debug_abbrev = sections.debug_abbrev;
+        res.debug_line = sections.debug_line;
+        res.debug_str = sections.debug_str;
+        return res;
+    }
+}
@@ -0,0 +1,130 @@
+///
+/// @file:   section_cache.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares the time to the first lookup in an image with compressed debug sections against
+///          an image with uncompressed debug sections
+/// @details The first lookup reads the name of the first named entry of the first unit. The example
+///          program and a generated image with a large .debug_info section are measured.
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_info/die_cursor.hpp"
+#include "dwarf/section_cache.hpp"
+#include "dwarf_fixture.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(DWARF_READER_HAS_ZLIB)
+
+namespace
+{
+    ///
+    /// @brief Returns the name of the first named entry of the first unit
+    ///
+    auto
+    first_name(dwarf::DebugSections const & sections) -> std::string_view
+    {
+        dwarf::Unit const unit(sections, dwarf::UnitHeader(sections.debug_info));
+        dwarf::DieCursor cursor(unit);
+        while(cursor.next()) {
+            auto const name = cursor.die().attribute(dwarf::Attribute::dw_at_name);
+            if(name.is_valid()) {
+                return name.as_string();
+            }
+        }
+
+        return {};
+    }
+
+    ///
+    /// @brief Returns the sections needed to read the first unit, only the first unit of
+    ///     .debug_info is decompressed
+    ///
+    auto
+    first_unit_sections(dwarf::SectionCache & cache) -> dwarf::DebugSections
+    {
+        dwarf::DebugSections res = {};
+        res.debug_info = cache.unit(&dwarf::DebugSections::debug_info, 0);
+        res.debug_abbrev = cache.section(&dwarf::DebugSections::debug_abbrev);
+        res.debug_str = cache.section(&dwarf::DebugSections::debug_str);
+        res.debug_line_str = cache.section(&dwarf::DebugSections::debug_line_str);
+        res.debug_str_offsets = cache.section(&dwarf::DebugSections::debug_str_offsets);
+        res.debug_addr = cache.section(&dwarf::DebugSections::debug_addr);
+        return res;
+    }
+
+    auto
+    measure_image(std::string const & name, dwarf::DebugSections const & sections) -> bool
+    {
+        auto const uncompressed = fixture::make_debug_object(sections, false);
+        auto const compressed = fixture::make_debug_object(sections, true);
+        std::cout << name << ": .debug_info " << sections.debug_info.size() / 1024 << " KiB, image "
+            << uncompressed.size() / 1024 << " KiB, compressed " << compressed.size() / 1024 << " KiB" << std::endl;
+
+        std::string_view expected;
+        bench::measure(name + ", uncompressed", 1, [&]() {
+            dwarf::SectionCache cache(uncompressed);
+            expected = first_name(cache.sections());
+            bench::do_not_optimize(expected);
+        });
+
+        std::string_view sequential;
+        bench::measure(name + ", all sections", 1, [&]() {
+            dwarf::SectionCache cache(compressed);
+            sequential = first_name(cache.sections(dwarf::SectionLoading::sequential));
+            bench::do_not_optimize(sequential);
+        });
+
+        std::string_view parallel;
+        bench::measure(name + ", all sections, parallel", 1, [&]() {
+            dwarf::SectionCache cache(compressed);
+            parallel = first_name(cache.sections(dwarf::SectionLoading::parallel));
+            bench::do_not_optimize(parallel);
+        });
+
+        std::string_view streaming;
+        bench::measure(name + ", first unit", 1, [&]() {
+            dwarf::SectionCache cache(compressed);
+            streaming = first_name(first_unit_sections(cache));
+            bench::do_not_optimize(streaming);
+        });
+
+        return !expected.empty() && expected == sequential && expected == parallel && expected == streaming;
+    }
+}
+
+auto
+main() -> int
+{
+    std::span<char const> const exe(tests_example_program_example_program_exe);
+    bool const is_example_equal = measure_image("example", dwarf::get_debug_sections(exe));
+
+    std::vector<uint64_t> signatures;
+    for(uint64_t i = 0; i < 200000; ++i) {
+        signatures.push_back((i + 1) * 0x9e3779b97f4a7c15);
+    }
+    auto const data = fixture::make_type_units(signatures);
+
+    dwarf::DebugSections generated = {};
+    generated.debug_info = data.debug_info;
+    generated.debug_abbrev = data.debug_abbrev;
+    bool const is_generated_equal = measure_image("generated", generated);
+
+    return is_example_equal && is_generated_equal ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else
+
+auto
+main() -> int
+{
+    std::cout << "zlib is not available, compressed sections are not measured" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+#endif
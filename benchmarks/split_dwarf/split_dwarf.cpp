@@ -0,0 +1,124 @@
+///
+/// @file:   split_dwarf.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares the latency of reading an attribute of a split unit through a cold and a warm
+///          dwarf::DwoResolver against reading it from a monolithic binary
+///
+
+#include "benchmark.hpp"
+#include "dwarf/split_dwarf/dwo_resolver.hpp"
+#include "dwarf_fixture.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    auto
+    name(dwarf::Unit const & unit) -> std::string_view
+    {
+        return dwarf::DIE(unit, unit.first_die_offset()).attribute(dwarf::Attribute::dw_at_name).as_string();
+    }
+}
+
+auto
+main() -> int
+{
+    size_t const files = 256;
+    auto const directory = std::filesystem::temp_directory_path() / "dwarf_split_dwarf_bench";
+    std::filesystem::create_directories(directory);
+
+    // one .dwo file per unit and the same units in one monolithic .debug_info section
+    fixture::DebugSectionsData skeleton_data;
+    fixture::DebugSectionsData monolithic_data;
+    for(size_t i = 0; i < files; ++i) {
+        std::string const dwo_name = std::to_string(i) + ".dwo";
+        std::string const unit_name = std::to_string(i) + ".cpp";
+        fixture::append_skeleton_unit(skeleton_data, i + 1, dwo_name, directory.string());
+        fixture::append_split_unit(monolithic_data, i + 1, unit_name, "int");
+
+        auto const bytes = fixture::make_dwo(i + 1, unit_name, "int");
+        std::ofstream file(directory / dwo_name, std::ios::binary);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    dwarf::DebugSections skeleton_sections = {};
+    skeleton_sections.debug_info = skeleton_data.debug_info;
+    skeleton_sections.debug_abbrev = skeleton_data.debug_abbrev;
+
+    dwarf::DebugSections monolithic_sections = {};
+    monolithic_sections.debug_info = monolithic_data.debug_info;
+    monolithic_sections.debug_abbrev = monolithic_data.debug_abbrev;
+
+    std::vector<dwarf::Unit> skeletons;
+    for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(skeleton_sections.debug_info)) {
+        skeletons.emplace_back(skeleton_sections, unit_header);
+    }
+
+    std::vector<dwarf::Unit> units;
+    for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(monolithic_sections.debug_info)) {
+        units.emplace_back(monolithic_sections, unit_header);
+    }
+
+    size_t expected = 0;
+    bench::measure("monolithic", files, [&]() {
+        expected = 0;
+        for(auto const & unit : units) {
+            expected += name(unit).size();
+        }
+        bench::do_not_optimize(expected);
+    });
+
+    // every lookup maps and parses a .dwo file
+    size_t cold = 0;
+    bench::measure("split, cold resolver", files, [&]() {
+        dwarf::DwoResolver resolver(files);
+        cold = 0;
+        for(auto const & skeleton : skeletons) {
+            auto const file = resolver.resolve(skeleton);
+            cold += file != nullptr ? name(file->unit()).size() : 0;
+        }
+        bench::do_not_optimize(cold);
+    });
+
+    // every lookup is answered by an open mapping
+    dwarf::DwoResolver warm_resolver(files);
+    for(auto const & skeleton : skeletons) {
+        bench::do_not_optimize(warm_resolver.resolve(skeleton));
+    }
+
+    size_t warm = 0;
+    bench::measure("split, warm resolver", files, [&]() {
+        warm = 0;
+        for(auto const & skeleton : skeletons) {
+            auto const file = warm_resolver.resolve(skeleton);
+            warm += file != nullptr ? name(file->unit()).size() : 0;
+        }
+        bench::do_not_optimize(warm);
+    });
+
+    // half of the files stay mapped, the lookups in order always evict the next file
+    dwarf::DwoResolver small_resolver(files / 2);
+    size_t thrashing = 0;
+    bench::measure("split, capacity half the files", files, [&]() {
+        thrashing = 0;
+        for(auto const & skeleton : skeletons) {
+            auto const file = small_resolver.resolve(skeleton);
+            thrashing += file != nullptr ? name(file->unit()).size() : 0;
+        }
+        bench::do_not_optimize(thrashing);
+    });
+
+    auto const & statistics = warm_resolver.statistics();
+    std::cout << "warm resolver: " << statistics.hits << " hits, " << statistics.misses << " misses, "
+        << statistics.evictions << " evictions" << std::endl;
+
+    std::filesystem::remove_all(directory);
+
+    return expected == cold && expected == warm && expected == thrashing ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,134 @@
+///
+/// @file:   symbolizer.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares symbolizing addresses by mapping and indexing the binary for every batch, as a
+///          short-lived process does, against requests to a dwarf::SymbolizerServer with a
+///          resident image
+///
+
+#include "benchmark.hpp"
+#include "dwarf/symbolizer/symbolizer_server.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+
+auto
+main() -> int
+{
+    std::span<char const> const exe(tests_example_program_example_program_exe);
+    auto const directory = std::filesystem::temp_directory_path() / "dwarf_symbolizer_bench";
+    std::filesystem::create_directories(directory);
+    auto const exe_path = directory / "example_program.exe";
+    {
+        std::ofstream file(exe_path, std::ios::binary);
+        file.write(exe.data(), static_cast<std::streamsize>(exe.size()));
+    }
+
+    // addresses spread over the functions of the binary, repeated to a batch of 1024
+    std::vector<uint64_t> pcs;
+    dwarf::IncrementalIndex const index(dwarf::get_debug_sections(exe));
+    for(size_t i = 0; pcs.size() < 1024; ++i) {
+        size_t const size = pcs.size();
+        for(auto const & unit : index.units()) {
+            for(auto const & range : unit.fragment->ranges) {
+                if(pcs.size() < 1024) {
+                    pcs.push_back(range.low_pc + i % (range.high_pc - range.low_pc));
+                }
+            }
+        }
+        if(pcs.size() == size) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    size_t expected = 0;
+    bench::measure("map and index per batch", pcs.size(), [&]() {
+        dwarf::Symbolizer symbolizer;
+        auto const image = symbolizer.image(exe_path);
+        expected = 0;
+        for(auto const pc : pcs) {
+            expected += image->symbolize(pc).function.size();
+        }
+        bench::do_not_optimize(expected);
+    });
+
+    // the fallback without debug information, the COFF symbol table
+    size_t const symbols = pei::SymbolIndex(exe).size();
+    bench::measure("COFF symbol index, build", symbols, [&]() {
+        pei::SymbolIndex const symbol_index(exe);
+        bench::do_not_optimize(symbol_index);
+    });
+
+    pei::SymbolIndex const symbol_index(exe);
+    bench::measure("COFF symbol index, find", pcs.size(), [&]() {
+        size_t found = 0;
+        for(auto const pc : pcs) {
+            auto const * const symbol = symbol_index.find(pc);
+            found += symbol != nullptr ? symbol->name.size() : 0;
+        }
+        bench::do_not_optimize(found);
+    });
+
+    dwarf::SymbolizerServer server(directory / "symbolizer.sock");
+    std::thread thread([&]() { server.run(); });
+
+    size_t batch = 0;
+    {
+        dwarf::SymbolizerClient client(server.socket_path());
+        bench::measure("service, batch of 1024", pcs.size(), [&]() {
+            auto const response = client.symbolize(exe_path.string(), pcs);
+            batch = 0;
+            for(auto const & result : response.results) {
+                batch += result.function.size();
+            }
+            bench::do_not_optimize(batch);
+        });
+
+        size_t const requests = 256;
+        bench::measure("service, one address per request", requests, [&]() {
+            for(size_t i = 0; i < requests; ++i) {
+                auto const response = client.symbolize(exe_path.string(), std::span(pcs).subspan(i, 1));
+                bench::do_not_optimize(response);
+            }
+        });
+    }
+
+    size_t connected = 0;
+    bench::measure("service, connect and batch of 1024", pcs.size(), [&]() {
+        dwarf::SymbolizerClient client(server.socket_path());
+        auto const response = client.symbolize(exe_path.string(), pcs);
+        connected = 0;
+        for(auto const & result : response.results) {
+            connected += result.function.size();
+        }
+        bench::do_not_optimize(connected);
+    });
+
+    server.stop();
+    thread.join();
+    std::filesystem::remove_all(directory);
+
+    auto const & statistics = server.symbolizer().statistics();
+    std::cout << "service: " << statistics.hits << " hits, " << statistics.misses << " misses" << std::endl;
+
+    return expected > 0 && expected == batch && expected == connected ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else
+
+auto
+main() -> int
+{
+    std::cout << "Unix domain sockets are not supported on this platform" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+#endif
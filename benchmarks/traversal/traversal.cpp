@@ -0,0 +1,130 @@
+///
+/// @file:   traversal.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares walking the entries with the coroutine generators against hand-written
+///          dwarf::DieCursor loops, the difference is the cost of a coroutine resumption per entry
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_info/traversal.hpp"
+#include "dwarf/debug_line/line_program.hpp"
+#include "tests_example_program_example_program_exe.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <ranges>
+
+namespace
+{
+    auto
+    is_member(dwarf::DIE const & die) -> bool
+    {
+        return die.tag() == dwarf::Tag::dw_tag_member;
+    }
+
+    ///
+    /// @brief Returns true if the entry is a subprogram with the name
+    ///
+    auto
+    is_named_subprogram(dwarf::DIE const & die, std::string_view const name) -> bool
+    {
+        if(die.tag() != dwarf::Tag::dw_tag_subprogram) {
+            return false;
+        }
+        auto const value = die.attribute(dwarf::Attribute::dw_at_name);
+        return value.is_valid() && value.as_string() == name;
+    }
+}
+
+auto
+main() -> int
+{
+    std::span<char const> const data(tests_example_program_example_program_exe);
+    dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+
+    size_t entries = 0;
+    for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+        dwarf::Unit const unit(sections, unit_header);
+        for(dwarf::DieCursor cursor(unit); cursor.next();) {
+            ++entries;
+        }
+    }
+    std::cout << "entries: " << entries << std::endl;
+
+    size_t const repetitions = 100;
+    size_t expected = 0;
+    size_t actual = 0;
+
+    bench::measure("count members, cursor loop", entries * repetitions, [&]() {
+        expected = 0;
+        for(size_t r = 0; r < repetitions; ++r) {
+            for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                dwarf::Unit const unit(sections, unit_header);
+                for(dwarf::DieCursor cursor(unit); cursor.next();) {
+                    expected += is_member(cursor.die()) ? 1 : 0;
+                }
+            }
+        }
+        bench::do_not_optimize(expected);
+    });
+
+    bench::measure("count members, generator", entries * repetitions, [&]() {
+        actual = 0;
+        for(size_t r = 0; r < repetitions; ++r) {
+            actual += static_cast<size_t>(std::ranges::count_if(dwarf::dies(sections), is_member));
+        }
+        bench::do_not_optimize(actual);
+    });
+
+    // stops at the first match, the remaining units are not decoded
+    size_t expected_offset = 0;
+    size_t actual_offset = 0;
+    bench::measure("find main, cursor loop", repetitions, [&]() {
+        for(size_t r = 0; r < repetitions; ++r) {
+            expected_offset = 0;
+            for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                dwarf::Unit const unit(sections, unit_header);
+                dwarf::DieCursor cursor(unit);
+                while(expected_offset == 0 && cursor.next()) {
+                    expected_offset = is_named_subprogram(cursor.die(), "main") ? cursor.die().offset() : 0;
+                }
+                if(expected_offset != 0) {
+                    break;
+                }
+            }
+        }
+        bench::do_not_optimize(expected_offset);
+    });
+
+    bench::measure("find main, generator", repetitions, [&]() {
+        for(size_t r = 0; r < repetitions; ++r) {
+            auto all = dwarf::dies(sections);
+            auto const it = std::ranges::find_if(all, [](dwarf::DIE const & die) { return is_named_subprogram(die, "main"); });
+            actual_offset = it != all.end() ? it->offset() : 0;
+        }
+        bench::do_not_optimize(actual_offset);
+    });
+
+    size_t rows = 0;
+    for(auto const & unit : dwarf::units(sections)) {
+        rows += static_cast<size_t>(std::ranges::distance(dwarf::line_rows(unit)));
+    }
+    std::cout << "line rows: " << rows << std::endl;
+
+    size_t statements = 0;
+    bench::measure("line rows, generator", rows * repetitions, [&]() {
+        statements = 0;
+        for(size_t r = 0; r < repetitions; ++r) {
+            for(auto const & unit : dwarf::units(sections)) {
+                for(auto const & row : dwarf::line_rows(unit)) {
+                    statements += row.is_stmt ? 1 : 0;
+                }
+            }
+        }
+        bench::do_not_optimize(statements);
+    });
+
+    return expected == actual && expected_offset == actual_offset && expected_offset != 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,95 @@
+///
+/// @file:   type_signature.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares resolving DW_FORM_ref_sig8 references by scanning the units against a
+///          dwarf::TypeSignatureIndex
+/// @details The example program is not built with -fdebug-types-section, so the layout of such a
+///          build is generated: one type unit per type, followed by a compilation unit referencing
+///          every type by its signature
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_info/die_cursor.hpp"
+#include "dwarf/debug_info/type_signature_index.hpp"
+#include "dwarf_fixture.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+auto
+main() -> int
+{
+    size_t const type_count = 4096;
+
+    std::vector<uint64_t> signatures;
+    for(uint64_t i = 0; i < type_count; ++i) {
+        signatures.push_back((i + 1) * 0xbf58476d1ce4e5b9);
+    }
+
+    auto const data = fixture::make_type_units(signatures);
+    dwarf::DebugSections sections = {};
+    sections.debug_info = data.debug_info;
+    sections.debug_abbrev = data.debug_abbrev;
+
+    // the references of the variables of the compilation unit, the last unit
+    std::vector<dwarf::Unit> units;
+    for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+        units.emplace_back(sections, unit_header);
+    }
+
+    std::vector<uint64_t> references;
+    dwarf::DieCursor cursor(units.back());
+    while(cursor.next()) {
+        auto const value = cursor.die().attribute(dwarf::Attribute::dw_at_type);
+        if(value.is_type_signature()) {
+            references.push_back(value.as_type_signature());
+        }
+    }
+
+    // a sample of the references, the scan visits on average half of the type units
+    std::vector<uint64_t> lookups;
+    for(size_t i = 0; i < references.size(); i += 16) {
+        lookups.push_back(references[i]);
+    }
+
+    uint64_t expected = 0;
+    bench::measure("scan unit headers", lookups.size(), [&]() {
+        expected = 0;
+        for(auto const signature : lookups) {
+            for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                dwarf::Unit const unit(sections, unit_header);
+                if(unit.unit_type() == dwarf::UnitHeaderUnitType::dw_ut_type && unit.type_signature() == signature) {
+                    expected += unit.offset() + unit.type_offset();
+                    break;
+                }
+            }
+        }
+        bench::do_not_optimize(expected);
+    });
+
+    dwarf::TypeSignatureIndex index;
+    bench::measure("build index", units.size(), [&]() {
+        index = dwarf::TypeSignatureIndex(sections);
+        bench::do_not_optimize(index);
+    });
+
+    uint64_t actual = 0;
+    size_t const repetitions = 1000;
+    bench::measure("index", lookups.size() * repetitions, [&]() {
+        for(size_t r = 0; r < repetitions; ++r) {
+            actual = 0;
+            for(auto const signature : lookups) {
+                auto const * const entry = index.find(signature);
+                actual += entry != nullptr ? entry->type_offset : 0;
+            }
+            bench::do_not_optimize(actual);
+        }
+    });
+
+    std::cout << "type units: " << index.size() << ", slots: " << index.capacity()
+        << ", references: " << references.size() << std::endl;
+
+    return expected == actual && index.size() == type_count ? EXIT_SUCCESS : EXIT_FAILURE;
+}
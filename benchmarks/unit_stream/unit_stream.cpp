@@ -0,0 +1,108 @@
+///
+/// @file:   unit_stream.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares reading the units of a .debug_info section arriving through a pipe with
+///          dwarf::UnitStream against reading them from a complete section in memory
+/// @details A generated .debug_info section with many small units is used, the first entry of
+///          every unit is read
+///
+
+#include "benchmark.hpp"
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/die_cursor.hpp"
+#include "dwarf/debug_info/unit_stream.hpp"
+#include "dwarf_fixture.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+
+namespace
+{
+    auto
+    first_tag(dwarf::Unit const & unit) -> size_t
+    {
+        return static_cast<size_t>(dwarf::DIE(unit, unit.first_die_offset()).tag());
+    }
+}
+
+auto
+main() -> int
+{
+    std::vector<uint64_t> signatures;
+    for(uint64_t i = 0; i < 200000; ++i) {
+        signatures.push_back((i + 1) * 0x9e3779b97f4a7c15);
+    }
+    auto const data = fixture::make_type_units(signatures);
+
+    dwarf::DebugSections sections = {};
+    sections.debug_info = data.debug_info;
+    sections.debug_abbrev = data.debug_abbrev;
+
+    size_t units = 0;
+    for([[maybe_unused]] dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+        ++units;
+    }
+
+    size_t expected = 0;
+    bench::measure("section in memory", units, [&]() {
+        expected = 0;
+        for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+            expected += first_tag(dwarf::Unit(sections, unit_header));
+        }
+        bench::do_not_optimize(expected);
+    });
+
+    size_t actual = 0;
+    size_t buffer_size = 0;
+    bench::measure("pipe", units, [&]() {
+        int fds[2] = {};
+        if(::pipe(fds) != 0) {
+            return;
+        }
+
+        // the writer stands in for the process producing the binary
+        std::thread writer([&]() {
+            size_t index = 0;
+            while(index < sections.debug_info.size()) {
+                auto const count = ::write(fds[1], sections.debug_info.data() + index, sections.debug_info.size() - index);
+                if(count <= 0) {
+                    break;
+                }
+                index += static_cast<size_t>(count);
+            }
+            ::close(fds[1]);
+        });
+
+        dwarf::UnitStream stream(dwarf::FileDescriptorSource(fds[0]), sections);
+        actual = 0;
+        while(auto const streamed_unit = stream.next()) {
+            actual += first_tag(stream.unit(*streamed_unit));
+        }
+        buffer_size = stream.buffer_size();
+        bench::do_not_optimize(actual);
+
+        writer.join();
+        ::close(fds[0]);
+    });
+
+    std::cout << "units: " << units << ", .debug_info: " << sections.debug_info.size() / 1024
+        << " KiB, stream buffer: " << buffer_size / 1024 << " KiB" << std::endl;
+
+    return expected == actual ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else
+
+auto
+main() -> int
+{
+    std::cout << "pipes are not measured on this platform" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,37 @@
+#
+# @file:   bench_add.cmake
+# @author: GrandChris
+# @date:   2026-10-19
+# @brief:  Adds a benchmark
+#
+
+# Add Benchmark
+#
+# Adds a benchmark given a name. Benchmarks are compiled with optimizations
+# for the host processor and are not run as tests. Run them with the
+# target benchmark_<dir>_<name>.
+#
+# NAME: The name of the benchmark to add
+#
+macro(bench_add NAME)
+
+    file(RELATIVE_PATH REL_NAME ${CMAKE_SOURCE_DIR} ${CMAKE_CURRENT_LIST_DIR})
+    file(TO_CMAKE_PATH "${REL_NAME}" REL_NAME_UNMODIFIED)
+    string(REPLACE "/" "_" REL_NAME ${REL_NAME_UNMODIFIED})
+    string(REPLACE " " "_" REL_NAME ${REL_NAME})
+
+    add_executable(${REL_NAME}_${NAME} ${CMAKE_CURRENT_SOURCE_DIR}/${NAME}.cpp)
+
+    target_include_directories(${REL_NAME}_${NAME} PRIVATE ${CMAKE_SOURCE_DIR}/benchmarks)
+
+    target_link_libraries(${REL_NAME}_${NAME} PRIVATE dwarf_reader)
+
+    target_compile_options(${REL_NAME}_${NAME} PRIVATE -O2 ${BENCH_ARCH_FLAGS})
+
+    add_custom_target(
+        benchmark_${REL_NAME}_${NAME}
+        COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_BINARY_DIR}/${REL_NAME_UNMODIFIED} ./${REL_NAME}_${NAME}
+        DEPENDS ${REL_NAME}_${NAME}
+    )
+
+endmacro(bench_add)
@@ -0,0 +1,23 @@
+#
+# @file:   tool_add.cmake
+# @author: GrandChris
+# @date:   2026-10-19
+# @brief:  Adds a command line tool
+#
+
+# Add Tool
+#
+# Adds a command line tool given a name. Tools are compiled with
+# optimizations and named after their source file.
+#
+# NAME: The name of the tool to add
+#
+macro(tool_add NAME)
+
+    add_executable(${NAME} ${CMAKE_CURRENT_SOURCE_DIR}/${NAME}.cpp)
+
+    target_link_libraries(${NAME} PRIVATE dwarf_reader)
+
+    target_compile_options(${NAME} PRIVATE -O2)
+
+endmacro(tool_add)
@@ -11,6 +11,7 @@
 #include <stdexcept>
 #include <cstdint>
 #include <bit>
+#include <algorithm>
 
 namespace details
 {
@@ -27,7 +28,7 @@ namespace details
     [[nodiscard]] constexpr auto 
     bit_cast(std::span<char const> data, size_t const index) -> T
     {
-        if(!(index + sizeof(T) < data.size())) {
+        if(index + sizeof(T) > data.size()) {
             throw std::range_error("bit_cast: index out of bounds");
             return T();
         }
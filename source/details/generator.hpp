@@ -0,0 +1,211 @@
+//
+// @file:   generator.hpp
+// @author: GrandChris
+// @date:   2026-10-19
+// @brief:  A coroutine yielding a sequence of values on demand
+//
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace details
+{
+    ///
+    /// @brief A lazy input range of the values yielded by a coroutine, like std::generator of C++23
+    /// @details The coroutine runs until the next co_yield when the iterator is incremented, so a
+    ///     consumer that stops early never computes the remaining values. A yielded value is
+    ///     referenced, not copied, and stays valid until the iterator is incremented. The range can
+    ///     be iterated once and composed with the range algorithms and views.
+    ///
+    /// @tparam T the type of the yielded values
+    ///
+    template<typename T>
+    class Generator final : public std::ranges::view_interface<Generator<T>>
+    {
+    public:
+        class promise_type final
+        {
+        public:
+            [[nodiscard]] auto
+            get_return_object() noexcept -> Generator
+            {
+                return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            [[nodiscard]] auto
+            initial_suspend() const noexcept -> std::suspend_always
+            {
+                return {};
+            }
+
+            [[nodiscard]] auto
+            final_suspend() const noexcept -> std::suspend_always
+            {
+                return {};
+            }
+
+            ///
+            /// @brief Stores the address of the value, a temporary lives until the coroutine is resumed
+            ///
+            auto
+            yield_value(T const & value) noexcept -> std::suspend_always
+            {
+                value_ = &value;
+                return {};
+            }
+
+            auto
+            return_void() const noexcept -> void {}
+
+            auto
+            unhandled_exception() noexcept -> void
+            {
+                exception_ = std::current_exception();
+            }
+
+            ///
+            /// @brief Makes co_await unusable in a generator
+            ///
+            template<typename U>
+            auto
+            await_transform(U &&) -> std::suspend_never = delete;
+
+            [[nodiscard]] auto
+            value() const noexcept -> T const &
+            {
+                return *value_;
+            }
+
+            ///
+            /// @brief Rethrows an exception of the coroutine in the consumer
+            ///
+            auto
+            rethrow_if_exception() const -> void
+            {
+                if(exception_) {
+                    std::rethrow_exception(exception_);
+                }
+            }
+
+        private:
+            T const * value_ = nullptr;
+            std::exception_ptr exception_ = {};
+        };
+
+        class Iterator final
+        {
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() noexcept = default;
+
+            explicit Iterator(std::coroutine_handle<promise_type> const handle) noexcept
+                : handle_(handle) {}
+
+            ///
+            /// @brief Resumes the coroutine until it yields the next value or returns
+            ///
+            auto
+            operator++() -> Iterator &
+            {
+                handle_.resume();
+                handle_.promise().rethrow_if_exception();
+                return *this;
+            }
+
+            auto
+            operator++(int) -> void
+            {
+                ++*this;
+            }
+
+            [[nodiscard]] auto
+            operator*() const noexcept -> T const &
+            {
+                return handle_.promise().value();
+            }
+
+            [[nodiscard]] auto
+            operator->() const noexcept -> T const *
+            {
+                return &handle_.promise().value();
+            }
+
+            [[nodiscard]] friend auto
+            operator==(Iterator const & it, std::default_sentinel_t) noexcept -> bool
+            {
+                return !it.handle_ || it.handle_.done();
+            }
+
+        private:
+            std::coroutine_handle<promise_type> handle_ = {};
+        };
+
+        ///
+        /// @brief Creates an empty range
+        ///
+        Generator() noexcept = default;
+
+        Generator(Generator && other) noexcept
+            : handle_(std::exchange(other.handle_, {})) {}
+
+        auto
+        operator=(Generator && other) noexcept -> Generator &
+        {
+            if(this != &other) {
+                destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        Generator(Generator const &) = delete;
+        auto operator=(Generator const &) -> Generator & = delete;
+
+        ~Generator()
+        {
+            destroy();
+        }
+
+        ///
+        /// @brief Runs the coroutine until it yields the first value
+        /// @note May be called once
+        ///
+        [[nodiscard]] auto
+        begin() -> Iterator
+        {
+            Iterator res(handle_);
+            if(handle_) {
+                ++res;
+            }
+            return res;
+        }
+
+        [[nodiscard]] auto
+        end() const noexcept -> std::default_sentinel_t
+        {
+            return std::default_sentinel;
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle_ = {};
+
+        explicit Generator(std::coroutine_handle<promise_type> const handle) noexcept
+            : handle_(handle) {}
+
+        auto
+        destroy() noexcept -> void
+        {
+            if(handle_) {
+                handle_.destroy();
+            }
+        }
+    };
+}
@@ -1,21 +1,44 @@
 ///
-/// @file:   debug_info.hpp
+/// @file:   debug_abbrev.hpp
 /// @author: GrandChris
 /// @date:   2022-01-01
-/// @brief:  The ./debug_info section
+/// @brief:  A single abbreviation declaration of the ./debug_abbrev section
 ///
 
 #pragma once
 
-// #include "dwarf/debug_info/unit_header/unit_header.hpp"
 #include "dwarf/dwarf_tags.hpp"
-#include "details/iterator.hpp"
+#include "dwarf/debug_info/form.hpp"
 #include <span>
+#include <vector>
 
 
 namespace dwarf
 {
-    /// @class dwarf::DIE
+    /// @brief The offset of an attribute value which follows a value of variable size
+    constexpr size_t unknown_attribute_offset = std::numeric_limits<size_t>::max();
+
+    /// @class dwarf::AttributeSpecification
+    ///
+    /// @brief An attribute specification of an abbreviation declaration
+    /// @details Each attribute specification consists of two parts. The first part is an unsigned
+    ///     LEB128 number representing the attribute’s name. The second part is an unsigned
+    ///     LEB128 number representing the attribute’s form.
+    ///
+    struct AttributeSpecification final
+    {
+        /// @brief The name of the attribute
+        Attribute attribute = {};
+        /// @brief The form of the attribute
+        Form form = {};
+        /// @brief The value of an attribute with the form DW_FORM_implicit_const
+        int64_t implicit_const = 0;
+        /// @brief The offset of the value relative to the first attribute value of an entry,
+        ///     unknown_attribute_offset if a preceding value has a variable size
+        size_t offset = unknown_attribute_offset;
+    };
+
+    /// @class dwarf::DebugAbbrev
     ///
     /// @brief Debug Abbrev
     /// @details The abbreviations tables for all compilation units are contained in a separate
@@ -31,62 +54,101 @@ namespace dwarf
     {
     public:
 
-    constexpr DebugAbbrev() noexcept = default;
-    
-    /// 
-    /// @brief constructor
-    /// @param debug_abbrev the .debug_abbrev section of the .exe file
-    ///
-    constexpr DebugAbbrev(std::span<char const> const debug_abbrev, size_t const index) noexcept 
-        : data_(debug_abbrev), index_(index) {} 
+        constexpr DebugAbbrev() noexcept = default;
 
+        ///
+        /// @brief constructor
+        /// @param code the abbreviation code
+        /// @param tag the tag of the debugging information entries using this abbreviation
+        /// @param children determines if the entries using this abbreviation have child entries
+        ///
+        constexpr DebugAbbrev(uint32_t const code, Tag const tag, ChildrenDetermination const children) noexcept
+            : code_(code), tag_(tag), children_(children) {}
 
         [[nodiscard]] constexpr auto
-        tag() const noexcept -> Tag 
+        code() const noexcept -> uint32_t
         {
-            return Tag();
+            return code_;
         }
 
         [[nodiscard]] constexpr auto
-        attributes() const noexcept -> Tag 
+        tag() const noexcept -> Tag
         {
-            return Tag();
+            return tag_;
         }
 
+        [[nodiscard]] constexpr auto
+        has_children() const noexcept -> bool
+        {
+            return children_ == ChildrenDetermination::dw_children_yes;
+        }
 
         [[nodiscard]] constexpr auto
-        next() const noexcept -> DebugAbbrev 
+        attributes() const noexcept -> std::span<AttributeSpecification const>
+        {
+            return attributes_;
+        }
+
+        constexpr auto
+        add_attribute(AttributeSpecification const & specification) -> void
         {
-            return DebugAbbrev();
+            attributes_.push_back(specification);
         }
 
+        ///
+        /// @brief Computes the offsets of the attribute values up to the first value with a variable size
+        /// @param encoding the properties of the unit using the abbreviation
+        ///
+        constexpr auto
+        set_attribute_offsets(FormEncoding const & encoding) -> void
+        {
+            size_t offset = 0;
+            first_variable_attribute_ = attributes_.size();
+
+            for(size_t i = 0; i < attributes_.size(); ++i) {
+                attributes_[i].offset = offset;
+
+                size_t const size = form_size(attributes_[i].form, encoding);
+                if(size == variable_form_size) {
+                    first_variable_attribute_ = i;
+                    for(size_t j = i + 1; j < attributes_.size(); ++j) {
+                        attributes_[j].offset = unknown_attribute_offset;
+                    }
+                    return;
+                }
+
+                offset += size;
+            }
+
+            fixed_size_ = offset;
+        }
 
-        /// 
-        /// @brief Returns the address of the start of the UnitHeader
+        ///
+        /// @brief Returns the index of the first attribute whose value has a variable size
+        /// @return the number of attributes if all values have a fixed size
         ///
         [[nodiscard]] constexpr auto
-        base_index() const noexcept -> uint32_t 
-        {   
-            return index_;
+        first_variable_attribute() const noexcept -> size_t
+        {
+            return first_variable_attribute_;
         }
 
-        // /// 
-        // /// @brief Returns the size of the unit header
-        // ///
-        // [[nodiscard]] constexpr auto
-        // size() const noexcept -> uint32_t 
-        // {   
-        //     if(is64bit()){
-        //         return decltype(DataStructure64::unit_type)::end;
-        //     }
-        //     else {
-        //         return decltype(DataStructure32::unit_type)::end;
-        //     }
-        // }
+        ///
+        /// @brief Returns the size of all attribute values of an entry
+        /// @return variable_form_size if a value has a variable size
+        ///
+        [[nodiscard]] constexpr auto
+        fixed_size() const noexcept -> size_t
+        {
+            return fixed_size_;
+        }
 
     private:
-        /// @brief the binary data of the .debug_line section
-        std::span<char const> const data_;
-        size_t const index_ = 0;
+        uint32_t code_ = 0;
+        Tag tag_ = {};
+        ChildrenDetermination children_ = {};
+        std::vector<AttributeSpecification> attributes_ = {};
+        size_t first_variable_attribute_ = 0;
+        size_t fixed_size_ = variable_form_size;
     };
 }
@@ -1,20 +1,22 @@
 ///
-/// @file:   debug_info.hpp
+/// @file:   debug_abbrev_table.hpp
 /// @author: GrandChris
 /// @date:   2022-01-01
-/// @brief:  The ./debug_info section
+/// @brief:  The abbreviations table of a single unit
 ///
 
 #pragma once
 
-// #include "dwarf/debug_info/unit_header/unit_header.hpp"
-#include "details/iterator.hpp"
+#include "dwarf/debug_abbrev/debug_abbrev.hpp"
+#include "dwarf/debug_abbrev/dubug_abbrev_parser.hpp"
+#include "dwarf/reader_statistics.hpp"
 #include <span>
+#include <vector>
 
 
 namespace dwarf
 {
-    /// @class dwarf::DIE
+    /// @class dwarf::DebugAbbrevTable
     ///
     /// @brief Debug Abbrev Table
     /// @details The abbreviations tables for all compilation units are contained in a separate
@@ -29,34 +31,110 @@ namespace dwarf
     class DebugAbbrevTable final
     {
     public:
-    /// 
-    /// @brief constructor
-    /// @param debug_abbrev the .debug_abbrev section of the .exe file
-    ///
-    constexpr DebugAbbrevTable(std::span<char const> const debug_abbrev) noexcept 
-        : data_(debug_abbrev) {} 
+        constexpr DebugAbbrevTable() noexcept = default;
 
+        ///
+        /// @brief constructor
+        /// @param debug_abbrev the .debug_abbrev section of the .exe file
+        /// @param offset the offset of the table in the .debug_abbrev section
+        ///
+        constexpr DebugAbbrevTable(std::span<char const> const debug_abbrev, size_t const offset)
+        {
+            DebugAbbrevParser parser(debug_abbrev, offset);
+            Tag tag = {};
+            Attribute attribute = {};
 
-    [[nodiscard]] constexpr auto
-    begin() const noexcept -> details::Iterator<UnitHeader>
-    {
-        return details::Iterator<UnitHeader>(UnitHeader(data_));
-    }
+            while(parser.next()) {
+                if(parser.is_end_of_table()) {
+                    break;
+                }
+                else if(parser.is_tag()) {
+                    tag = parser.get_tag();
+                }
+                else if(parser.is_children()) {
+                    abbrevs_.push_back(DebugAbbrev(parser.get_abbreviation_code(), tag, parser.get_children()));
+                }
+                else if(parser.is_attribute()) {
+                    attribute = parser.get_attribute();
+                }
+                else if(parser.is_form() && !parser.is_end_of_attributes()) {
+                    abbrevs_.back().add_attribute({attribute, parser.get_form(), parser.get_implicit_const()});
+                }
+            }
 
-    [[nodiscard]] constexpr auto
-    end() const noexcept -> details::Iterator<UnitHeader>
-    {
-        return details::Iterator<UnitHeader>(UnitHeader());
-    }
+            count(ReaderCounter::abbrev_tables);
+            count(ReaderCounter::abbrev_bytes, parser.get_index() - offset);
+
+            // abbreviation codes are usually assigned consecutively starting with 1
+            for(size_t i = 0; i < abbrevs_.size(); ++i) {
+                if(abbrevs_[i].code() != i + 1) {
+                    is_consecutive_ = false;
+                    break;
+                }
+            }
+        }
+
+        ///
+        /// @brief Computes the offsets of the attribute values of all abbreviation declarations
+        /// @param encoding the properties of the unit using the table
+        ///
+        constexpr auto
+        set_attribute_offsets(FormEncoding const & encoding) -> void
+        {
+            for(auto & abbrev : abbrevs_) {
+                abbrev.set_attribute_offsets(encoding);
+            }
+        }
+
+        ///
+        /// @brief Returns the abbreviation declaration with the given code
+        /// @param code the abbreviation code
+        /// @return the abbreviation declaration or nullptr if there is no such declaration
+        ///
+        [[nodiscard]] constexpr auto
+        find(uint32_t const code) const noexcept -> DebugAbbrev const *
+        {
+            if(is_consecutive_) {
+                if(code == 0 || code > abbrevs_.size()) {
+                    return nullptr;
+                }
+
+                count(ReaderCounter::abbrev_hits);
+                return &abbrevs_[code - 1];
+            }
+
+            count(ReaderCounter::abbrev_misses);
+            for(auto const & abbrev : abbrevs_) {
+                if(abbrev.code() == code) {
+                    return &abbrev;
+                }
+            }
+
+            return nullptr;
+        }
+
+        [[nodiscard]] constexpr auto
+        begin() const noexcept
+        {
+            return abbrevs_.begin();
+        }
+
+        [[nodiscard]] constexpr auto
+        end() const noexcept
+        {
+            return abbrevs_.end();
+        }
 
-    [[nodiscard]] constexpr auto
-    size() const noexcept -> size_t 
-    {   
-        return data_.size();
-    }
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_t
+        {
+            return abbrevs_.size();
+        }
 
     private:
-        /// @brief the binary data of the .debug_line section
-        std::span<char const> const data_;
+        /// @brief the decoded abbreviation declarations
+        std::vector<DebugAbbrev> abbrevs_ = {};
+        /// @brief true if the abbreviation codes are 1, 2, 3, ...
+        bool is_consecutive_ = true;
     };
 }
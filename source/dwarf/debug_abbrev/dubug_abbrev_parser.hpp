@@ -38,19 +38,19 @@ namespace dwarf
 
 
         [[nodiscard]] constexpr auto
-        is_abbreviation_code() const noexcept -> bool { return state_ == &state_abbreviation_code; }
+        is_abbreviation_code() const noexcept -> bool { return state_ == State::abbreviation_code; }
 
         [[nodiscard]] constexpr auto
-        is_tag() const noexcept -> bool { return state_ == &state_tag; }
+        is_tag() const noexcept -> bool { return state_ == State::tag; }
 
         [[nodiscard]] constexpr auto
-        is_children() const noexcept -> bool { return state_ == &state_children; }
+        is_children() const noexcept -> bool { return state_ == State::children; }
 
         [[nodiscard]] constexpr auto
-        is_attribute() const noexcept -> bool { return state_ == &state_attribute; }
+        is_attribute() const noexcept -> bool { return state_ == State::attribute; }
 
         [[nodiscard]] constexpr auto
-        is_form() const noexcept -> bool { return state_ == &state_form; }
+        is_form() const noexcept -> bool { return state_ == State::form; }
 
 
         [[nodiscard]] constexpr auto
@@ -68,6 +68,21 @@ namespace dwarf
         [[nodiscard]] constexpr auto
         get_form() const noexcept -> dwarf::Form { return form_; }
 
+        [[nodiscard]] constexpr auto
+        get_implicit_const() const noexcept -> int64_t { return implicit_const_; }
+
+        [[nodiscard]] constexpr auto
+        is_end_of_table() const noexcept -> bool { return is_abbreviation_code() && abbreviation_code_ == 0; }
+
+        [[nodiscard]] constexpr auto
+        is_end_of_attributes() const noexcept -> bool 
+        { 
+            return is_form() && attribute_ == static_cast<dwarf::Attribute>(0) && form_ == static_cast<dwarf::Form>(0); 
+        }
+
+        [[nodiscard]] constexpr auto
+        get_index() const noexcept -> size_t { return index_; }
+
     private:
 
         ///////////////////////////////////////////////////////////////////////////////
@@ -82,17 +97,24 @@ namespace dwarf
         dwarf::Tag tag_ = {};
         dwarf::Attribute attribute_ = {};
         dwarf::Form form_ = {};
+        int64_t implicit_const_ = 0;
 
         ///////////////////////////////////////////////////////////////////////////////
         // State Machine
 
-        using State = auto (DebugAbbrevParser::* )() -> void;
-
-        State state_ = state_initial;
-        State next_state_ = state_abbreviation_code;
+        /// @brief The part of an abbreviation declaration which is read next
+        enum class State : uint8_t
+        {
+            initial,
+            abbreviation_code,
+            tag,
+            children,
+            attribute,
+            form
+        };
 
-        constexpr auto
-        state_initial() -> void;
+        State state_ = State::initial;
+        State next_state_ = State::abbreviation_code;
 
         constexpr auto
         state_abbreviation_code() -> void;
@@ -116,16 +138,35 @@ namespace dwarf
     constexpr auto
     DebugAbbrevParser::next() noexcept -> bool
     {
+        if(index_ >= data_.size()) {
+            return false;
+        }
+
         state_ = next_state_;
-        (this->*state_)();
 
-        return index_ <= data_.size();
-    }
+        switch (state_)
+        {
+        case State::abbreviation_code:
+            state_abbreviation_code();
+            break;
+        case State::tag:
+            state_tag();
+            break;
+        case State::children:
+            state_children();
+            break;
+        case State::attribute:
+            state_attribute();
+            break;
+        case State::form:
+            state_form();
+            break;
+        case State::initial:
+            next_state_ = State::abbreviation_code;
+            break;
+        }
 
-    constexpr auto
-    DebugAbbrevParser::state_initial() -> void
-    {
-        next_state_ = state_abbreviation_code;
+        return true;
     }
 
 
@@ -134,14 +175,21 @@ namespace dwarf
     {
         // Each declaration begins with an unsigned LEB128 number representing the abbreviation code itself.
         using ValType = decltype(abbreviation_code_);
-        auto [val, n] = details::uleb128<ValType>(data_.subspan(index_));
-        if(n == 0 || n > sizeof(ValType)) [[unlikely]] {
+        auto [val, n] = details::uleb128<ValType>(data_, index_);
+        if(n == 0 || n > details::max_leb128_size<ValType>) [[unlikely]] {
             throw std::range_error("parsing of .debug_abbrev abbreviation_code failed: uleb128 wrong format");
         }
         
         abbreviation_code_ = static_cast<ValType>(val);
         index_ += n;    
-        next_state_ = state_tag;
+
+        if(abbreviation_code_ == 0) 
+        {   // the abbreviations for a single compilation unit end with an entry consisting of a 0 byte
+            next_state_ = State::abbreviation_code;
+            return;
+        }
+
+        next_state_ = State::tag;
     }
 
     constexpr auto
@@ -149,14 +197,14 @@ namespace dwarf
     {
         // The abbreviation code is followed by another unsigned LEB128 number that encodes the entry’s tag.
         using ValType = std::underlying_type_t<dwarf::Tag>;
-        auto [val, n] = details::uleb128<ValType>(data_.subspan(index_));
-        if(n == 0 || n > sizeof(ValType)) [[unlikely]] {
+        auto [val, n] = details::uleb128<ValType>(data_, index_);
+        if(n == 0 || n > details::max_leb128_size<ValType>) [[unlikely]] {
             throw std::range_error("parsing of .debug_abbrev tag failed: uleb128 wrong format");
         }
         
         tag_ = static_cast<dwarf::Tag>(val);
         index_ += n;    
-        next_state_ = state_children;
+        next_state_ = State::children;
     }
 
     constexpr auto
@@ -180,7 +228,7 @@ namespace dwarf
         // information entry using this abbreviation is a sibling of that entry. (Either the
         // first child or sibling entries may be null entries)
 
-        next_state_ = state_attribute;
+        next_state_ = State::attribute;
     }
 
     constexpr auto
@@ -193,14 +241,14 @@ namespace dwarf
         // specifications ends with an entry containing 0 for the name and 0 for the form.
 
         using ValType = std::underlying_type_t<dwarf::Attribute>;
-        auto [val, n] = details::uleb128<ValType>(data_.subspan(index_));
-        if(n == 0 || n > sizeof(ValType)) [[unlikely]] {
+        auto [val, n] = details::uleb128<ValType>(data_, index_);
+        if(n == 0 || n > details::max_leb128_size<ValType>) [[unlikely]] {
             throw std::range_error("parsing of .debug_abbrev attribute failed: uleb128 wrong format");
         }
         
         attribute_ = static_cast<dwarf::Attribute>(val);
         index_ += n;    
-        next_state_ = state_form;
+        next_state_ = State::form;
     }
 
 
@@ -214,23 +262,40 @@ namespace dwarf
         // specifications ends with an entry containing 0 for the name and 0 for the form.
 
         using ValType = std::underlying_type_t<dwarf::Form>;
-        auto [val, n] = details::uleb128<ValType>(data_.subspan(index_));
-        if(n == 0 || n > sizeof(ValType)) [[unlikely]] {
+        auto [val, n] = details::uleb128<ValType>(data_, index_);
+        if(n == 0 || n > details::max_leb128_size<ValType>) [[unlikely]] {
             throw std::range_error("parsing of .debug_abbrev attribute failed: uleb128 wrong format");
         }
         
         form_ = static_cast<dwarf::Form>(val);
         index_ += n;    
 
+        if(form_ == dwarf::Form::dw_form_implicit_const) 
+        {   // The attribute form DW_FORM_implicit_const is another special case. For
+            // attributes with this form, the attribute specification contains a third part, which is
+            // a signed LEB128 number. The value of this number is used as the value of the
+            // attribute, and no value is stored in the .debug_info section.
+            auto [const_val, const_n] = details::sleb128<int64_t>(data_, index_);
+            if(const_n == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_abbrev implicit_const failed: sleb128 wrong format");
+            }
+
+            implicit_const_ = const_val;
+            index_ += const_n;
+        }
+        else {
+            implicit_const_ = 0;
+        }
+
         if(attribute_ == static_cast<dwarf::Attribute>(0) && form_ == static_cast<dwarf::Form>(0)) {
-            next_state_ = state_abbreviation_code;
+            next_state_ = State::abbreviation_code;
         }
         else {
-            next_state_ = state_attribute;
+            next_state_ = State::attribute;
         }
     }
 
-    std::ostream & operator<<(std::ostream & ost, DebugAbbrevParser parser) 
+    inline std::ostream & operator<<(std::ostream & ost, DebugAbbrevParser parser) 
     {
         while(parser.next()) {
             if(parser.is_abbreviation_code()){
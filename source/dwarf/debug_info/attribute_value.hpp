@@ -0,0 +1,225 @@
+///
+/// @file:   attribute_value.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The value of an attribute of a debugging information entry
+///
+
+#pragma once
+
+#include "dwarf/debug_info/unit.hpp"
+#include "dwarf/debug_info/form.hpp"
+
+namespace dwarf
+{
+    /// @class dwarf::AttributeValue
+    ///
+    /// @brief The value of an attribute of a debugging information entry
+    /// @details Interprets the raw value of an attribute in the context of its unit.
+    ///     Strings, addresses and references stored in other sections are resolved on access.
+    ///
+    class AttributeValue final
+    {
+    public:
+        constexpr AttributeValue() noexcept = default;
+
+        ///
+        /// @brief constructor
+        /// @param unit the unit of the debugging information entry
+        /// @param value the raw value of the attribute
+        ///
+        constexpr AttributeValue(Unit const & unit, FormValue const & value) noexcept
+            : unit_(&unit), value_(value) {}
+
+        ///
+        /// @brief Returns false for the value of a missing attribute
+        ///
+        [[nodiscard]] constexpr auto
+        is_valid() const noexcept -> bool
+        {
+            return unit_ != nullptr;
+        }
+
+        [[nodiscard]] constexpr auto
+        form() const noexcept -> Form
+        {
+            return value_.form;
+        }
+
+        [[nodiscard]] constexpr auto
+        raw() const noexcept -> FormValue const &
+        {
+            return value_;
+        }
+
+        [[nodiscard]] constexpr auto
+        as_unsigned() const noexcept -> uint64_t
+        {
+            return value_.value;
+        }
+
+        ///
+        /// @brief Returns the value as signed constant. Fixed size constants are sign extended.
+        ///
+        [[nodiscard]] constexpr auto
+        as_signed() const noexcept -> int64_t
+        {
+            switch (value_.form)
+            {
+            case Form::dw_form_data1: return static_cast<int8_t>(value_.value);
+            case Form::dw_form_data2: return static_cast<int16_t>(value_.value);
+            case Form::dw_form_data4: return static_cast<int32_t>(value_.value);
+            default: return static_cast<int64_t>(value_.value);
+            }
+        }
+
+        [[nodiscard]] constexpr auto
+        as_block() const noexcept -> std::span<char const>
+        {
+            return value_.block;
+        }
+
+        [[nodiscard]] constexpr auto
+        is_string() const noexcept -> bool
+        {
+            switch (value_.form)
+            {
+            case Form::dw_form_string:
+            case Form::dw_form_strp:
+            case Form::dw_form_line_strp:
+            case Form::dw_form_strx:
+            case Form::dw_form_strx1:
+            case Form::dw_form_strx2:
+            case Form::dw_form_strx3:
+            case Form::dw_form_strx4:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        ///
+        /// @brief Returns the value as string. Strings in the string sections are resolved.
+        ///
+        [[nodiscard]] constexpr auto
+        as_string() const -> std::string_view
+        {
+            auto const & sections = unit_->sections();
+
+            switch (value_.form)
+            {
+            case Form::dw_form_string:
+                return std::string_view(value_.block.data(), value_.block.size());
+            case Form::dw_form_strp:
+            {
+                auto const res = read_string(sections.debug_str, value_.value);
+                count(ReaderCounter::str_bytes, res.size() + 1);
+                return res;
+            }
+            case Form::dw_form_line_strp:
+                return read_string(sections.debug_line_str, value_.value);
+            case Form::dw_form_strx:
+            case Form::dw_form_strx1:
+            case Form::dw_form_strx2:
+            case Form::dw_form_strx3:
+            case Form::dw_form_strx4:
+            {
+                size_t const index = unit_->str_offsets_base() + value_.value * unit_->offset_size();
+                if(index + unit_->offset_size() > sections.debug_str_offsets.size()) {
+                    return std::string_view();
+                }
+                auto const offset = read_unsigned(sections.debug_str_offsets, index, unit_->offset_size());
+                auto const res = read_string(sections.debug_str, offset);
+                count(ReaderCounter::str_bytes, res.size() + 1);
+                return res;
+            }
+            default:
+                return std::string_view();
+            }
+        }
+
+        [[nodiscard]] constexpr auto
+        is_reference() const noexcept -> bool
+        {
+            switch (value_.form)
+            {
+            case Form::dw_form_ref1:
+            case Form::dw_form_ref2:
+            case Form::dw_form_ref4:
+            case Form::dw_form_ref8:
+            case Form::dw_form_ref_udata:
+            case Form::dw_form_ref_addr:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        ///
+        /// @brief Returns the referenced debugging information entry as offset in the .debug_info section
+        ///
+        [[nodiscard]] constexpr auto
+        as_reference() const noexcept -> size_t
+        {
+            switch (value_.form)
+            {
+            case Form::dw_form_ref1:
+            case Form::dw_form_ref2:
+            case Form::dw_form_ref4:
+            case Form::dw_form_ref8:
+            case Form::dw_form_ref_udata:
+                return unit_->offset() + value_.value;
+            default:
+                return value_.value;
+            }
+        }
+
+        ///
+        /// @brief Returns true if the value references the type entry of a type unit by its signature
+        ///
+        [[nodiscard]] constexpr auto
+        is_type_signature() const noexcept -> bool
+        {
+            return value_.form == Form::dw_form_ref_sig8;
+        }
+
+        ///
+        /// @brief Returns the signature of the referenced type unit, see dwarf::TypeSignatureIndex
+        ///
+        [[nodiscard]] constexpr auto
+        as_type_signature() const noexcept -> uint64_t
+        {
+            return value_.form == Form::dw_form_ref_sig8 ? value_.value : 0;
+        }
+
+        ///
+        /// @brief Returns the value as address. Indices into the .debug_addr section are resolved.
+        ///
+        [[nodiscard]] constexpr auto
+        as_address() const -> uint64_t
+        {
+            switch (value_.form)
+            {
+            case Form::dw_form_addrx:
+            case Form::dw_form_addrx1:
+            case Form::dw_form_addrx2:
+            case Form::dw_form_addrx3:
+            case Form::dw_form_addrx4:
+            {
+                auto const & debug_addr = unit_->sections().debug_addr;
+                size_t const index = unit_->addr_base() + value_.value * unit_->address_size();
+                if(index + unit_->address_size() > debug_addr.size()) {
+                    return 0;
+                }
+                return read_unsigned(debug_addr, index, unit_->address_size());
+            }
+            default:
+                return value_.value;
+            }
+        }
+
+    private:
+        Unit const * unit_ = nullptr;
+        FormValue value_ = {};
+    };
+}
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include "dwarf/debug_info/unit.hpp"
+#include "dwarf/debug_info/attribute_value.hpp"
+
 namespace dwarf
 {
     /// @class dwarf::DIE
@@ -22,9 +25,169 @@ namespace dwarf
     class DIE final
     {
     public:
+        constexpr DIE() noexcept = default;
+
+        ///
+        /// @brief constructor
+        /// @param unit the unit containing the entry
+        /// @param offset the offset of the entry in the .debug_info section
+        ///
+        constexpr DIE(Unit const & unit, size_t const offset)
+            : unit_(&unit), offset_(offset)
+        {
+            auto const [code, n] = details::uleb128<uint32_t>(unit.sections().debug_info, offset);
+            if(n == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_info entry failed: uleb128 wrong format");
+            }
+
+            attributes_offset_ = offset + n;
+
+            if(code != 0) {
+                abbrev_ = unit.abbrev_table().find(code);
+                if(abbrev_ == nullptr) [[unlikely]] {
+                    throw std::range_error("parsing of .debug_info entry failed: unknown abbreviation code");
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr auto
+        operator==(DIE const & other) const noexcept -> bool
+        {
+            return unit_ == other.unit_ && offset_ == other.offset_;
+        }
+
+        [[nodiscard]] constexpr auto
+        unit() const noexcept -> Unit const &
+        {
+            return *unit_;
+        }
+
+        ///
+        /// @brief Returns the offset of the entry in the .debug_info section
+        ///
+        [[nodiscard]] constexpr auto
+        offset() const noexcept -> size_t
+        {
+            return offset_;
+        }
+
+        ///
+        /// @brief Returns the offset of the first attribute value of the entry
+        ///
+        [[nodiscard]] constexpr auto
+        attributes_offset() const noexcept -> size_t
+        {
+            return attributes_offset_;
+        }
+
+        ///
+        /// @brief Returns the abbreviation declaration of the entry
+        ///
+        [[nodiscard]] constexpr auto
+        abbrev() const noexcept -> DebugAbbrev const *
+        {
+            return abbrev_;
+        }
+
+        ///
+        /// @brief A null entry terminates a list of sibling entries
+        ///
+        [[nodiscard]] constexpr auto
+        is_null() const noexcept -> bool
+        {
+            return abbrev_ == nullptr;
+        }
+
+        [[nodiscard]] constexpr auto
+        tag() const noexcept -> Tag
+        {
+            return is_null() ? Tag() : abbrev_->tag();
+        }
+
+        [[nodiscard]] constexpr auto
+        has_children() const noexcept -> bool
+        {
+            return !is_null() && abbrev_->has_children();
+        }
+
+        ///
+        /// @brief Calls a function for each attribute of the entry
+        /// @param func the function, called with the AttributeSpecification and the AttributeValue
+        /// @return the offset of the next entry in the .debug_info section
+        ///
+        template<typename FUNC_T>
+        constexpr auto
+        for_each_attribute(FUNC_T && func) const -> size_t
+        {
+            size_t index = attributes_offset_;
+            if(is_null()) {
+                return index;
+            }
+
+            for(auto const & specification : abbrev_->attributes()) {
+                auto const value = read_form(unit_->sections().debug_info, index, specification.form, specification.implicit_const, unit_->encoding());
+                func(specification, AttributeValue(*unit_, value));
+            }
+
+            count(ReaderCounter::info_bytes, index - attributes_offset_);
+            return index;
+        }
+
+        ///
+        /// @brief Returns the value of an attribute of the entry
+        /// @details The value is read directly if all preceding values have a fixed size, otherwise
+        ///     the values are scanned starting with the first value of variable size.
+        /// @param attribute the name of the attribute
+        /// @return the value, an invalid value if the entry has no such attribute
+        ///
+        [[nodiscard]] constexpr auto
+        attribute(Attribute const attribute) const -> AttributeValue
+        {
+            if(is_null()) {
+                return AttributeValue();
+            }
+
+            auto const specifications = abbrev_->attributes();
+            for(size_t i = 0; i < specifications.size(); ++i) {
+                if(specifications[i].attribute != attribute) {
+                    continue;
+                }
+
+                size_t first = i;
+                if(specifications[i].offset == unknown_attribute_offset) {
+                    first = abbrev_->first_variable_attribute();
+                }
+
+                auto const & data = unit_->sections().debug_info;
+                size_t index = attributes_offset_ + specifications[first].offset;
+                for(size_t j = first; j < i; ++j) {
+                    static_cast<void>(read_form(data, index, specifications[j].form, specifications[j].implicit_const, unit_->encoding()));
+                }
+
+                auto const & specification = specifications[i];
+                return AttributeValue(*unit_, read_form(data, index, specification.form, specification.implicit_const, unit_->encoding()));
+            }
+
+            return AttributeValue();
+        }
+
+        ///
+        /// @brief Returns the offset of the next entry in the .debug_info section
+        ///
+        [[nodiscard]] constexpr auto
+        end_offset() const -> size_t
+        {
+            if(!is_null() && abbrev_->fixed_size() != variable_form_size) {
+                return attributes_offset_ + abbrev_->fixed_size();
+            }
+
+            return for_each_attribute([](AttributeSpecification const &, AttributeValue const &) {});
+        }
 
     private:
+        Unit const * unit_ = nullptr;
+        DebugAbbrev const * abbrev_ = nullptr;
+        size_t offset_ = 0;
+        size_t attributes_offset_ = 0;
     };
 }
-
-
@@ -0,0 +1,143 @@
+///
+/// @file:   die_cursor.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Walks the debugging information entries of a unit
+///
+
+#pragma once
+
+#include "dwarf/debug_info/die.hpp"
+
+namespace dwarf
+{
+    /// @class dwarf::DieCursor
+    ///
+    /// @brief Walks the debugging information entries of a unit in the order they are stored
+    /// @details The entries are stored as a prefix traversal of the tree. The cursor skips the
+    ///     null entries and keeps track of the depth of the current entry in the tree.
+    ///     The attributes of an entry are decoded at most once, if they are read
+    ///     with read_attributes() before the cursor is advanced.
+    ///
+    class DieCursor final
+    {
+    public:
+
+        ///
+        /// @brief constructor
+        /// @param unit the unit to walk
+        ///
+        explicit constexpr DieCursor(Unit const & unit) noexcept
+            : unit_(&unit), next_offset_(unit.first_die_offset()) {}
+
+        ///
+        /// @brief Advances to the next entry
+        /// @return false if there are no more entries in the unit
+        ///
+        constexpr auto
+        next() -> bool
+        {
+            if(!next_offset_valid_) {
+                next_offset_ = die_.end_offset();
+            }
+
+            while(next_offset_ < unit_->end_offset()) {
+                DIE const die(*unit_, next_offset_);
+
+                if(die.is_null()) {
+                    next_offset_ = die.attributes_offset();
+                    if(next_depth_ > 0) {
+                        --next_depth_;
+                    }
+                    continue;
+                }
+
+                count(ReaderCounter::entries_visited);
+                die_ = die;
+                depth_ = next_depth_;
+                next_depth_ = die.has_children() ? depth_ + 1 : depth_;
+                next_offset_valid_ = false;
+                return true;
+            }
+
+            next_offset_valid_ = true;
+            return false;
+        }
+
+        ///
+        /// @brief Calls a function for each attribute of the current entry
+        /// @param func the function, called with the AttributeSpecification and the AttributeValue
+        ///
+        template<typename FUNC_T>
+        constexpr auto
+        read_attributes(FUNC_T && func) -> void
+        {
+            next_offset_ = die_.for_each_attribute(func);
+            next_offset_valid_ = true;
+        }
+
+        ///
+        /// @brief Skips the children of the current entry, the next entry is its sibling
+        ///
+        constexpr auto
+        skip_children() -> void
+        {
+            if(!die_.has_children()) {
+                return;
+            }
+
+            size_t offset = next_offset_valid_ ? next_offset_ : die_.end_offset();
+            size_t level = 1;
+            size_t skipped = 0;
+
+            while(level > 0 && offset < unit_->end_offset()) {
+                DIE const die(*unit_, offset);
+
+                if(die.is_null()) {
+                    offset = die.attributes_offset();
+                    --level;
+                }
+                else {
+                    offset = die.end_offset();
+                    level += die.has_children() ? 1 : 0;
+                    ++skipped;
+                }
+            }
+
+            count(ReaderCounter::entries_skipped, skipped);
+
+            next_offset_ = offset;
+            next_offset_valid_ = true;
+            next_depth_ = depth_;
+        }
+
+        [[nodiscard]] constexpr auto
+        die() const noexcept -> DIE const &
+        {
+            return die_;
+        }
+
+        ///
+        /// @brief Returns the depth of the current entry, the unit entry has the depth 0
+        ///
+        [[nodiscard]] constexpr auto
+        depth() const noexcept -> size_t
+        {
+            return depth_;
+        }
+
+        [[nodiscard]] constexpr auto
+        unit() const noexcept -> Unit const &
+        {
+            return *unit_;
+        }
+
+    private:
+        Unit const * unit_ = nullptr;
+        DIE die_ = {};
+        size_t depth_ = 0;
+        size_t next_depth_ = 0;
+        size_t next_offset_ = 0;
+        bool next_offset_valid_ = true;
+    };
+}
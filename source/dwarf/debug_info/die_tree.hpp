@@ -0,0 +1,299 @@
+///
+/// @file:   die_tree.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  A compact in-memory tree of all debugging information entries
+///
+
+#pragma once
+
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/die_cursor.hpp"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace dwarf
+{
+    /// @brief The index of an entry in a dwarf::BasicDieTree
+    using DieIndex = uint32_t;
+
+    /// @brief Marks a missing parent, child or sibling
+    constexpr DieIndex invalid_die_index = std::numeric_limits<DieIndex>::max();
+
+    /// @brief The index of an abbreviation in a dwarf::BasicDieTree
+    using DieAbbrevIndex = uint16_t;
+
+    /// @class dwarf::DieAbbrev
+    ///
+    /// @brief The abbreviation code and the tag shared by the entries of a dwarf::BasicDieTree
+    ///
+    struct DieAbbrev final
+    {
+        uint32_t code = 0;
+        Tag tag = {};
+    };
+
+    /// @class dwarf::BasicDieTree
+    ///
+    /// @brief The tree of all debugging information entries of a binary file
+    /// @details The entries are stored as parallel arrays in the order of the .debug_info section,
+    ///     so the first child of an entry is the next entry and a subtree is a contiguous range.
+    ///     Only the structure of the tree is stored, the attribute values are decoded from the
+    ///     binary file on demand with die(). The roots of the tree are the unit entries.
+    ///     The abbreviation code and the tag of an entry are stored once per distinct pair in a
+    ///     table shared by all units, an entry holds its 16-bit index into the table.
+    ///     The navigation functions expect an index less than size().
+    /// @tparam ALLOCATOR_T the allocator of the arrays, rebound to the element types
+    ///
+    template<typename ALLOCATOR_T = std::allocator<std::byte>>
+    class BasicDieTree final
+    {
+        template<typename T>
+        using Vector = std::vector<T, typename std::allocator_traits<ALLOCATOR_T>::template rebind_alloc<T>>;
+
+    public:
+        constexpr BasicDieTree() = default;
+
+        ///
+        /// @brief Builds the tree of all units of the binary file
+        /// @param sections the debug sections of the binary file
+        /// @param allocator the allocator of the arrays
+        ///
+        constexpr explicit BasicDieTree(DebugSections const & sections, ALLOCATOR_T const & allocator = {})
+            : units_(allocator), unit_first_dies_(allocator), abbrevs_(allocator), abbrev_indices_(allocator),
+              parents_(allocator), next_siblings_(allocator), unit_offsets_(allocator)
+        {
+            for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+                units_.emplace_back(sections, unit_header);
+            }
+
+            Vector<DieIndex> parents(allocator);
+            Vector<DieIndex> last_children(allocator);
+            // the pairs of code and tag of the table, sorted to find the index of a pair
+            Vector<std::pair<uint64_t, DieAbbrevIndex>> abbrev_keys(allocator);
+
+            for(auto const & unit : units_) {
+                unit_first_dies_.push_back(size());
+                parents.clear();
+                last_children.clear();
+
+                DieCursor cursor(unit);
+                while(cursor.next()) {
+                    DIE const & die = cursor.die();
+                    auto const index = size();
+
+                    parents.resize(cursor.depth());
+                    last_children.resize(cursor.depth() + 1, invalid_die_index);
+
+                    if(die.offset() - unit.offset() > std::numeric_limits<uint32_t>::max()) [[unlikely]] {
+                        throw std::range_error("die tree: unit larger than 4 GiB");
+                    }
+
+                    DieAbbrev const abbrev = {die.abbrev()->code(), die.tag()};
+                    uint64_t const key = (uint64_t{abbrev.code} << 16) | static_cast<uint16_t>(abbrev.tag);
+                    auto it = std::lower_bound(abbrev_keys.begin(), abbrev_keys.end(), key,
+                        [](auto const & entry, uint64_t const value) { return entry.first < value; });
+                    if(it == abbrev_keys.end() || it->first != key) {
+                        if(abbrevs_.size() > std::numeric_limits<DieAbbrevIndex>::max()) [[unlikely]] {
+                            throw std::range_error("die tree: more than 65536 distinct abbreviations");
+                        }
+                        it = abbrev_keys.insert(it, {key, static_cast<DieAbbrevIndex>(abbrevs_.size())});
+                        abbrevs_.push_back(abbrev);
+                    }
+
+                    abbrev_indices_.push_back(it->second);
+                    parents_.push_back(parents.empty() ? invalid_die_index : parents.back());
+                    next_siblings_.push_back(invalid_die_index);
+                    unit_offsets_.push_back(static_cast<uint32_t>(die.offset() - unit.offset()));
+
+                    if(last_children.back() != invalid_die_index) {
+                        next_siblings_[last_children.back()] = index;
+                    }
+                    last_children.back() = index;
+
+                    if(die.has_children()) {
+                        parents.push_back(index);
+                        last_children.push_back(invalid_die_index);
+                    }
+                }
+            }
+        }
+
+        ///
+        /// @brief Returns the number of entries
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> DieIndex
+        {
+            return static_cast<DieIndex>(abbrev_indices_.size());
+        }
+
+        [[nodiscard]] constexpr auto
+        unit_count() const noexcept -> size_t
+        {
+            return units_.size();
+        }
+
+        ///
+        /// @brief Returns the unit entry of a unit
+        /// @param unit_index the index of the unit in the .debug_info section
+        ///
+        [[nodiscard]] constexpr auto
+        unit_root(size_t const unit_index) const -> DieIndex
+        {
+            return unit_first_dies_.at(unit_index) < size() ? unit_first_dies_[unit_index] : invalid_die_index;
+        }
+
+        ///
+        /// @brief Returns the table of the distinct pairs of abbreviation code and tag
+        ///
+        [[nodiscard]] constexpr auto
+        abbrevs() const noexcept -> std::span<DieAbbrev const>
+        {
+            return abbrevs_;
+        }
+
+        ///
+        /// @brief Returns the indices into abbrevs() of all entries, e.g. to scan a subtree as a contiguous range
+        ///
+        [[nodiscard]] constexpr auto
+        abbrev_indices() const noexcept -> std::span<DieAbbrevIndex const>
+        {
+            return abbrev_indices_;
+        }
+
+        [[nodiscard]] constexpr auto
+        tag(DieIndex const index) const noexcept -> Tag
+        {
+            return abbrevs_[abbrev_indices_[index]].tag;
+        }
+
+        [[nodiscard]] constexpr auto
+        parent(DieIndex const index) const noexcept -> DieIndex
+        {
+            return parents_[index];
+        }
+
+        ///
+        /// @brief Returns the first child of an entry, the children follow their parent directly
+        ///
+        [[nodiscard]] constexpr auto
+        first_child(DieIndex const index) const noexcept -> DieIndex
+        {
+            DieIndex const next = index + 1;
+            return next < size() && parents_[next] == index ? next : invalid_die_index;
+        }
+
+        [[nodiscard]] constexpr auto
+        next_sibling(DieIndex const index) const noexcept -> DieIndex
+        {
+            return next_siblings_[index];
+        }
+
+        [[nodiscard]] constexpr auto
+        abbrev_code(DieIndex const index) const noexcept -> uint32_t
+        {
+            return abbrevs_[abbrev_indices_[index]].code;
+        }
+
+        ///
+        /// @brief Returns the index of the unit containing an entry
+        ///
+        [[nodiscard]] constexpr auto
+        unit_index(DieIndex const index) const noexcept -> size_t
+        {
+            auto const it = std::upper_bound(unit_first_dies_.begin(), unit_first_dies_.end(), index);
+            return static_cast<size_t>(it - unit_first_dies_.begin()) - 1;
+        }
+
+        ///
+        /// @brief Returns the unit containing an entry
+        ///
+        [[nodiscard]] constexpr auto
+        unit(DieIndex const index) const noexcept -> Unit const &
+        {
+            return units_[unit_index(index)];
+        }
+
+        ///
+        /// @brief Returns the offset of an entry in the .debug_info section
+        ///
+        [[nodiscard]] constexpr auto
+        offset(DieIndex const index) const noexcept -> uint64_t
+        {
+            return unit(index).offset() + unit_offsets_[index];
+        }
+
+        ///
+        /// @brief Returns an entry to decode its attribute values from the binary file
+        ///
+        [[nodiscard]] constexpr auto
+        die(DieIndex const index) const -> DIE
+        {
+            return DIE(unit(index), offset(index));
+        }
+
+        ///
+        /// @brief Returns the entry at an offset in the .debug_info section, e.g. the target of a reference
+        /// @return invalid_die_index if no entry starts at the offset
+        ///
+        [[nodiscard]] constexpr auto
+        find(uint64_t const offset) const noexcept -> DieIndex
+        {
+            auto const unit_it = std::upper_bound(units_.begin(), units_.end(), offset,
+                [](uint64_t const value, Unit const & unit) { return value < unit.offset(); });
+            if(unit_it == units_.begin()) {
+                return invalid_die_index;
+            }
+
+            auto const unit_index = static_cast<size_t>(unit_it - units_.begin()) - 1;
+            if(offset >= units_[unit_index].end_offset()) {
+                return invalid_die_index;
+            }
+
+            auto const first = unit_offsets_.begin() + unit_first_dies_[unit_index];
+            auto const last = unit_index + 1 < units_.size() ? unit_offsets_.begin() + unit_first_dies_[unit_index + 1] : unit_offsets_.end();
+            auto const relative = offset - units_[unit_index].offset();
+
+            auto const it = std::lower_bound(first, last, relative);
+            if(it == last || *it != relative) {
+                return invalid_die_index;
+            }
+
+            return static_cast<DieIndex>(it - unit_offsets_.begin());
+        }
+
+        ///
+        /// @brief Returns the number of bytes of the arrays of the entries and of the abbreviation table, without the units
+        ///
+        [[nodiscard]] constexpr auto
+        bytes() const noexcept -> size_t
+        {
+            return abbrevs_.size() * sizeof(DieAbbrev) + abbrev_indices_.size() * sizeof(DieAbbrevIndex)
+                + parents_.size() * sizeof(DieIndex) + next_siblings_.size() * sizeof(DieIndex) + unit_offsets_.size() * sizeof(uint32_t);
+        }
+
+    private:
+        Vector<Unit> units_;
+        Vector<DieIndex> unit_first_dies_;
+
+        Vector<DieAbbrev> abbrevs_;
+
+        Vector<DieAbbrevIndex> abbrev_indices_;
+        Vector<DieIndex> parents_;
+        Vector<DieIndex> next_siblings_;
+        Vector<uint32_t> unit_offsets_;     // relative to the unit header
+    };
+
+    using DieTree = BasicDieTree<>;
+
+    namespace pmr
+    {
+        /// @brief A tree of entries with its arrays in a memory resource, e.g. a dwarf::ImageArena
+        using DieTree = BasicDieTree<std::pmr::polymorphic_allocator<std::byte>>;
+    }
+}
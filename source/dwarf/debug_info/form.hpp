@@ -0,0 +1,578 @@
+///
+/// @file:   form.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Reads the value of an attribute with a given form
+///
+
+#pragma once
+
+#include "dwarf/dwarf_tags.hpp"
+#include "dwarf/leb128.h"
+#include "details/bit_cast.hpp"
+#define MAGIC_ENUM_RANGE_MIN -128
+#define MAGIC_ENUM_RANGE_MAX 256
+#include "magic_enum.hpp"
+#include <array>
+#include <limits>
+#include <utility>
+#include <span>
+#include <string_view>
+#include <stdexcept>
+
+namespace dwarf
+{
+    /// @class dwarf::FormEncoding
+    ///
+    /// @brief The properties of a unit that determine the size of attribute values
+    ///
+    struct FormEncoding final
+    {
+        /// @brief The version of the DWARF information for the unit
+        uint16_t version = 5;
+        /// @brief The size in bytes of an address on the target architecture
+        uint8_t address_size = 8;
+        /// @brief The size in bytes of a section offset, 4 for the 32-bit and 8 for the 64-bit DWARF format
+        uint8_t offset_size = 4;
+    };
+
+    /// @class dwarf::FormValue
+    ///
+    /// @brief The raw value of an attribute as it is encoded in the .debug_info section
+    /// @details Constants, flags, addresses, indices, offsets and references are stored in value.
+    ///     Blocks, expressions, 16 byte constants and inline strings are stored in block.
+    ///
+    struct FormValue final
+    {
+        /// @brief The form of the attribute after resolving DW_FORM_indirect
+        Form form = {};
+        /// @brief The value of the attribute
+        uint64_t value = 0;
+        /// @brief The data of the attribute
+        std::span<char const> block = {};
+    };
+
+    ///
+    /// @brief Returns the null-terminated string at the given index
+    /// @param data a string section like .debug_str
+    /// @param index the index of the first character
+    /// @return the string without the terminating null character
+    ///
+    [[nodiscard]] constexpr auto
+    read_string(std::span<char const> const data, size_t const index) noexcept -> std::string_view
+    {
+        if(index >= data.size()) {
+            return std::string_view();
+        }
+
+        size_t end = index;
+        while(end < data.size() && data[end] != '\0') {
+            ++end;
+        }
+
+        return std::string_view(data.data() + index, end - index);
+    }
+
+    ///
+    /// @brief Reads an unsigned value with the given number of bytes
+    /// @param data the binary data
+    /// @param index the index of the first byte
+    /// @param size the number of bytes, 1 to 8
+    ///
+    [[nodiscard]] constexpr auto
+    read_unsigned(std::span<char const> const data, size_t const index, size_t const size) -> uint64_t
+    {
+        switch (size)
+        {
+        case 1: return ::details::bit_cast<uint8_t>(data, index);
+        case 2: return ::details::bit_cast<uint16_t>(data, index);
+        case 4: return ::details::bit_cast<uint32_t>(data, index);
+        case 8: return ::details::bit_cast<uint64_t>(data, index);
+        default:
+            break;
+        }
+
+        if(index + size > data.size() || size > sizeof(uint64_t)) [[unlikely]] {
+            throw std::range_error("read_unsigned: index out of bounds");
+        }
+
+        uint64_t res = 0;
+        for(size_t i = 0; i < size; ++i) {
+            res |= static_cast<uint64_t>(std::bit_cast<uint8_t>(data[index + i])) << (i * 8);
+        }
+
+        return res;
+    }
+
+    /// @brief The size of a form whose values have different sizes, e.g. LEB128 numbers and blocks
+    constexpr size_t variable_form_size = std::numeric_limits<size_t>::max();
+
+    /// @brief Determines how the size of the value of a form is computed
+    enum class FormSizeClass : uint8_t
+    {
+        /// @brief Not a valid form
+        invalid,
+        /// @brief A constant number of bytes, see dwarf::FormDescriptor::size
+        fixed,
+        /// @brief The size of an address of the unit
+        address,
+        /// @brief The size of a section offset of the unit
+        offset,
+        /// @brief The size of an address before DWARF Version 3, the size of an offset since
+        reference,
+        /// @brief An unsigned LEB128 number
+        uleb128,
+        /// @brief A signed LEB128 number
+        sleb128,
+        /// @brief A block of data preceded by its length, see dwarf::FormDescriptor::size
+        block,
+        /// @brief A null-terminated string
+        string,
+        /// @brief The form is stored as unsigned LEB128 number in front of the value
+        indirect
+    };
+
+    struct FormDescriptor;
+
+    ///
+    /// @brief Reads the value of an attribute
+    /// @details Looks up the decoder of the form in dwarf::form_table and calls it
+    /// @param data the .debug_info section
+    /// @param index the index of the attribute value, is advanced past the value
+    /// @param form the form of the attribute
+    /// @param implicit_const the value of DW_FORM_implicit_const stored in the abbreviation declaration
+    /// @param encoding the properties of the unit
+    /// @return the raw value of the attribute
+    ///
+    [[nodiscard]] constexpr auto
+    read_form(std::span<char const> data, size_t & index, Form form, int64_t implicit_const, FormEncoding const & encoding) -> FormValue;
+
+    /// @brief Decodes the value of one form, see dwarf::read_form()
+    using FormDecoder = auto (*)(std::span<char const> data, size_t & index, int64_t implicit_const, FormEncoding const & encoding) -> FormValue;
+
+    /// @class dwarf::FormDescriptor
+    ///
+    /// @brief How the values of a form are stored and decoded
+    ///
+    struct FormDescriptor final
+    {
+        FormSizeClass size_class = FormSizeClass::invalid;
+        /// @brief The number of bytes of a fixed value or of the length of a block, 0 for a block
+        ///     with a LEB128 length
+        uint8_t size = 0;
+        /// @brief The decoder of the form, nullptr for an invalid form
+        FormDecoder decode = nullptr;
+    };
+}
+
+namespace details
+{
+    ///
+    /// @brief Returns how the values of a form are stored, without the decoder
+    ///
+    [[nodiscard]] consteval auto
+    form_layout(dwarf::Form const form) noexcept -> dwarf::FormDescriptor
+    {
+        switch (form)
+        {
+        case dwarf::Form::dw_form_flag_present:
+        case dwarf::Form::dw_form_implicit_const:
+            return {dwarf::FormSizeClass::fixed, 0};
+        case dwarf::Form::dw_form_data1:
+        case dwarf::Form::dw_form_ref1:
+        case dwarf::Form::dw_form_flag:
+        case dwarf::Form::dw_form_strx1:
+        case dwarf::Form::dw_form_addrx1:
+            return {dwarf::FormSizeClass::fixed, 1};
+        case dwarf::Form::dw_form_data2:
+        case dwarf::Form::dw_form_ref2:
+        case dwarf::Form::dw_form_strx2:
+        case dwarf::Form::dw_form_addrx2:
+            return {dwarf::FormSizeClass::fixed, 2};
+        case dwarf::Form::dw_form_strx3:
+        case dwarf::Form::dw_form_addrx3:
+            return {dwarf::FormSizeClass::fixed, 3};
+        case dwarf::Form::dw_form_data4:
+        case dwarf::Form::dw_form_ref4:
+        case dwarf::Form::dw_form_ref_sup4:
+        case dwarf::Form::dw_form_strx4:
+        case dwarf::Form::dw_form_addrx4:
+            return {dwarf::FormSizeClass::fixed, 4};
+        case dwarf::Form::dw_form_data8:
+        case dwarf::Form::dw_form_ref8:
+        case dwarf::Form::dw_form_ref_sig8:
+        case dwarf::Form::dw_form_ref_sup8:
+            return {dwarf::FormSizeClass::fixed, 8};
+        case dwarf::Form::dw_form_data_16:
+            return {dwarf::FormSizeClass::fixed, 16};
+        case dwarf::Form::dw_form_addr:
+            return {dwarf::FormSizeClass::address, 0};
+        case dwarf::Form::dw_form_strp:
+        case dwarf::Form::dw_form_line_strp:
+        case dwarf::Form::dw_form_sec_offset:
+        case dwarf::Form::dw_form_strp_sup:
+            return {dwarf::FormSizeClass::offset, 0};
+        case dwarf::Form::dw_form_ref_addr:
+            return {dwarf::FormSizeClass::reference, 0};
+        case dwarf::Form::dw_form_udata:
+        case dwarf::Form::dw_form_ref_udata:
+        case dwarf::Form::dw_form_strx:
+        case dwarf::Form::dw_form_addrx:
+        case dwarf::Form::dw_form_loclistx:
+        case dwarf::Form::dw_form_rnglistx:
+            return {dwarf::FormSizeClass::uleb128, 0};
+        case dwarf::Form::dw_form_sdata:
+            return {dwarf::FormSizeClass::sleb128, 0};
+        case dwarf::Form::dw_form_block1:
+            return {dwarf::FormSizeClass::block, 1};
+        case dwarf::Form::dw_form_block2:
+            return {dwarf::FormSizeClass::block, 2};
+        case dwarf::Form::dw_form_block4:
+            return {dwarf::FormSizeClass::block, 4};
+        case dwarf::Form::dw_form_block:
+        case dwarf::Form::dw_form_exprloc:
+            return {dwarf::FormSizeClass::block, 0};
+        case dwarf::Form::dw_form_string:
+            return {dwarf::FormSizeClass::string, 0};
+        case dwarf::Form::dw_form_indirect:
+            return {dwarf::FormSizeClass::indirect, 0};
+        default:
+            return {};
+        }
+    }
+
+    ///
+    /// @brief Reads an unsigned value whose size is known at compile time
+    ///
+    template<size_t SIZE>
+    [[nodiscard]] constexpr auto
+    read_fixed_unsigned(std::span<char const> const data, size_t const index) -> uint64_t
+    {
+        if constexpr (SIZE == 1) {
+            return details::bit_cast<uint8_t>(data, index);
+        }
+        else if constexpr (SIZE == 2) {
+            return details::bit_cast<uint16_t>(data, index);
+        }
+        else if constexpr (SIZE == 4) {
+            return details::bit_cast<uint32_t>(data, index);
+        }
+        else if constexpr (SIZE == 8) {
+            return details::bit_cast<uint64_t>(data, index);
+        }
+        else {
+            return dwarf::read_unsigned(data, index, SIZE);
+        }
+    }
+
+    [[nodiscard]] constexpr auto
+    read_uleb128_value(std::span<char const> const data, size_t & index) -> uint64_t
+    {
+        auto const [val, n] = details::uleb128<uint64_t>(data, index);
+        if(n == 0) [[unlikely]] {
+            throw std::range_error("parsing of .debug_info attribute failed: uleb128 wrong format");
+        }
+        index += n;
+        return val;
+    }
+
+    [[nodiscard]] constexpr auto
+    read_block_value(std::span<char const> const data, size_t & index, size_t const size) -> std::span<char const>
+    {
+        if(index + size > data.size() || index + size < index) [[unlikely]] {
+            throw std::range_error("parsing of .debug_info attribute failed: block out of bounds");
+        }
+        auto const res = data.subspan(index, size);
+        index += size;
+        return res;
+    }
+
+    ///
+    /// @brief Decodes the value of a form, specialized for each form at compile time
+    ///
+    template<dwarf::Form FORM>
+    [[nodiscard]] constexpr auto
+    decode_form(std::span<char const> const data, size_t & index, int64_t const implicit_const, dwarf::FormEncoding const & encoding) -> dwarf::FormValue
+    {
+        constexpr dwarf::FormDescriptor layout = form_layout(FORM);
+
+        dwarf::FormValue res = {};
+        res.form = FORM;
+
+        if constexpr (FORM == dwarf::Form::dw_form_flag_present) {
+            res.value = 1;
+        }
+        else if constexpr (FORM == dwarf::Form::dw_form_implicit_const) {
+            res.value = static_cast<uint64_t>(implicit_const);
+        }
+        else if constexpr (FORM == dwarf::Form::dw_form_data_16) {
+            res.block = read_block_value(data, index, layout.size);
+            res.value = layout.size;
+        }
+        else if constexpr (layout.size_class == dwarf::FormSizeClass::fixed) {
+            res.value = read_fixed_unsigned<layout.size>(data, index);
+            index += layout.size;
+        }
+        else if constexpr (layout.size_class == dwarf::FormSizeClass::address) {
+            res.value = dwarf::read_unsigned(data, index, encoding.address_size);
+            index += encoding.address_size;
+        }
+        else if constexpr (layout.size_class == dwarf::FormSizeClass::offset) {
+            res.value = encoding.offset_size == sizeof(uint32_t) ? read_fixed_unsigned<sizeof(uint32_t)>(data, index)
+                                                                 : dwarf::read_unsigned(data, index, encoding.offset_size);
+            index += encoding.offset_size;
+        }
+        else if constexpr (layout.size_class == dwarf::FormSizeClass::reference) {
+            // In DWARF Version 2 a reference to another unit has the size of an address
+            size_t const size = encoding.version <= 2 ? encoding.address_size : encoding.offset_size;
+            res.value = dwarf::read_unsigned(data, index, size);
+            index += size;
+        }
+        else if constexpr (layout.size_class == dwarf::FormSizeClass::uleb128) {
+            res.value = read_uleb128_value(data, index);
+        }
+        else if constexpr (layout.size_class == dwarf::FormSizeClass::sleb128) {
+            auto const [val, n] = details::sleb128<int64_t>(data, index);
+            if(n == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_info attribute failed: sleb128 wrong format");
+            }
+            res.value = static_cast<uint64_t>(val);
+            index += n;
+        }
+        else if constexpr (layout.size_class == dwarf::FormSizeClass::block) {
+            uint64_t size = 0;
+            if constexpr (layout.size == 0) {
+                size = read_uleb128_value(data, index);
+            }
+            else {
+                size = read_fixed_unsigned<layout.size>(data, index);
+                index += layout.size;
+            }
+            res.block = read_block_value(data, index, size);
+            res.value = size;
+        }
+        else if constexpr (layout.size_class == dwarf::FormSizeClass::string) {
+            auto const str = dwarf::read_string(data, index);
+            res.block = data.subspan(index, str.size());
+            index += str.size() + 1;
+        }
+        else if constexpr (layout.size_class == dwarf::FormSizeClass::indirect) {
+            auto const indirect_form = static_cast<dwarf::Form>(read_uleb128_value(data, index));
+            return dwarf::read_form(data, index, indirect_form, implicit_const, encoding);
+        }
+
+        return res;
+    }
+
+    ///
+    /// @brief Creates the table of the descriptors of all forms, indexed by the value of the form
+    /// @details The forms are enumerated with magic_enum, a decoder is instantiated for each form
+    ///
+    template<size_t... INDICES>
+    [[nodiscard]] consteval auto
+    make_form_table(std::index_sequence<INDICES...>) noexcept
+    {
+        constexpr auto forms = magic_enum::enum_values<dwarf::Form>();
+        std::array<dwarf::FormDescriptor, 256> res = {};
+
+        auto const add = [&]<dwarf::Form FORM>() {
+            dwarf::FormDescriptor descriptor = form_layout(FORM);
+            if(descriptor.size_class != dwarf::FormSizeClass::invalid) {
+                descriptor.decode = &decode_form<FORM>;
+            }
+            res[static_cast<uint8_t>(FORM)] = descriptor;
+        };
+        (add.template operator()<forms[INDICES]>(), ...);
+
+        return res;
+    }
+
+    ///
+    /// @brief Reads the value of an attribute with a switch over all forms
+    /// @details The reference implementation of dwarf::read_form()
+    /// @param data the .debug_info section
+    /// @param index the index of the attribute value, is advanced past the value
+    /// @param form the form of the attribute
+    /// @param implicit_const the value of DW_FORM_implicit_const stored in the abbreviation declaration
+    /// @param encoding the properties of the unit
+    /// @return the raw value of the attribute
+    ///
+    [[nodiscard]] constexpr auto
+    read_form_switch(std::span<char const> const data, size_t & index, dwarf::Form const form, int64_t const implicit_const, dwarf::FormEncoding const & encoding) -> dwarf::FormValue
+    {
+        dwarf::FormValue res = {};
+        res.form = form;
+
+        auto const read_fixed = [&](size_t const size) {
+            res.value = dwarf::read_unsigned(data, index, size);
+            index += size;
+        };
+
+        auto const read_uleb128 = [&]() {
+            auto const [val, n] = details::uleb128<uint64_t>(data, index);
+            if(n == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_info attribute failed: uleb128 wrong format");
+            }
+            index += n;
+            return val;
+        };
+
+        auto const read_block = [&](size_t const size) {
+            if(index + size > data.size()) [[unlikely]] {
+                throw std::range_error("parsing of .debug_info attribute failed: block out of bounds");
+            }
+            res.block = data.subspan(index, size);
+            res.value = size;
+            index += size;
+        };
+
+        switch (form)
+        {
+        case dwarf::Form::dw_form_addr:
+            read_fixed(encoding.address_size);
+            break;
+        case dwarf::Form::dw_form_block1:
+            read_fixed(1);
+            read_block(res.value);
+            break;
+        case dwarf::Form::dw_form_block2:
+            read_fixed(2);
+            read_block(res.value);
+            break;
+        case dwarf::Form::dw_form_block4:
+            read_fixed(4);
+            read_block(res.value);
+            break;
+        case dwarf::Form::dw_form_block:
+        case dwarf::Form::dw_form_exprloc:
+            read_block(read_uleb128());
+            break;
+        case dwarf::Form::dw_form_data1:
+        case dwarf::Form::dw_form_ref1:
+        case dwarf::Form::dw_form_flag:
+        case dwarf::Form::dw_form_strx1:
+        case dwarf::Form::dw_form_addrx1:
+            read_fixed(1);
+            break;
+        case dwarf::Form::dw_form_data2:
+        case dwarf::Form::dw_form_ref2:
+        case dwarf::Form::dw_form_strx2:
+        case dwarf::Form::dw_form_addrx2:
+            read_fixed(2);
+            break;
+        case dwarf::Form::dw_form_strx3:
+        case dwarf::Form::dw_form_addrx3:
+            read_fixed(3);
+            break;
+        case dwarf::Form::dw_form_data4:
+        case dwarf::Form::dw_form_ref4:
+        case dwarf::Form::dw_form_ref_sup4:
+        case dwarf::Form::dw_form_strx4:
+        case dwarf::Form::dw_form_addrx4:
+            read_fixed(4);
+            break;
+        case dwarf::Form::dw_form_data8:
+        case dwarf::Form::dw_form_ref8:
+        case dwarf::Form::dw_form_ref_sig8:
+        case dwarf::Form::dw_form_ref_sup8:
+            read_fixed(8);
+            break;
+        case dwarf::Form::dw_form_data_16:
+            read_block(16);
+            break;
+        case dwarf::Form::dw_form_string:
+        {
+            auto const str = dwarf::read_string(data, index);
+            res.block = data.subspan(index, str.size());
+            index += str.size() + 1;
+            break;
+        }
+        case dwarf::Form::dw_form_sdata:
+        {
+            auto const [val, n] = details::sleb128<int64_t>(data, index);
+            if(n == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_info attribute failed: sleb128 wrong format");
+            }
+            res.value = static_cast<uint64_t>(val);
+            index += n;
+            break;
+        }
+        case dwarf::Form::dw_form_udata:
+        case dwarf::Form::dw_form_ref_udata:
+        case dwarf::Form::dw_form_strx:
+        case dwarf::Form::dw_form_addrx:
+        case dwarf::Form::dw_form_loclistx:
+        case dwarf::Form::dw_form_rnglistx:
+            res.value = read_uleb128();
+            break;
+        case dwarf::Form::dw_form_ref_addr:
+            // In DWARF Version 2 a reference to another unit has the size of an address
+            read_fixed(encoding.version <= 2 ? encoding.address_size : encoding.offset_size);
+            break;
+        case dwarf::Form::dw_form_strp:
+        case dwarf::Form::dw_form_line_strp:
+        case dwarf::Form::dw_form_sec_offset:
+        case dwarf::Form::dw_form_strp_sup:
+            read_fixed(encoding.offset_size);
+            break;
+        case dwarf::Form::dw_form_flag_present:
+            res.value = 1;
+            break;
+        case dwarf::Form::dw_form_implicit_const:
+            res.value = static_cast<uint64_t>(implicit_const);
+            break;
+        case dwarf::Form::dw_form_indirect:
+        {
+            auto const indirect_form = static_cast<dwarf::Form>(read_uleb128());
+            return read_form_switch(data, index, indirect_form, implicit_const, encoding);
+        }
+        default:
+            throw std::range_error("parsing of .debug_info attribute failed: unknown form");
+        }
+
+        return res;
+    }
+}
+
+namespace dwarf
+{
+    /// @brief The descriptors of all forms, indexed by the value of the form
+    constexpr std::array<FormDescriptor, 256> form_table = ::details::make_form_table(std::make_index_sequence<magic_enum::enum_count<Form>()>());
+
+    [[nodiscard]] constexpr auto
+    read_form(std::span<char const> const data, size_t & index, Form const form, int64_t const implicit_const, FormEncoding const & encoding) -> FormValue
+    {
+        FormDescriptor const & descriptor = form_table[static_cast<uint8_t>(form)];
+        if(descriptor.decode == nullptr) [[unlikely]] {
+            throw std::range_error("parsing of .debug_info attribute failed: unknown form");
+        }
+
+        return descriptor.decode(data, index, implicit_const, encoding);
+    }
+
+    ///
+    /// @brief Returns the number of bytes of a value of a form in the .debug_info section
+    /// @param form the form of the attribute
+    /// @param encoding the properties of the unit
+    /// @return the size, variable_form_size if the size depends on the value
+    ///
+    [[nodiscard]] constexpr auto
+    form_size(Form const form, FormEncoding const & encoding) noexcept -> size_t
+    {
+        FormDescriptor const & descriptor = form_table[static_cast<uint8_t>(form)];
+
+        switch (descriptor.size_class)
+        {
+        case FormSizeClass::fixed:
+            return descriptor.size;
+        case FormSizeClass::address:
+            return encoding.address_size;
+        case FormSizeClass::offset:
+            return encoding.offset_size;
+        case FormSizeClass::reference:
+            return encoding.version <= 2 ? encoding.address_size : encoding.offset_size;
+        default:
+            return variable_form_size;
+        }
+    }
+}
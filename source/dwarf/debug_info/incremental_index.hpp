@@ -0,0 +1,569 @@
+///
+/// @file:   incremental_index.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  An index of names and address ranges which is updated incrementally when a binary is rebuilt
+///
+
+#pragma once
+
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/die_cursor.hpp"
+#include "dwarf/debug_rnglists/range_list.hpp"
+#include "details/type_list.hpp"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dwarf
+{
+    /// @class dwarf::IndexedName
+    ///
+    /// @brief A named debugging information entry of a unit
+    ///
+    struct IndexedName final
+    {
+        /// @brief The position of the name in dwarf::UnitFragment::strings
+        uint32_t name_offset = 0;
+        uint32_t name_size = 0;
+        /// @brief The offset of the entry relative to the unit header
+        uint64_t die_offset = 0;
+        Tag tag = {};
+    };
+
+    /// @class dwarf::IndexedRange
+    ///
+    /// @brief The address range [low_pc, high_pc) of a debugging information entry of a unit
+    ///
+    struct IndexedRange final
+    {
+        uint64_t low_pc = 0;
+        uint64_t high_pc = 0;
+        /// @brief The offset of the entry relative to the unit header, in the address table of
+        ///     dwarf::IncrementalIndex the offset in the .debug_info section
+        uint64_t die_offset = 0;
+    };
+
+    /// @class dwarf::LineProgramLocation
+    ///
+    /// @brief The line number program of a unit in the .debug_line section
+    ///
+    struct LineProgramLocation final
+    {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+    /// @class dwarf::ReferencedBytes
+    ///
+    /// @brief Bytes of a section other than .debug_info that a value of a unit was read from,
+    ///     e.g. a name in .debug_str or an address in .debug_addr
+    ///
+    struct ReferencedBytes final
+    {
+        std::span<char const> DebugSections::* section = nullptr;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+    /// @class dwarf::UnitFragment
+    ///
+    /// @brief The part of the index built from one unit
+    /// @details All offsets are relative to the unit header, so a fragment stays valid if the
+    ///     unit moves in a rebuilt binary. The names are copied, the fragment does not refer to
+    ///     the data of the binary.
+    ///
+    struct UnitFragment final
+    {
+        /// @brief The names of the entries, sorted by name
+        std::vector<IndexedName> names;
+        /// @brief The address ranges of the unit entry and the subprograms, sorted by low_pc,
+        ///     an entry with DW_AT_ranges has one range for each range of its range list
+        std::vector<IndexedRange> ranges;
+        /// @brief The line number program, size 0 if the unit has none
+        LineProgramLocation line_program;
+        /// @brief The hash of the bytes of the line number program
+        uint64_t line_program_hash = 0;
+        /// @brief The bytes of other sections the names and addresses were read from
+        std::vector<ReferencedBytes> references;
+        /// @brief The hash of the referenced bytes
+        uint64_t references_hash = 0;
+        /// @brief The characters of all names
+        std::string strings;
+
+        [[nodiscard]] auto
+        name(IndexedName const & entry) const noexcept -> std::string_view
+        {
+            return std::string_view(strings).substr(entry.name_offset, entry.name_size);
+        }
+    };
+
+    /// @class dwarf::IndexedUnit
+    ///
+    /// @brief A unit of the indexed binary
+    ///
+    struct IndexedUnit final
+    {
+        /// @brief The offset of the unit header in the .debug_info section
+        uint64_t offset = 0;
+        /// @brief The hash of the unit and its abbreviation table
+        uint64_t hash = 0;
+        std::shared_ptr<UnitFragment const> fragment;
+    };
+
+    /// @class dwarf::IndexUpdate
+    ///
+    /// @brief The work done by dwarf::IncrementalIndex::update()
+    ///
+    struct IndexUpdate final
+    {
+        size_t units = 0;
+        /// @brief The units with the fragment of an unchanged unit of the previous binary
+        size_t reused = 0;
+        /// @brief The new or changed units which were parsed
+        size_t parsed = 0;
+    };
+
+    /// @class dwarf::IncrementalIndex
+    ///
+    /// @brief An index of the names, address ranges and line number programs of all units of a
+    ///     binary, which is updated incrementally when the binary is rebuilt
+    /// @details Each unit is identified by a hash of its bytes and the slice of the .debug_abbrev
+    ///     section of its abbreviation table. A unit with the hash of a unit of the previous
+    ///     binary reuses its fragment if the bytes of its line number program and the bytes it
+    ///     read from other sections are unchanged as well, only new or changed units are parsed.
+    ///     The unit bytes hold only the offsets of strings in .debug_str and .debug_line_str and
+    ///     the indices into .debug_str_offsets and .debug_addr, so a name renamed to one of the
+    ///     same length keeps the unit bytes. The offsets are part of the unit bytes, so the
+    ///     referenced bytes are compared without decoding an entry.
+    ///     The address ranges of all units are merged into one table of disjoint ranges, each
+    ///     mapped to the innermost entry, which is rebuilt by each update and binary searched.
+    ///
+    class IncrementalIndex final
+    {
+    public:
+        IncrementalIndex() noexcept = default;
+
+        ///
+        /// @brief Builds the index of a binary
+        /// @param sections the debug sections of the binary file
+        ///
+        explicit IncrementalIndex(DebugSections const & sections)
+        {
+            static_cast<void>(update(sections));
+        }
+
+        ///
+        /// @brief Updates the index to a rebuilt binary
+        /// @param sections the debug sections of the rebuilt binary file
+        ///
+        auto
+        update(DebugSections const & sections) -> IndexUpdate
+        {
+            StageTimer const timer(ReaderStage::index);
+            IndexUpdate res = {};
+            std::vector<IndexedUnit> units;
+            std::unordered_map<uint64_t, std::shared_ptr<UnitFragment const>> fragments;
+            // units often share an abbreviation table
+            std::unordered_map<uint64_t, uint64_t> abbrev_hashes;
+
+            for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+                IndexedUnit unit = {};
+                unit.offset = unit_header.base_index();
+                unit.hash = hash_unit(sections, unit_header, abbrev_hashes);
+
+                if(auto const it = fragments.find(unit.hash); it != fragments.end()) {
+                    unit.fragment = it->second;
+                    ++res.reused;
+                }
+                else if(auto const old_it = fragments_.find(unit.hash);
+                    old_it != fragments_.end() && is_line_program_unchanged(sections.debug_line, *old_it->second)
+                    && hash_references(sections, old_it->second->references) == old_it->second->references_hash) {
+                    unit.fragment = old_it->second;
+                    ++res.reused;
+                }
+                else {
+                    unit.fragment = std::make_shared<UnitFragment const>(parse_unit(Unit(sections, unit_header)));
+                    ++res.parsed;
+                }
+
+                fragments.emplace(unit.hash, unit.fragment);
+                units.push_back(std::move(unit));
+            }
+
+            // fragments of units which are not in the binary anymore are released
+            units_ = std::move(units);
+            fragments_ = std::move(fragments);
+            addresses_ = merge_ranges(units_);
+
+            res.units = units_.size();
+            return res;
+        }
+
+        ///
+        /// @brief Returns the debugging information entries with a name
+        /// @return the offsets of the entries in the .debug_info section
+        ///
+        [[nodiscard]] auto
+        find_name(std::string_view const name) const -> std::vector<size_t>
+        {
+            std::vector<size_t> res;
+            for(auto const & unit : units_) {
+                auto const & fragment = *unit.fragment;
+                auto it = std::ranges::lower_bound(fragment.names, name, {},
+                    [&](IndexedName const & entry) { return fragment.name(entry); });
+                for(; it != fragment.names.end() && fragment.name(*it) == name; ++it) {
+                    res.push_back(unit.offset + it->die_offset);
+                }
+            }
+
+            return res;
+        }
+
+        ///
+        /// @brief Returns the innermost debugging information entry containing an address
+        /// @return the offset of the entry in the .debug_info section, 0 if there is none
+        ///
+        [[nodiscard]] auto
+        find_address(uint64_t const address) const noexcept -> size_t
+        {
+            auto const it = std::ranges::upper_bound(addresses_, address, {}, &IndexedRange::low_pc);
+            if(it == addresses_.begin() || address >= std::prev(it)->high_pc) {
+                return 0;
+            }
+
+            return std::prev(it)->die_offset;
+        }
+
+        ///
+        /// @brief Returns the units of the binary in the order of the .debug_info section
+        ///
+        [[nodiscard]] auto
+        units() const noexcept -> std::span<IndexedUnit const>
+        {
+            return units_;
+        }
+
+    private:
+        ///
+        /// @brief Hashes the bytes 8 at a time, a multiply and xor-shift mix
+        ///
+        [[nodiscard]] static auto
+        hash_bytes(std::span<char const> const data, uint64_t seed) -> uint64_t
+        {
+            constexpr uint64_t prime = 0x9e3779b97f4a7c15;
+            size_t index = 0;
+            for(; index + sizeof(uint64_t) <= data.size(); index += sizeof(uint64_t)) {
+                seed = (seed ^ ::details::bit_cast<uint64_t>(data, index)) * prime;
+                seed ^= seed >> 29;
+            }
+
+            uint64_t tail = data.size();
+            for(; index < data.size(); ++index) {
+                tail = (tail << 8) | static_cast<uint8_t>(data[index]);
+            }
+            seed = (seed ^ tail) * prime;
+            return seed ^ (seed >> 32);
+        }
+
+        ///
+        /// @brief Returns the size of the abbreviation table at an offset of the .debug_abbrev section
+        ///
+        [[nodiscard]] static auto
+        abbrev_table_size(std::span<char const> const debug_abbrev, size_t const offset) -> size_t
+        {
+            DebugAbbrevParser parser(debug_abbrev, offset);
+            while(parser.next()) {
+                if(parser.is_end_of_table()) {
+                    break;
+                }
+            }
+
+            return std::min(parser.get_index(), debug_abbrev.size()) - offset;
+        }
+
+        ///
+        /// @brief Returns the line number program at an offset of the .debug_line section
+        ///
+        [[nodiscard]] static auto
+        line_program(std::span<char const> const debug_line, uint64_t const offset) -> LineProgramLocation
+        {
+            if(offset + sizeof(uint32_t) > debug_line.size()) {
+                return {};
+            }
+
+            auto const length_32 = ::details::bit_cast<uint32_t>(debug_line, offset);
+            uint64_t const size = length_32 == 0xffffffff ? ::details::bit_cast<uint64_t>(debug_line, offset + 4) + 12
+                                                          : uint64_t{length_32} + 4;
+
+            return {offset, std::min(size, debug_line.size() - offset)};
+        }
+
+        [[nodiscard]] static auto
+        is_line_program_unchanged(std::span<char const> const debug_line, UnitFragment const & fragment) -> bool
+        {
+            if(fragment.line_program.size == 0) {
+                return true;
+            }
+
+            auto const location = line_program(debug_line, fragment.line_program.offset);
+            count(ReaderCounter::line_bytes, location.size);
+            return location.size == fragment.line_program.size
+                && hash_bytes(debug_line.subspan(location.offset, location.size), 0) == fragment.line_program_hash;
+        }
+
+        ///
+        /// @brief Hashes the referenced bytes in the order they were read
+        /// @details A reference beyond the end of its section hashes the bytes within the section
+        ///
+        [[nodiscard]] static auto
+        hash_references(DebugSections const & sections, std::span<ReferencedBytes const> const references) -> uint64_t
+        {
+            uint64_t res = references.size();
+            for(auto const & reference : references) {
+                auto const & data = sections.*reference.section;
+                size_t const offset = std::min<uint64_t>(reference.offset, data.size());
+                res = hash_bytes(data.subspan(offset, std::min<uint64_t>(reference.size, data.size() - offset)), res);
+            }
+            return res;
+        }
+
+        ///
+        /// @brief Records the bytes of other sections a string or an address is read from
+        ///
+        static auto
+        add_references(std::vector<ReferencedBytes> & references, Unit const & unit, AttributeValue const & value) -> void
+        {
+            switch (value.form())
+            {
+            case Form::dw_form_strp:
+                references.push_back({&DebugSections::debug_str, value.as_unsigned(), value.as_string().size() + 1});
+                break;
+            case Form::dw_form_line_strp:
+                references.push_back({&DebugSections::debug_line_str, value.as_unsigned(), value.as_string().size() + 1});
+                break;
+            case Form::dw_form_strx:
+            case Form::dw_form_strx1:
+            case Form::dw_form_strx2:
+            case Form::dw_form_strx3:
+            case Form::dw_form_strx4:
+            {
+                uint64_t const index = unit.str_offsets_base() + value.as_unsigned() * unit.offset_size();
+                references.push_back({&DebugSections::debug_str_offsets, index, unit.offset_size()});
+                auto const & debug_str_offsets = unit.sections().debug_str_offsets;
+                if(index + unit.offset_size() <= debug_str_offsets.size()) {
+                    auto const offset = read_unsigned(debug_str_offsets, index, unit.offset_size());
+                    references.push_back({&DebugSections::debug_str, offset, value.as_string().size() + 1});
+                }
+                break;
+            }
+            case Form::dw_form_addrx:
+            case Form::dw_form_addrx1:
+            case Form::dw_form_addrx2:
+            case Form::dw_form_addrx3:
+            case Form::dw_form_addrx4:
+                references.push_back({&DebugSections::debug_addr, unit.addr_base() + value.as_unsigned() * unit.address_size(), unit.address_size()});
+                break;
+            default:
+                break;
+            }
+        }
+
+        ///
+        /// @brief Hashes a unit without decoding its entries
+        ///
+        [[nodiscard]] static auto
+        hash_unit(DebugSections const & sections, UnitHeader const & unit_header,
+            std::unordered_map<uint64_t, uint64_t> & abbrev_hashes) -> uint64_t
+        {
+            bool const is_64_bit = unit_header.is64bit();
+            size_t const length_size = is_64_bit ? decltype(UnitHeader::DataStructure64::unit_length)::end
+                                                 : decltype(UnitHeader::DataStructure32::unit_length)::end;
+            size_t const offset_size = is_64_bit ? sizeof(uint64_t) : sizeof(uint32_t);
+            size_t const offset = unit_header.base_index();
+            size_t const end_offset = std::min<size_t>(offset + length_size + unit_header.unit_length(), sections.debug_info.size());
+
+            // debug_abbrev_offset follows unit_type and address_size since DWARF 5
+            size_t const abbrev_offset_index = offset + length_size + sizeof(uint16_t) + (unit_header.version() >= 5 ? 2 : 0);
+            uint64_t const abbrev_offset = read_unsigned(sections.debug_info, abbrev_offset_index, offset_size);
+
+            auto [it, is_new] = abbrev_hashes.try_emplace(abbrev_offset, 0);
+            if(is_new && abbrev_offset < sections.debug_abbrev.size()) {
+                auto const size = abbrev_table_size(sections.debug_abbrev, abbrev_offset);
+                it->second = hash_bytes(sections.debug_abbrev.subspan(abbrev_offset, size), 0);
+            }
+
+            return hash_bytes(sections.debug_info.subspan(offset, end_offset - offset), it->second);
+        }
+
+        ///
+        /// @brief Merges the address ranges of all units into disjoint ranges sorted by low_pc
+        /// @details Each range is mapped to the smallest range containing it, of equal ones to the
+        ///     first in the order of the units and their ranges. Adjacent ranges of the same entry are joined.
+        ///
+        [[nodiscard]] static auto
+        merge_ranges(std::span<IndexedUnit const> const units) -> std::vector<IndexedRange>
+        {
+            std::vector<IndexedRange> ranges;
+            std::vector<uint64_t> points;
+            for(auto const & unit : units) {
+                for(auto const & range : unit.fragment->ranges) {
+                    ranges.push_back({range.low_pc, range.high_pc, unit.offset + range.die_offset});
+                    points.push_back(range.low_pc);
+                    points.push_back(range.high_pc);
+                }
+            }
+
+            std::ranges::sort(points);
+            auto const duplicates = std::ranges::unique(points);
+            points.erase(duplicates.begin(), duplicates.end());
+
+            std::vector<uint32_t> order(ranges.size());
+            for(uint32_t i = 0; i < order.size(); ++i) {
+                order[i] = i;
+            }
+            std::ranges::stable_sort(order, {}, [&](uint32_t const i) { return ranges[i].low_pc; });
+
+            // the ranges containing the current point, the smallest and first one on top
+            auto const key = [&](uint32_t const i) { return std::pair(ranges[i].high_pc - ranges[i].low_pc, i); };
+            auto const is_after = [&](uint32_t const a, uint32_t const b) { return key(a) > key(b); };
+            std::priority_queue<uint32_t, std::vector<uint32_t>, decltype(is_after)> active(is_after);
+
+            std::vector<IndexedRange> res;
+            size_t next = 0;
+            for(size_t i = 0; i + 1 < points.size(); ++i) {
+                uint64_t const low_pc = points[i];
+                for(; next < order.size() && ranges[order[next]].low_pc <= low_pc; ++next) {
+                    active.push(order[next]);
+                }
+                while(!active.empty() && ranges[active.top()].high_pc <= low_pc) {
+                    active.pop();
+                }
+                if(active.empty()) {
+                    continue;
+                }
+
+                uint64_t const die_offset = ranges[active.top()].die_offset;
+                if(!res.empty() && res.back().high_pc == low_pc && res.back().die_offset == die_offset) {
+                    res.back().high_pc = points[i + 1];
+                }
+                else {
+                    res.push_back({low_pc, points[i + 1], die_offset});
+                }
+            }
+
+            return res;
+        }
+
+        ///
+        /// @brief Parses the names, the address ranges and the line number program of a unit
+        ///
+        [[nodiscard]] static auto
+        parse_unit(Unit const & unit) -> UnitFragment
+        {
+            UnitFragment res = {};
+            std::vector<std::pair<std::string_view, IndexedName>> names;
+            uint64_t base_address = 0;
+
+            DieCursor cursor(unit);
+            while(cursor.next()) {
+                DIE const & die = cursor.die();
+                uint64_t const die_offset = die.offset() - unit.offset();
+
+                auto const name = die.attribute(Attribute::dw_at_name);
+                if(name.is_valid() && name.is_string()) {
+                    names.emplace_back(name.as_string(), IndexedName{0, 0, die_offset, die.tag()});
+                    add_references(res.references, unit, name);
+                }
+
+                if(die.tag() == Tag::dw_tag_compile_unit || die.tag() == Tag::dw_tag_partial_unit || die.tag() == Tag::dw_tag_subprogram) {
+                    auto const low_pc = die.attribute(Attribute::dw_at_low_pc);
+                    auto const high_pc = die.attribute(Attribute::dw_at_high_pc);
+                    auto const ranges = die.attribute(Attribute::dw_at_ranges);
+                    if(low_pc.is_valid() && cursor.depth() == 0) {
+                        // the base address of the range lists of the unit
+                        base_address = low_pc.as_address();
+                    }
+
+                    if(low_pc.is_valid() && high_pc.is_valid()) {
+                        uint64_t const low = low_pc.as_address();
+                        uint64_t const high = is_address(high_pc) ? high_pc.as_address() : low + high_pc.as_unsigned();
+                        if(low < high) {
+                            res.ranges.push_back({low, high, die_offset});
+                        }
+                        add_references(res.references, unit, low_pc);
+                        add_references(res.references, unit, high_pc);
+                    }
+                    else if(ranges.is_valid()) {
+                        auto const range_list = read_range_list(unit, ranges, base_address);
+                        for(auto const & range : range_list.ranges) {
+                            res.ranges.push_back({range.low_pc, range.high_pc, die_offset});
+                        }
+
+                        if(low_pc.is_valid()) {
+                            add_references(res.references, unit, low_pc);
+                        }
+                        if(range_list.section != nullptr) {
+                            if(range_list.index_size > 0) {
+                                res.references.push_back({range_list.section, range_list.index_offset, range_list.index_size});
+                            }
+                            res.references.push_back({range_list.section, range_list.offset, range_list.size});
+                        }
+                        for(uint64_t const offset : range_list.addresses) {
+                            res.references.push_back({&DebugSections::debug_addr, offset, unit.address_size()});
+                        }
+                    }
+                }
+
+                if(cursor.depth() == 0) {
+                    auto const stmt_list = die.attribute(Attribute::dw_at_stmt_list);
+                    if(stmt_list.is_valid()) {
+                        auto const & debug_line = unit.sections().debug_line;
+                        res.line_program = line_program(debug_line, stmt_list.as_unsigned());
+                        res.line_program_hash = hash_bytes(debug_line.subspan(res.line_program.offset, res.line_program.size), 0);
+                        count(ReaderCounter::line_bytes, res.line_program.size);
+                    }
+                }
+            }
+
+            std::ranges::sort(names, {}, [](auto const & entry) { return entry.first; });
+            for(auto & [name, entry] : names) {
+                entry.name_offset = static_cast<uint32_t>(res.strings.size());
+                entry.name_size = static_cast<uint32_t>(name.size());
+                res.strings.append(name);
+                res.names.push_back(entry);
+            }
+            std::ranges::sort(res.ranges, {}, &IndexedRange::low_pc);
+            res.references_hash = hash_references(unit.sections(), res.references);
+
+            return res;
+        }
+
+        [[nodiscard]] static constexpr auto
+        is_address(AttributeValue const & value) noexcept -> bool
+        {
+            switch (value.form())
+            {
+            case Form::dw_form_addr:
+            case Form::dw_form_addrx:
+            case Form::dw_form_addrx1:
+            case Form::dw_form_addrx2:
+            case Form::dw_form_addrx3:
+            case Form::dw_form_addrx4:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        std::vector<IndexedUnit> units_;
+        /// @brief The fragments of the units of the current binary by hash
+        std::unordered_map<uint64_t, std::shared_ptr<UnitFragment const>> fragments_;
+        /// @brief The merged address ranges of all units, see merge_ranges()
+        std::vector<IndexedRange> addresses_;
+    };
+}
@@ -0,0 +1,61 @@
+///
+/// @file:   traversal.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Lazy ranges of the units and debugging information entries of the .debug_info section
+///
+
+#pragma once
+
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/die_cursor.hpp"
+#include "details/generator.hpp"
+
+namespace dwarf
+{
+    ///
+    /// @brief Yields the units of the .debug_info section
+    /// @details A unit is decoded when the consumer advances to it and stays valid until the
+    ///     consumer advances again, copy it to keep it longer. Unlike dwarf::DebugInfo the range
+    ///     composes with the range algorithms and views.
+    /// @param sections the debug sections, copied into the coroutine, the data must outlive the generator
+    ///
+    inline auto
+    units(DebugSections const sections) -> ::details::Generator<Unit>
+    {
+        for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+            co_yield Unit(sections, unit_header);
+        }
+    }
+
+    ///
+    /// @brief Yields the entries of a unit in the order they are stored, without the null entries
+    /// @param unit the unit, must outlive the generator
+    ///
+    inline auto
+    dies(Unit const & unit) -> ::details::Generator<DIE>
+    {
+        DieCursor cursor(unit);
+        while(cursor.next()) {
+            co_yield cursor.die();
+        }
+    }
+
+    ///
+    /// @brief Yields the entries of all units of the .debug_info section
+    /// @details The unit of a yielded entry is only valid until the generator leaves the unit,
+    ///     a consumer that stops at an entry must use it before the generator is advanced or destroyed.
+    /// @param sections the debug sections, copied into the coroutine, the data must outlive the generator
+    ///
+    inline auto
+    dies(DebugSections const sections) -> ::details::Generator<DIE>
+    {
+        for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+            Unit const unit(sections, unit_header);
+            DieCursor cursor(unit);
+            while(cursor.next()) {
+                co_yield cursor.die();
+            }
+        }
+    }
+}
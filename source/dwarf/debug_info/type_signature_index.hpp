@@ -0,0 +1,215 @@
+///
+/// @file:   type_signature_index.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Maps the signatures of type units to their type entries
+///
+
+#pragma once
+
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/attribute_value.hpp"
+#include <algorithm>
+#include <bit>
+#include <utility>
+#include <vector>
+
+namespace dwarf
+{
+    /// @class dwarf::TypeSignatureEntry
+    ///
+    /// @brief The location of the type described by a type unit
+    ///
+    struct TypeSignatureEntry final
+    {
+        /// @brief The unique signature of the type
+        uint64_t signature = 0;
+        /// @brief The offset of the type unit header in the .debug_info section
+        uint64_t unit_offset = 0;
+        /// @brief The offset of the type entry in the .debug_info section
+        uint64_t type_offset = 0;
+    };
+
+    /// @class dwarf::TypeSignatureIndex
+    ///
+    /// @brief Resolves DW_FORM_ref_sig8 references to the type entries of the type units of a
+    ///     binary file, e.g. of a build with -fdebug-types-section
+    /// @details The index is built from the unit headers only, no entry is decoded. The entries are
+    ///     stored inline in one open addressing hash table with linear probing, at most half of
+    ///     the slots are used. A slot with type_offset 0 is unused, a type entry always follows
+    ///     its unit header. If several type units have the same signature, the first one is used.
+    ///
+    class TypeSignatureIndex final
+    {
+    public:
+        constexpr TypeSignatureIndex() noexcept = default;
+
+        ///
+        /// @brief Builds the index of all type units of the binary file
+        /// @param sections the debug sections of the binary file
+        ///
+        constexpr explicit TypeSignatureIndex(DebugSections const & sections)
+        {
+            std::vector<TypeSignatureEntry> entries;
+            for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+                TypeSignatureEntry entry = {};
+                if(read_entry(sections.debug_info, unit_header, entry)) {
+                    entries.push_back(entry);
+                }
+            }
+
+            reserve(entries.size());
+            for(auto const & entry : entries) {
+                insert(entry);
+            }
+        }
+
+        ///
+        /// @brief Adds a type unit
+        /// @return false if the unit is no type unit or its signature is already indexed
+        ///
+        constexpr auto
+        insert(TypeSignatureEntry const & entry) -> bool
+        {
+            if(entry.type_offset == 0) {
+                return false;
+            }
+
+            if(2 * (size_ + 1) > slots_.size()) {
+                reserve(size_ + 1);
+            }
+
+            size_t slot = home_slot(entry.signature);
+            while(slots_[slot].type_offset != 0) {
+                if(slots_[slot].signature == entry.signature) {
+                    return false;
+                }
+                slot = (slot + 1) & (slots_.size() - 1);
+            }
+
+            slots_[slot] = entry;
+            ++size_;
+            return true;
+        }
+
+        ///
+        /// @brief Returns the type unit with a signature
+        /// @return the entry or nullptr if there is no type unit with the signature
+        ///
+        [[nodiscard]] constexpr auto
+        find(uint64_t const signature) const noexcept -> TypeSignatureEntry const *
+        {
+            if(size_ == 0) {
+                return nullptr;
+            }
+
+            size_t slot = home_slot(signature);
+            while(slots_[slot].type_offset != 0) {
+                if(slots_[slot].signature == signature) {
+                    return &slots_[slot];
+                }
+                slot = (slot + 1) & (slots_.size() - 1);
+            }
+
+            return nullptr;
+        }
+
+        ///
+        /// @brief Returns the referenced debugging information entry as offset in the .debug_info section
+        /// @details DW_FORM_ref_sig8 references are resolved with the index, all other references
+        ///     with dwarf::AttributeValue::as_reference()
+        /// @return the offset, 0 if the value is no reference or the type unit is not indexed
+        ///
+        [[nodiscard]] constexpr auto
+        as_reference(AttributeValue const & value) const noexcept -> size_t
+        {
+            if(value.is_type_signature()) {
+                auto const * const entry = find(value.as_type_signature());
+                return entry != nullptr ? entry->type_offset : 0;
+            }
+
+            return value.is_reference() ? value.as_reference() : 0;
+        }
+
+        ///
+        /// @brief Returns the number of indexed type units
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_t
+        {
+            return size_;
+        }
+
+        ///
+        /// @brief Returns the number of slots of the hash table
+        ///
+        [[nodiscard]] constexpr auto
+        capacity() const noexcept -> size_t
+        {
+            return slots_.size();
+        }
+
+    private:
+        ///
+        /// @brief Reads the signature and the type offset of a type unit from its header
+        /// @return false if the unit is no type unit
+        ///
+        [[nodiscard]] static constexpr auto
+        read_entry(std::span<char const> const debug_info, UnitHeader const & unit_header, TypeSignatureEntry & entry) -> bool
+        {
+            if(unit_header.version() < 5) {
+                return false;
+            }
+
+            auto const unit_type = unit_header.unit_type();
+            if(unit_type != UnitHeaderUnitType::dw_ut_type && unit_type != UnitHeaderUnitType::dw_ut_split_type) {
+                return false;
+            }
+
+            // the type unit header extends the compilation unit header by type_signature and type_offset
+            FullAndPartialCompilationUnitHeader const header(unit_header);
+            size_t const offset_size = unit_header.is64bit() ? sizeof(uint64_t) : sizeof(uint32_t);
+            size_t const index = unit_header.base_index() + header.size();
+
+            entry.signature = read_unsigned(debug_info, index, sizeof(uint64_t));
+            entry.unit_offset = unit_header.base_index();
+            entry.type_offset = entry.unit_offset + read_unsigned(debug_info, index + sizeof(uint64_t), offset_size);
+
+            return true;
+        }
+
+        ///
+        /// @brief Resizes the hash table to a power of two with at least two slots per entry
+        ///
+        constexpr auto
+        reserve(size_t const count) -> void
+        {
+            size_t const capacity = std::bit_ceil(std::max<size_t>(2 * count, 8));
+            if(capacity <= slots_.size()) {
+                return;
+            }
+
+            auto slots = std::exchange(slots_, std::vector<TypeSignatureEntry>(capacity));
+            shift_ = static_cast<uint32_t>(64 - std::countr_zero(capacity));
+            size_ = 0;
+            for(auto const & entry : slots) {
+                if(entry.type_offset != 0) {
+                    insert(entry);
+                }
+            }
+        }
+
+        ///
+        /// @brief Fibonacci hashing, spreads signatures which only differ in the high bits
+        ///
+        [[nodiscard]] constexpr auto
+        home_slot(uint64_t const signature) const noexcept -> size_t
+        {
+            return static_cast<size_t>((signature * 0x9e3779b97f4a7c15) >> shift_);
+        }
+
+        std::vector<TypeSignatureEntry> slots_;
+        size_t size_ = 0;
+        uint32_t shift_ = 64;
+    };
+}
@@ -0,0 +1,314 @@
+///
+/// @file:   unit.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  A unit of the .debug_info section
+///
+
+#pragma once
+
+#include "dwarf/debug_sections.hpp"
+#include "dwarf/debug_abbrev/debug_abbrev_table.hpp"
+#include "dwarf/debug_info/form.hpp"
+#include "dwarf/debug_info/unit_header/unit_header.hpp"
+#include "dwarf/debug_info/unit_header/full_and_partial_compilation_unit_header.hpp"
+#include "dwarf/reader_statistics.hpp"
+
+namespace dwarf
+{
+    /// @class dwarf::Unit
+    ///
+    /// @brief A unit of the .debug_info section with its decoded header and abbreviations table
+    /// @details The unit header is decoded once, so that the debugging information entries
+    ///     of the unit can be read without accessing the header again. Supports the header
+    ///     formats of DWARF Version 2 to 5.
+    ///
+    class Unit final
+    {
+    public:
+        constexpr Unit() noexcept = default;
+
+        ///
+        /// @brief constructor
+        /// @param sections the debug sections of the binary file
+        /// @param unit_header the header of the unit in the .debug_info section
+        ///
+        constexpr Unit(DebugSections const & sections, UnitHeader const & unit_header)
+            : sections_(sections)
+        {
+            bool const is_64_bit = unit_header.is64bit();
+            size_t const length_size = is_64_bit ? decltype(UnitHeader::DataStructure64::unit_length)::end
+                                                 : decltype(UnitHeader::DataStructure32::unit_length)::end;
+
+            offset_ = unit_header.base_index();
+            end_offset_ = offset_ + length_size + unit_header.unit_length();
+            encoding_.version = unit_header.version();
+            encoding_.offset_size = is_64_bit ? sizeof(uint64_t) : sizeof(uint32_t);
+
+            if(encoding_.version >= 5) {
+                FullAndPartialCompilationUnitHeader const header(unit_header);
+                unit_type_ = header.unit_type();
+                encoding_.address_size = header.address_size();
+                debug_abbrev_offset_ = header.debug_abbrev_offset();
+
+                size_t index = offset_ + header.size();
+                if(unit_type_ == UnitHeaderUnitType::dw_ut_skeleton || unit_type_ == UnitHeaderUnitType::dw_ut_split_compile) {
+                    dwo_id_ = read_unsigned(sections_.debug_info, index, sizeof(uint64_t));
+                    index += sizeof(uint64_t);
+                }
+                else if(unit_type_ == UnitHeaderUnitType::dw_ut_type || unit_type_ == UnitHeaderUnitType::dw_ut_split_type) {
+                    type_signature_ = read_unsigned(sections_.debug_info, index, sizeof(uint64_t));
+                    index += sizeof(uint64_t);
+                    type_offset_ = read_unsigned(sections_.debug_info, index, encoding_.offset_size);
+                    index += encoding_.offset_size;
+                }
+
+                first_die_offset_ = index;
+            }
+            else
+            {   // unit_length, version, debug_abbrev_offset, address_size
+                size_t index = offset_ + length_size + sizeof(uint16_t);
+                unit_type_ = UnitHeaderUnitType::dw_ut_compile;
+                debug_abbrev_offset_ = read_unsigned(sections_.debug_info, index, encoding_.offset_size);
+                index += encoding_.offset_size;
+                encoding_.address_size = read_unsigned(sections_.debug_info, index, sizeof(uint8_t));
+                index += sizeof(uint8_t);
+
+                first_die_offset_ = index;
+            }
+
+            if(end_offset_ > sections_.debug_info.size()) [[unlikely]] {
+                throw std::range_error("parsing of .debug_info unit failed: unit_length out of bounds");
+            }
+
+            abbrev_table_ = DebugAbbrevTable(sections_.debug_abbrev, debug_abbrev_offset_);
+            abbrev_table_.set_attribute_offsets(encoding_);
+            read_bases();
+            count(ReaderCounter::units);
+        }
+
+        ///
+        /// @brief constructor of a split unit of a .dwo file
+        /// @details The addresses of a split unit are stored in the .debug_addr section of the
+        ///     binary file at the DW_AT_addr_base of its skeleton unit
+        /// @param sections the debug sections of the .dwo file
+        /// @param unit_header the header of the split unit in the .debug_info.dwo section
+        /// @param skeleton the skeleton unit in the binary file with the same dwo_id
+        ///
+        constexpr Unit(DebugSections const & sections, UnitHeader const & unit_header, Unit const & skeleton)
+            : Unit(with_debug_addr(sections, skeleton.sections_.debug_addr), unit_header)
+        {
+            addr_base_ = skeleton.addr_base_;
+        }
+
+        [[nodiscard]] constexpr auto
+        sections() const noexcept -> DebugSections const &
+        {
+            return sections_;
+        }
+
+        [[nodiscard]] constexpr auto
+        abbrev_table() const noexcept -> DebugAbbrevTable const &
+        {
+            return abbrev_table_;
+        }
+
+        [[nodiscard]] constexpr auto
+        encoding() const noexcept -> FormEncoding const &
+        {
+            return encoding_;
+        }
+
+        ///
+        /// @brief Returns the offset of the unit header in the .debug_info section
+        ///
+        [[nodiscard]] constexpr auto
+        offset() const noexcept -> size_t
+        {
+            return offset_;
+        }
+
+        ///
+        /// @brief Returns the offset of the first byte after the unit in the .debug_info section
+        ///
+        [[nodiscard]] constexpr auto
+        end_offset() const noexcept -> size_t
+        {
+            return end_offset_;
+        }
+
+        ///
+        /// @brief Returns the offset of the first debugging information entry of the unit
+        ///
+        [[nodiscard]] constexpr auto
+        first_die_offset() const noexcept -> size_t
+        {
+            return first_die_offset_;
+        }
+
+        [[nodiscard]] constexpr auto
+        version() const noexcept -> uint16_t
+        {
+            return encoding_.version;
+        }
+
+        [[nodiscard]] constexpr auto
+        unit_type() const noexcept -> UnitHeaderUnitType
+        {
+            return unit_type_;
+        }
+
+        [[nodiscard]] constexpr auto
+        address_size() const noexcept -> uint8_t
+        {
+            return encoding_.address_size;
+        }
+
+        [[nodiscard]] constexpr auto
+        offset_size() const noexcept -> uint8_t
+        {
+            return encoding_.offset_size;
+        }
+
+        [[nodiscard]] constexpr auto
+        debug_abbrev_offset() const noexcept -> uint64_t
+        {
+            return debug_abbrev_offset_;
+        }
+
+        ///
+        /// @brief The unit ID of a skeleton or split compilation unit
+        ///
+        [[nodiscard]] constexpr auto
+        dwo_id() const noexcept -> uint64_t
+        {
+            return dwo_id_;
+        }
+
+        ///
+        /// @brief The unique signature of the type described in a type unit
+        ///
+        [[nodiscard]] constexpr auto
+        type_signature() const noexcept -> uint64_t
+        {
+            return type_signature_;
+        }
+
+        ///
+        /// @brief The offset of the type described in a type unit relative to the beginning of the unit
+        ///
+        [[nodiscard]] constexpr auto
+        type_offset() const noexcept -> uint64_t
+        {
+            return type_offset_;
+        }
+
+        ///
+        /// @brief The value of DW_AT_str_offsets_base of the unit entry
+        ///
+        [[nodiscard]] constexpr auto
+        str_offsets_base() const noexcept -> uint64_t
+        {
+            return str_offsets_base_;
+        }
+
+        ///
+        /// @brief The value of DW_AT_addr_base of the unit entry
+        ///
+        [[nodiscard]] constexpr auto
+        addr_base() const noexcept -> uint64_t
+        {
+            return addr_base_;
+        }
+
+        ///
+        /// @brief The value of DW_AT_rnglists_base of the unit entry
+        ///
+        [[nodiscard]] constexpr auto
+        rnglists_base() const noexcept -> uint64_t
+        {
+            return rnglists_base_;
+        }
+
+        ///
+        /// @brief The value of DW_AT_loclists_base of the unit entry
+        ///
+        [[nodiscard]] constexpr auto
+        loclists_base() const noexcept -> uint64_t
+        {
+            return loclists_base_;
+        }
+
+    private:
+        [[nodiscard]] static constexpr auto
+        with_debug_addr(DebugSections sections, std::span<char const> const debug_addr) noexcept -> DebugSections
+        {
+            sections.debug_addr = debug_addr;
+            return sections;
+        }
+
+        ///
+        /// @brief Reads the attributes of the unit entry which are needed to decode the attributes
+        ///     of all other entries
+        ///
+        constexpr auto
+        read_bases() -> void
+        {
+            size_t index = first_die_offset_;
+            if(index >= end_offset_) {
+                return;
+            }
+
+            auto const [code, n] = details::uleb128<uint32_t>(sections_.debug_info, index);
+            index += n;
+
+            auto const * const abbrev = abbrev_table_.find(code);
+            if(abbrev == nullptr) {
+                return;
+            }
+
+            // In a split unit the offsets tables start directly after their header
+            if(unit_type_ == UnitHeaderUnitType::dw_ut_split_compile || unit_type_ == UnitHeaderUnitType::dw_ut_split_type) {
+                str_offsets_base_ = 2 * static_cast<uint64_t>(encoding_.offset_size);
+            }
+
+            for(auto const & specification : abbrev->attributes()) {
+                auto const value = read_form(sections_.debug_info, index, specification.form, specification.implicit_const, encoding_);
+
+                switch (specification.attribute)
+                {
+                case Attribute::dw_at_str_offsets_base:
+                    str_offsets_base_ = value.value;
+                    break;
+                case Attribute::dw_at_addr_base:
+                    addr_base_ = value.value;
+                    break;
+                case Attribute::dw_at_rnglists_base:
+                    rnglists_base_ = value.value;
+                    break;
+                case Attribute::dw_at_loclists_base:
+                    loclists_base_ = value.value;
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+        DebugSections sections_ = {};
+        DebugAbbrevTable abbrev_table_ = {};
+        FormEncoding encoding_ = {};
+        UnitHeaderUnitType unit_type_ = {};
+        size_t offset_ = 0;
+        size_t end_offset_ = 0;
+        size_t first_die_offset_ = 0;
+        uint64_t debug_abbrev_offset_ = 0;
+        uint64_t dwo_id_ = 0;
+        uint64_t type_signature_ = 0;
+        uint64_t type_offset_ = 0;
+        uint64_t str_offsets_base_ = 0;
+        uint64_t addr_base_ = 0;
+        uint64_t rnglists_base_ = 0;
+        uint64_t loclists_base_ = 0;
+    };
+}
@@ -95,7 +95,7 @@ namespace dwarf
         }
     };
 
-    std::ostream & operator<<(std::ostream & ost, FullAndPartialCompilationUnitHeader const & header) 
+    inline std::ostream & operator<<(std::ostream & ost, FullAndPartialCompilationUnitHeader const & header) 
     {
         // ost << static_cast<UnitHeader>(header);
 
@@ -9,6 +9,8 @@
 
 #include "dwarf/dwarf_tags.hpp"
 #include "details/type_list.hpp"
+#define MAGIC_ENUM_RANGE_MIN -128
+#define MAGIC_ENUM_RANGE_MAX 256
 #include "magic_enum.hpp"
 #include <span>
 #include <cassert>
@@ -61,7 +63,7 @@ namespace dwarf
         /// @param data the complete data of a binary .exe file
         ///
         explicit constexpr UnitHeader(std::span<char const> const data, size_t const index = 0) noexcept 
-            : data_(data), index_(index) {} 
+            : data_(data), index_(index), is_64_bit_(read_is64bit(data, index)) {} 
 
         // [[nodiscard]] constexpr auto
         // operator=(UnitHeader const & other) noexcept -> UnitHeader const &
@@ -82,11 +84,7 @@ namespace dwarf
         [[nodiscard]] constexpr auto
         is64bit() const noexcept -> bool
         {
-            constexpr DataStructure64 header64bit = {};
-
-            auto const identifier = decltype(DataStructure64::identifier)::bit_cast(data_, base_index());
-
-            return identifier == header64bit.identifier.val;
+            return is_64_bit_;
         }
 
 
@@ -191,8 +189,9 @@ namespace dwarf
         [[nodiscard]] constexpr auto
         next() const noexcept -> UnitHeader 
         {   
-            size_t const next_index = index_ + 4 + unit_length();
-            if(next_index >= data_.size()) {
+            size_t const length_size = is64bit() ? decltype(DataStructure64::unit_length)::end : decltype(DataStructure32::unit_length)::end;
+            size_t const next_index = index_ + length_size + unit_length();
+            if(next_index + decltype(DataStructure32::unit_length)::end > data_.size()) {
                 return UnitHeader();
             }
 
@@ -239,9 +238,26 @@ namespace dwarf
         /// @brief the binary data of the .debug_line section
         std::span<char const> data_ = {};
         size_t index_ = 0;
+        /// @brief the format is read once, all offsets in the header depend on it
+        bool is_64_bit_ = false;
+
+    private:
+        [[nodiscard]] static constexpr auto
+        read_is64bit(std::span<char const> const data, size_t const index) noexcept -> bool
+        {
+            constexpr DataStructure64 header64bit = {};
+
+            if(index + decltype(DataStructure64::identifier)::end > data.size()) {
+                return false;
+            }
+
+            auto const identifier = decltype(DataStructure64::identifier)::bit_cast(data, index);
+
+            return identifier == header64bit.identifier.val;
+        }
     };
 
-    std::ostream & operator<<(std::ostream & ost, UnitHeader const & unit_header) 
+    inline std::ostream & operator<<(std::ostream & ost, UnitHeader const & unit_header) 
     {
         ost << "address: " << unit_header.base_index() << " (0x" << std::hex << unit_header.base_index() << std::dec << ")" << std::endl;
         ost << "is64bit:     " << std::boolalpha << unit_header.is64bit() << std::noboolalpha << std::endl;
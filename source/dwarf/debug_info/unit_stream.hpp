@@ -0,0 +1,259 @@
+///
+/// @file:   unit_stream.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Reads the units of a .debug_info section from a stream of bytes
+///
+
+#pragma once
+
+#include "dwarf/debug_info/unit.hpp"
+#include "details/type_list.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstring>
+#include <istream>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+namespace dwarf
+{
+    ///
+    /// @brief A source of bytes, reads at most buffer.size() bytes into the buffer
+    /// @details Returns the number of bytes read, 0 at the end of the data
+    ///
+    template<typename T>
+    concept ByteSource = requires(T & source, std::span<char> const buffer) {
+        { source(buffer) } -> std::convertible_to<size_t>;
+    };
+
+    /// @class dwarf::IstreamSource
+    ///
+    /// @brief Reads bytes from a std::istream, e.g. std::cin connected to a pipe
+    /// @details Blocks until the buffer is full or the stream ends. readsome() is not used, it
+    ///     returns 0 for std::cin and pipes as their stream buffers report no available characters.
+    ///
+    class IstreamSource final
+    {
+    public:
+        explicit IstreamSource(std::istream & stream) noexcept
+            : stream_(&stream) {}
+
+        auto
+        operator()(std::span<char> const buffer) -> size_t
+        {
+            if(!stream_->good()) {
+                return 0;
+            }
+
+            stream_->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            return static_cast<size_t>(stream_->gcount());
+        }
+
+    private:
+        std::istream * stream_ = nullptr;
+    };
+
+#if !defined(_WIN32)
+    /// @class dwarf::FileDescriptorSource
+    ///
+    /// @brief Reads bytes from a file descriptor, e.g. the read end of a pipe
+    ///
+    class FileDescriptorSource final
+    {
+    public:
+        explicit FileDescriptorSource(int const fd) noexcept
+            : fd_(fd) {}
+
+        auto
+        operator()(std::span<char> const buffer) -> size_t
+        {
+            while(true) {
+                auto const count = ::read(fd_, buffer.data(), buffer.size());
+                if(count >= 0) {
+                    return static_cast<size_t>(count);
+                }
+                if(errno != EINTR) {
+                    throw std::range_error("unit stream: read failed");
+                }
+            }
+        }
+
+    private:
+        int fd_ = -1;
+    };
+#endif
+
+    /// @class dwarf::StreamedUnit
+    ///
+    /// @brief A complete unit read from a dwarf::UnitStream
+    ///
+    struct StreamedUnit final
+    {
+        /// @brief The offset of the unit header in the .debug_info section
+        size_t offset = 0;
+        /// @brief The unit header and all entries of the unit
+        std::span<char const> data = {};
+    };
+
+    /// @class dwarf::UnitStream
+    ///
+    /// @brief Reads the units of a .debug_info section one after the other from a byte source,
+    ///     without buffering the whole section
+    /// @details A unit is returned as soon as all of its bytes are read. Only the current unit and
+    ///     the start of the next one are buffered, so the memory is bounded by the largest unit
+    ///     or the chunk size. The data of a unit is valid until the next call to next().
+    ///
+    template<ByteSource Source>
+    class UnitStream final
+    {
+    public:
+        static constexpr size_t default_max_unit_size = size_t{1} << 30;
+
+        ///
+        /// @brief constructor
+        /// @param source the bytes of the .debug_info section
+        /// @param sections the other debug sections needed to read the entries, e.g. .debug_abbrev
+        /// @param chunk_size the number of bytes requested from the source at once
+        /// @param max_unit_size the size of the largest accepted unit, the buffer never grows beyond it
+        ///
+        explicit UnitStream(Source source, DebugSections const & sections = {}, size_t const chunk_size = 64 * 1024,
+            size_t const max_unit_size = default_max_unit_size)
+            : source_(std::move(source)), sections_(sections), chunk_size_(std::max<size_t>(chunk_size, 16)),
+              max_unit_size_(max_unit_size) {}
+
+        ///
+        /// @brief Reads the next unit
+        /// @return the unit or std::nullopt at the end of the data
+        ///
+        auto
+        next() -> std::optional<StreamedUnit>
+        {
+            begin_ += size_;
+            offset_ += size_;
+            size_ = 0;
+
+            if(!fill(sizeof(uint32_t))) {
+                if(end_ != begin_) {
+                    throw std::range_error("unit stream: unit header truncated");
+                }
+                return std::nullopt;
+            }
+
+            // the initial length, 0xffffffff is followed by the 64-bit length
+            uint64_t unit_length = ::details::bit_cast<uint32_t>(buffered(), 0);
+            size_t length_size = sizeof(uint32_t);
+            if(unit_length == 0xffffffff) {
+                if(!fill(sizeof(uint32_t) + sizeof(uint64_t))) {
+                    throw std::range_error("unit stream: unit header truncated");
+                }
+                unit_length = ::details::bit_cast<uint64_t>(buffered(), sizeof(uint32_t));
+                length_size += sizeof(uint64_t);
+            }
+
+            // a corrupt length must not allocate the buffer before the data is read
+            if(unit_length > max_unit_size_ - std::min(max_unit_size_, length_size)) {
+                throw std::range_error("unit stream: unit_length out of bounds");
+            }
+            size_t const length = unit_length + length_size;
+
+            if(!fill(length)) {
+                throw std::range_error("unit stream: unit data truncated");
+            }
+
+            size_ = length;
+            return StreamedUnit{offset_, buffered().first(length)};
+        }
+
+        ///
+        /// @brief Returns a unit to read the entries of a streamed unit
+        /// @details The offsets of the entries are relative to the unit header, add
+        ///     dwarf::StreamedUnit::offset to get the offset in the .debug_info section
+        ///
+        [[nodiscard]] auto
+        unit(StreamedUnit const & streamed_unit) const -> Unit
+        {
+            DebugSections sections = sections_;
+            sections.debug_info = streamed_unit.data;
+            return Unit(sections, UnitHeader(sections.debug_info));
+        }
+
+        ///
+        /// @brief Returns the number of bytes read from the source
+        ///
+        [[nodiscard]] auto
+        bytes_read() const noexcept -> size_t
+        {
+            return offset_ + (end_ - begin_);
+        }
+
+        ///
+        /// @brief Returns the size of the buffer, the largest unit or the chunk size
+        ///
+        [[nodiscard]] auto
+        buffer_size() const noexcept -> size_t
+        {
+            return buffer_.size();
+        }
+
+    private:
+        [[nodiscard]] auto
+        buffered() const noexcept -> std::span<char const>
+        {
+            return std::span<char const>(buffer_).subspan(begin_, end_ - begin_);
+        }
+
+        ///
+        /// @brief Reads from the source until at least size bytes are buffered
+        /// @return false if the source ended before
+        ///
+        auto
+        fill(size_t const size) -> bool
+        {
+            if(end_ - begin_ >= size) {
+                return true;
+            }
+
+            // moves the start of the unit to the front of the buffer
+            if(begin_ > 0) {
+                std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+                end_ -= begin_;
+                begin_ = 0;
+            }
+
+            if(buffer_.size() < std::max(size, chunk_size_)) {
+                buffer_.resize(std::max(size, chunk_size_));
+            }
+
+            while(end_ < size) {
+                size_t const count = source_(std::span<char>(buffer_).subspan(end_));
+                if(count == 0) {
+                    return false;
+                }
+                end_ += count;
+            }
+
+            return true;
+        }
+
+        Source source_;
+        DebugSections sections_ = {};
+        size_t chunk_size_ = 0;
+        size_t max_unit_size_ = default_max_unit_size;
+
+        std::vector<char> buffer_;
+        /// @brief The buffered bytes not returned yet
+        size_t begin_ = 0;
+        size_t end_ = 0;
+        /// @brief The size of the unit returned last
+        size_t size_ = 0;
+        /// @brief The offset of buffer_[begin_] in the section
+        size_t offset_ = 0;
+    };
+}
@@ -0,0 +1,263 @@
+///
+/// @file:   line_header.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The header of a line number program with its directory and file name tables
+///
+
+#pragma once
+
+#include "dwarf/debug_info/attribute_value.hpp"
+#include <array>
+#include <string>
+#include <vector>
+
+namespace dwarf
+{
+    /// @class dwarf::LineFile
+    ///
+    /// @brief An entry of the file name table of a line number program
+    ///
+    struct LineFile final
+    {
+        std::string_view name = {};
+        /// @brief The index into the directory table
+        uint64_t directory = 0;
+    };
+
+    /// @class dwarf::LineParameters
+    ///
+    /// @brief The fields of a line number program header that control the decoding of the program
+    ///
+    struct LineParameters final
+    {
+        uint8_t address_size = 8;
+        uint8_t minimum_instruction_length = 1;
+        /// @brief 1 for all architectures but VLIW ones
+        uint8_t maximum_operations_per_instruction = 1;
+        bool default_is_stmt = true;
+        int8_t line_base = 0;
+        uint8_t line_range = 1;
+        /// @brief The number of the first special opcode
+        uint8_t opcode_base = 1;
+        /// @brief The number of LEB128 operands of each standard opcode, indexed by opcode - 1
+        std::array<uint8_t, 255> standard_opcode_lengths = {};
+    };
+
+    /// @class dwarf::LineHeader
+    ///
+    /// @brief The header of a line number program in the .debug_line section
+    /// @details The line number program behind the header is decoded by dwarf::line_rows(). In
+    ///     DWARF 5 the tables start with the primary source file and the compilation directory at
+    ///     index 0, before DWARF 5 the file names start at index 1 and directory 0 is the
+    ///     compilation directory of the unit.
+    ///
+    class LineHeader final
+    {
+    public:
+        ///
+        /// @brief Reads the header of a line number program
+        /// @param unit the unit referring to the line number program, resolves strings of other sections
+        /// @param offset the offset of the line number program in the .debug_line section, the value of DW_AT_stmt_list
+        /// @param compilation_directory the value of DW_AT_comp_dir, directory 0 before DWARF 5
+        ///
+        LineHeader(Unit const & unit, uint64_t const offset, std::string_view const compilation_directory = {})
+        {
+            auto const & data = unit.sections().debug_line;
+            size_t index = offset;
+
+            FormEncoding encoding = {};
+            uint64_t unit_length = read_unsigned(data, index, sizeof(uint32_t));
+            index += sizeof(uint32_t);
+            if(unit_length == 0xffffffff) {
+                unit_length = read_unsigned(data, index, sizeof(uint64_t));
+                index += sizeof(uint64_t);
+                encoding.offset_size = sizeof(uint64_t);
+            }
+            if(unit_length > data.size() - index) [[unlikely]] {
+                throw std::range_error("parsing of .debug_line header failed: unit_length out of bounds");
+            }
+            auto const end = index + unit_length;
+
+            version_ = static_cast<uint16_t>(read_unsigned(data, index, sizeof(uint16_t)));
+            index += sizeof(uint16_t);
+            encoding.version = version_;
+            encoding.address_size = unit.address_size();
+            if(version_ >= 5) {
+                encoding.address_size = static_cast<uint8_t>(read_unsigned(data, index, sizeof(uint8_t)));
+                // address_size, segment_selector_size
+                index += 2;
+            }
+
+            auto const header_length = read_unsigned(data, index, encoding.offset_size);
+            index += encoding.offset_size;
+            if(header_length > end - index) [[unlikely]] {
+                throw std::range_error("parsing of .debug_line header failed: header_length out of bounds");
+            }
+            program_ = data.subspan(index + header_length, end - index - header_length);
+
+            parameters_.address_size = encoding.address_size;
+            auto const read_byte = [&]() {
+                return static_cast<uint8_t>(read_unsigned(data, index++, sizeof(uint8_t)));
+            };
+            parameters_.minimum_instruction_length = read_byte();
+            parameters_.maximum_operations_per_instruction = version_ >= 4 ? read_byte() : 1;
+            parameters_.default_is_stmt = read_byte() != 0;
+            parameters_.line_base = static_cast<int8_t>(read_byte());
+            parameters_.line_range = read_byte();
+            parameters_.opcode_base = read_byte();
+            if(parameters_.line_range == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_line header failed: line_range is 0");
+            }
+            for(size_t i = 1; i < parameters_.opcode_base; ++i) {
+                parameters_.standard_opcode_lengths[i - 1] = read_byte();
+            }
+
+            auto const table = data.first(end);
+            if(version_ >= 5) {
+                read_entries(unit, table, index, encoding, [&](LineFile const & entry) { directories_.push_back(entry.name); });
+                read_entries(unit, table, index, encoding, [&](LineFile const & entry) { files_.push_back(entry); });
+            }
+            else {
+                directories_.push_back(compilation_directory);
+                while(index < table.size() && table[index] != '\0') {
+                    directories_.push_back(read_string(table, index));
+                    index += directories_.back().size() + 1;
+                }
+                ++index;
+
+                // file names start at index 1
+                files_.emplace_back();
+                while(index < table.size() && table[index] != '\0') {
+                    LineFile entry = {};
+                    entry.name = read_string(table, index);
+                    index += entry.name.size() + 1;
+                    entry.directory = read_uleb128(table, index);
+                    // modification time, file length
+                    static_cast<void>(read_uleb128(table, index));
+                    static_cast<void>(read_uleb128(table, index));
+                    files_.push_back(entry);
+                }
+            }
+        }
+
+        [[nodiscard]] auto
+        version() const noexcept -> uint16_t
+        {
+            return version_;
+        }
+
+        [[nodiscard]] auto
+        parameters() const noexcept -> LineParameters const &
+        {
+            return parameters_;
+        }
+
+        ///
+        /// @brief Returns the opcodes of the line number program behind the header
+        ///
+        [[nodiscard]] auto
+        program() const noexcept -> std::span<char const>
+        {
+            return program_;
+        }
+
+        ///
+        /// @brief Returns the number of entries of the file name table, including the unused entry 0 before DWARF 5
+        ///
+        [[nodiscard]] auto
+        file_count() const noexcept -> size_t
+        {
+            return files_.size();
+        }
+
+        ///
+        /// @brief Returns an entry of the file name table
+        /// @return an empty entry if the index is out of bounds
+        ///
+        [[nodiscard]] auto
+        file(uint64_t const index) const noexcept -> LineFile
+        {
+            return index < files_.size() ? files_[index] : LineFile{};
+        }
+
+        ///
+        /// @brief Returns an entry of the directory table, the compilation directory for directory 0 before DWARF 5
+        ///
+        [[nodiscard]] auto
+        directory(uint64_t const index) const noexcept -> std::string_view
+        {
+            return index < directories_.size() ? directories_[index] : std::string_view();
+        }
+
+        ///
+        /// @brief Returns the name of a file joined to its directory unless the name is an absolute path
+        ///
+        [[nodiscard]] auto
+        file_path(uint64_t const index) const -> std::string
+        {
+            auto const entry = file(index);
+            auto const dir = directory(entry.directory);
+            if(dir.empty() || entry.name.empty() || entry.name.starts_with('/') || (entry.name.size() > 1 && entry.name[1] == ':')) {
+                return std::string(entry.name);
+            }
+
+            std::string res(dir);
+            if(res.back() != '/' && res.back() != '\\') {
+                res += '/';
+            }
+            res += entry.name;
+            return res;
+        }
+
+    private:
+        uint16_t version_ = 0;
+        LineParameters parameters_ = {};
+        std::span<char const> program_ = {};
+        std::vector<std::string_view> directories_;
+        std::vector<LineFile> files_;
+
+        [[nodiscard]] static auto
+        read_uleb128(std::span<char const> const data, size_t & index) -> uint64_t
+        {
+            auto const [val, n] = ::details::uleb128<uint64_t>(data, index);
+            if(n == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_line header failed: uleb128 wrong format");
+            }
+            index += n;
+            return val;
+        }
+
+        ///
+        /// @brief Reads a DWARF 5 entry format description and the entries described by it
+        ///
+        template<typename FUNC_T>
+        static auto
+        read_entries(Unit const & unit, std::span<char const> const data, size_t & index, FormEncoding const & encoding, FUNC_T && func) -> void
+        {
+            auto const format_count = read_unsigned(data, index, sizeof(uint8_t));
+            ++index;
+            std::vector<std::pair<LineNumberHeaderEntryFormat, Form>> formats;
+            for(size_t i = 0; i < format_count; ++i) {
+                auto const content_type = static_cast<LineNumberHeaderEntryFormat>(read_uleb128(data, index));
+                auto const form = static_cast<Form>(read_uleb128(data, index));
+                formats.emplace_back(content_type, form);
+            }
+
+            auto const count = read_uleb128(data, index);
+            for(size_t i = 0; i < count; ++i) {
+                LineFile entry = {};
+                for(auto const & [content_type, form] : formats) {
+                    AttributeValue const value(unit, read_form(data, index, form, 0, encoding));
+                    if(content_type == LineNumberHeaderEntryFormat::dw_lnct_path) {
+                        entry.name = value.as_string();
+                    }
+                    else if(content_type == LineNumberHeaderEntryFormat::dw_lnct_directory_index) {
+                        entry.directory = value.as_unsigned();
+                    }
+                }
+                func(entry);
+            }
+        }
+    };
+}
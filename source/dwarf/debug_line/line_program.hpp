@@ -0,0 +1,199 @@
+///
+/// @file:   line_program.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Decodes the rows of a line number program on demand
+///
+
+#pragma once
+
+#include "dwarf/debug_info/die.hpp"
+#include "dwarf/debug_line/line_header.hpp"
+#include "details/generator.hpp"
+#include <algorithm>
+
+namespace dwarf
+{
+    /// @class dwarf::LineRow
+    ///
+    /// @brief A row of the line number table, the state of the line number state machine when a row is appended
+    ///
+    struct LineRow final
+    {
+        uint64_t address = 0;
+        /// @brief The index of an operation in a VLIW instruction, 0 on all other architectures
+        uint64_t op_index = 0;
+        /// @brief The index into the file name table of the dwarf::LineHeader
+        uint64_t file = 1;
+        uint64_t line = 1;
+        uint64_t column = 0;
+        uint64_t isa = 0;
+        uint64_t discriminator = 0;
+        bool is_stmt = false;
+        bool basic_block = false;
+        /// @brief The address is the first byte after the end of a sequence of instructions
+        bool end_sequence = false;
+        bool prologue_end = false;
+        bool epilogue_begin = false;
+    };
+
+    ///
+    /// @brief Runs the line number state machine and yields each row appended to the line number table
+    /// @details The rows are decoded when the consumer advances, so a search for an address stops
+    ///     decoding at the first matching row. The header is moved into the coroutine, the
+    ///     sections it refers to must outlive the generator.
+    /// @param header the header of the line number program
+    ///
+    inline auto
+    line_rows(LineHeader header) -> ::details::Generator<LineRow>
+    {
+        auto const & parameters = header.parameters();
+        auto const data = header.program();
+        auto const max_ops = std::max<uint64_t>(parameters.maximum_operations_per_instruction, 1);
+
+        LineRow row = {};
+        row.is_stmt = parameters.default_is_stmt;
+
+        auto const advance = [&](uint64_t const operation_advance) {
+            if(max_ops == 1) {
+                row.address += parameters.minimum_instruction_length * operation_advance;
+            }
+            else {
+                row.address += parameters.minimum_instruction_length * ((row.op_index + operation_advance) / max_ops);
+                row.op_index = (row.op_index + operation_advance) % max_ops;
+            }
+        };
+        size_t index = 0;
+        auto const read_uleb128 = [&]() {
+            auto const [val, n] = ::details::uleb128<uint64_t>(data, index);
+            if(n == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_line program failed: uleb128 wrong format");
+            }
+            index += n;
+            return val;
+        };
+        auto const read_sleb128 = [&]() {
+            auto const [val, n] = ::details::sleb128<int64_t>(data, index);
+            if(n == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_line program failed: sleb128 wrong format");
+            }
+            index += n;
+            return val;
+        };
+        auto const reset_flags = [&]() {
+            row.basic_block = false;
+            row.prologue_end = false;
+            row.epilogue_begin = false;
+            row.discriminator = 0;
+        };
+
+        while(index < data.size()) {
+            auto const opcode = static_cast<uint8_t>(data[index++]);
+
+            if(opcode >= parameters.opcode_base) {
+                // special opcode
+                auto const adjusted_opcode = static_cast<uint8_t>(opcode - parameters.opcode_base);
+                advance(adjusted_opcode / parameters.line_range);
+                row.line += static_cast<uint64_t>(parameters.line_base + adjusted_opcode % parameters.line_range);
+                co_yield row;
+                reset_flags();
+                continue;
+            }
+
+            if(opcode == 0) {
+                // extended opcode
+                auto const length = read_uleb128();
+                if(length == 0 || length > data.size() - index) [[unlikely]] {
+                    throw std::range_error("parsing of .debug_line program failed: extended opcode out of bounds");
+                }
+                auto const end = index + length;
+                auto const extended_opcode = static_cast<LineNumberOpcode>(data[index++]);
+                switch(extended_opcode) {
+                    case LineNumberOpcode::dw_lne_end_sequence:
+                        row.end_sequence = true;
+                        co_yield row;
+                        row = LineRow{};
+                        row.is_stmt = parameters.default_is_stmt;
+                        break;
+                    case LineNumberOpcode::dw_lne_set_address:
+                        row.address = read_unsigned(data, index, end - index);
+                        row.op_index = 0;
+                        break;
+                    case LineNumberOpcode::dw_lne_set_discriminator:
+                        row.discriminator = read_uleb128();
+                        break;
+                    default:
+                        // DW_LNE_define_file before DWARF 5 and vendor extensions
+                        break;
+                }
+                index = end;
+                continue;
+            }
+
+            switch(static_cast<LineNumberInformation>(opcode)) {
+                case LineNumberInformation::dw_lns_copy:
+                    co_yield row;
+                    reset_flags();
+                    break;
+                case LineNumberInformation::dw_lns_advance_pc:
+                    advance(read_uleb128());
+                    break;
+                case LineNumberInformation::dw_lns_advance_line:
+                    row.line += static_cast<uint64_t>(read_sleb128());
+                    break;
+                case LineNumberInformation::dw_lns_set_file:
+                    row.file = read_uleb128();
+                    break;
+                case LineNumberInformation::dw_lns_set_column:
+                    row.column = read_uleb128();
+                    break;
+                case LineNumberInformation::dw_lns_negate_stmt:
+                    row.is_stmt = !row.is_stmt;
+                    break;
+                case LineNumberInformation::dw_lns_set_basic_block:
+                    row.basic_block = true;
+                    break;
+                case LineNumberInformation::dw_lns_const_add_pc:
+                    advance((255 - parameters.opcode_base) / parameters.line_range);
+                    break;
+                case LineNumberInformation::dw_lns_fixed_advance_pc:
+                    row.address += read_unsigned(data, index, sizeof(uint16_t));
+                    index += sizeof(uint16_t);
+                    row.op_index = 0;
+                    break;
+                case LineNumberInformation::dw_lns_set_prologue_end:
+                    row.prologue_end = true;
+                    break;
+                case LineNumberInformation::dw_lns_set_epilogue_begin:
+                    row.epilogue_begin = true;
+                    break;
+                case LineNumberInformation::dw_lns_set_isa:
+                    row.isa = read_uleb128();
+                    break;
+                default:
+                    // an opcode of a later version, skipped by its number of operands
+                    for(size_t i = 0; i < parameters.standard_opcode_lengths[opcode - 1]; ++i) {
+                        static_cast<void>(read_uleb128());
+                    }
+                    break;
+            }
+        }
+    }
+
+    ///
+    /// @brief Yields the rows of the line number program of a unit
+    /// @return an empty range if the unit has no DW_AT_stmt_list
+    ///
+    inline auto
+    line_rows(Unit const & unit) -> ::details::Generator<LineRow>
+    {
+        DIE const root(unit, unit.first_die_offset());
+        auto const stmt_list = root.attribute(Attribute::dw_at_stmt_list);
+        if(!stmt_list.is_valid()) {
+            return {};
+        }
+
+        auto const comp_dir = root.attribute(Attribute::dw_at_comp_dir);
+        return line_rows(LineHeader(unit, stmt_list.as_unsigned(), comp_dir.is_valid() ? comp_dir.as_string() : std::string_view()));
+    }
+}
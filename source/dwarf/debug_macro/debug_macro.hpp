@@ -0,0 +1,594 @@
+///
+/// @file:   debug_macro.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The macro information of the .debug_macro section and an index of the macros defined at
+///          a source location
+///
+
+#pragma once
+
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/die.hpp"
+#include "dwarf/debug_line/line_header.hpp"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dwarf
+{
+    /// @class dwarf::MacroEntry
+    ///
+    /// @brief An entry of a macro information table
+    /// @details The text points into the .debug_macro or a string section
+    ///
+    struct MacroEntry final
+    {
+        MacroInformation opcode = {};
+        /// @brief The source line of a definition, an undefinition or an inclusion of a file
+        uint64_t line = 0;
+        /// @brief The index into the file name table of the line number program of an inclusion
+        uint64_t file = 0;
+        /// @brief The name and the definition of a macro, e.g. "SQUARE(x) ((x) * (x))", only the name
+        ///     of an undefinition
+        std::string_view text = {};
+        /// @brief The offset of the imported table in the .debug_macro section
+        uint64_t offset = 0;
+
+        [[nodiscard]] constexpr auto
+        is_define() const noexcept -> bool
+        {
+            return opcode == MacroInformation::dw_macro_define || opcode == MacroInformation::dw_macro_define_strp
+                || opcode == MacroInformation::dw_macro_define_strx || opcode == MacroInformation::dw_macro_define_sup;
+        }
+
+        [[nodiscard]] constexpr auto
+        is_undef() const noexcept -> bool
+        {
+            return opcode == MacroInformation::dw_macro_undef || opcode == MacroInformation::dw_macro_undef_strp
+                || opcode == MacroInformation::dw_macro_undef_strx || opcode == MacroInformation::dw_macro_undef_sup;
+        }
+
+        ///
+        /// @brief Returns the name of the macro, without the parameters of a function-like macro
+        ///
+        [[nodiscard]] constexpr auto
+        name() const noexcept -> std::string_view
+        {
+            return text.substr(0, text.find_first_of(" ("));
+        }
+
+        ///
+        /// @brief Returns the replacement list of a definition
+        ///
+        [[nodiscard]] constexpr auto
+        definition() const noexcept -> std::string_view
+        {
+            auto position = text.find_first_of(" (");
+            if(position != std::string_view::npos && text[position] == '(') {
+                position = text.find(')', position);
+                position = position != std::string_view::npos ? text.find(' ', position) : position;
+            }
+            return position != std::string_view::npos ? text.substr(position + 1) : std::string_view();
+        }
+    };
+
+    /// @class dwarf::MacroTable
+    ///
+    /// @brief A macro information table of the .debug_macro section, a DWARF 5 table or a GNU
+    ///     extension table of version 4
+    /// @details The table of a unit refers to the line number program whose file name table the
+    ///     inclusions of files refer to. A table imported by the tables of several units, e.g. the
+    ///     predefined macros or the macros of a common header, has no line number program.
+    ///
+    class MacroTable final
+    {
+    public:
+        ///
+        /// @brief Reads the entries of a table
+        /// @param unit the unit referring to the table, resolves strings of other sections
+        /// @param offset the offset of the table in the .debug_macro section
+        ///
+        MacroTable(Unit const & unit, uint64_t const offset)
+            : offset_(offset)
+        {
+            auto const & data = unit.sections().debug_macro;
+            size_t index = offset;
+
+            version_ = static_cast<uint16_t>(read_unsigned(data, index, sizeof(uint16_t)));
+            if(version_ != 4 && version_ != 5) [[unlikely]] {
+                throw std::range_error("parsing of .debug_macro header failed: unsupported version");
+            }
+            auto const flags = read_unsigned(data, index + sizeof(uint16_t), sizeof(uint8_t));
+            index += sizeof(uint16_t) + sizeof(uint8_t);
+
+            FormEncoding encoding = unit.encoding();
+            encoding.offset_size = (flags & offset_size_flag) != 0 ? sizeof(uint64_t) : sizeof(uint32_t);
+            offset_size_ = encoding.offset_size;
+            if((flags & debug_line_offset_flag) != 0) {
+                line_offset_ = read_unsigned(data, index, offset_size_);
+                index += offset_size_;
+            }
+
+            // the forms of the operands of vendor extensions
+            std::array<std::vector<Form>, 256> operands = {};
+            std::array<bool, 256> is_described = {};
+            if((flags & opcode_operands_table_flag) != 0) {
+                auto const count = read_unsigned(data, index, sizeof(uint8_t));
+                ++index;
+                for(size_t i = 0; i < count; ++i) {
+                    auto const opcode = read_unsigned(data, index, sizeof(uint8_t));
+                    ++index;
+                    is_described[opcode] = true;
+                    auto const forms = read_uleb128(data, index);
+                    for(size_t j = 0; j < forms; ++j) {
+                        operands[opcode].push_back(static_cast<Form>(read_unsigned(data, index, sizeof(uint8_t))));
+                        ++index;
+                    }
+                }
+            }
+
+            auto const resolve = [&](Form const form, uint64_t const value) {
+                return AttributeValue(unit, FormValue{form, value, {}}).as_string();
+            };
+
+            while(true) {
+                auto const opcode = static_cast<uint8_t>(read_unsigned(data, index, sizeof(uint8_t)));
+                ++index;
+                if(opcode == 0) {
+                    break;
+                }
+
+                MacroEntry entry = {};
+                entry.opcode = static_cast<MacroInformation>(opcode);
+                switch (entry.opcode)
+                {
+                case MacroInformation::dw_macro_define:
+                case MacroInformation::dw_macro_undef:
+                    entry.line = read_uleb128(data, index);
+                    entry.text = read_string(data, index);
+                    index += entry.text.size() + 1;
+                    break;
+                case MacroInformation::dw_macro_define_strp:
+                case MacroInformation::dw_macro_undef_strp:
+                    entry.line = read_uleb128(data, index);
+                    entry.text = resolve(Form::dw_form_strp, read_unsigned(data, index, offset_size_));
+                    index += offset_size_;
+                    break;
+                case MacroInformation::dw_macro_define_strx:
+                case MacroInformation::dw_macro_undef_strx:
+                    entry.line = read_uleb128(data, index);
+                    entry.text = resolve(Form::dw_form_strx, read_uleb128(data, index));
+                    break;
+                case MacroInformation::dw_macro_define_sup:
+                case MacroInformation::dw_macro_undef_sup:
+                    // the string is in the supplementary object file, which is not read
+                    entry.line = read_uleb128(data, index);
+                    index += offset_size_;
+                    break;
+                case MacroInformation::dw_macro_start_file:
+                    entry.line = read_uleb128(data, index);
+                    entry.file = read_uleb128(data, index);
+                    break;
+                case MacroInformation::dw_macro_end_file:
+                    break;
+                case MacroInformation::dw_macro_import:
+                case MacroInformation::dw_macro_import_sup:
+                    entry.offset = read_unsigned(data, index, offset_size_);
+                    index += offset_size_;
+                    break;
+                default:
+                    if(!is_described[opcode]) [[unlikely]] {
+                        throw std::range_error("parsing of .debug_macro entry failed: unknown opcode");
+                    }
+                    for(auto const form : operands[opcode]) {
+                        static_cast<void>(read_form(data, index, form, 0, encoding));
+                    }
+                    continue;
+                }
+                entries_.push_back(entry);
+            }
+
+            size_ = index - offset;
+        }
+
+        [[nodiscard]] auto
+        offset() const noexcept -> uint64_t
+        {
+            return offset_;
+        }
+
+        ///
+        /// @brief Returns the size of the table in bytes
+        ///
+        [[nodiscard]] auto
+        size() const noexcept -> uint64_t
+        {
+            return size_;
+        }
+
+        [[nodiscard]] auto
+        version() const noexcept -> uint16_t
+        {
+            return version_;
+        }
+
+        [[nodiscard]] auto
+        offset_size() const noexcept -> uint8_t
+        {
+            return offset_size_;
+        }
+
+        ///
+        /// @brief Returns the offset of the line number program in the .debug_line section
+        /// @return std::nullopt for an imported table
+        ///
+        [[nodiscard]] auto
+        line_offset() const noexcept -> std::optional<uint64_t>
+        {
+            return line_offset_;
+        }
+
+        ///
+        /// @brief Returns the entries without the entries of vendor extensions
+        ///
+        [[nodiscard]] auto
+        entries() const noexcept -> std::span<MacroEntry const>
+        {
+            return entries_;
+        }
+
+    private:
+        static constexpr uint8_t offset_size_flag = 0x01;
+        static constexpr uint8_t debug_line_offset_flag = 0x02;
+        static constexpr uint8_t opcode_operands_table_flag = 0x04;
+
+        uint64_t offset_ = 0;
+        uint64_t size_ = 0;
+        uint16_t version_ = 0;
+        uint8_t offset_size_ = sizeof(uint32_t);
+        std::optional<uint64_t> line_offset_ = {};
+        std::vector<MacroEntry> entries_;
+
+        [[nodiscard]] static auto
+        read_uleb128(std::span<char const> const data, size_t & index) -> uint64_t
+        {
+            auto const [val, n] = ::details::uleb128<uint64_t>(data, index);
+            if(n == 0) [[unlikely]] {
+                throw std::range_error("parsing of .debug_macro entry failed: uleb128 wrong format");
+            }
+            index += n;
+            return val;
+        }
+    };
+
+    /// @class dwarf::UnitMacros
+    ///
+    /// @brief The macros of a unit, indexed to find the macros defined at a source location
+    /// @details The table of the unit and the tables it imports are replayed once. Each definition
+    ///     and undefinition gets the next position of the replay, and each name keeps its
+    ///     definitions and undefinitions in the order of their position. Each inclusion of a file
+    ///     keeps the lines of its entries with the position behind them, the position behind a
+    ///     nested inclusion for the line of the inclusion. A source location is translated to a
+    ///     position by a binary search of the lines of the first inclusion of the file, a name is
+    ///     looked up at a position by a binary search of its definitions. A definition at the line
+    ///     of the location is not yet defined at the location.
+    ///
+    class UnitMacros final
+    {
+    public:
+        ///
+        /// @brief Builds the index of the macros of a unit
+        /// @param unit the unit with a DW_AT_macros attribute
+        /// @param offset the offset of the table of the unit in the .debug_macro section
+        /// @param load returns the table at an offset, shared by all units importing it
+        ///
+        template<typename LOAD_T>
+        UnitMacros(Unit const & unit, uint64_t const offset, LOAD_T && load)
+            : unit_offset_(unit.offset())
+        {
+            auto const table = load(offset);
+            tables_.push_back(table);
+            if(auto const line_offset = table->line_offset(); line_offset.has_value()) {
+                auto const compilation_directory = DIE(unit, unit.first_die_offset()).attribute(Attribute::dw_at_comp_dir);
+                LineHeader const line_header(unit, *line_offset,
+                    compilation_directory.is_valid() ? compilation_directory.as_string() : std::string_view());
+                for(size_t i = 0; i < line_header.file_count(); ++i) {
+                    files_.push_back(line_header.file_path(i));
+                }
+            }
+
+            std::vector<uint32_t> stack;
+            std::vector<uint64_t> imports;
+            replay(*table, load, stack, imports);
+        }
+
+        ///
+        /// @brief Returns the offset of the unit in the .debug_info section
+        ///
+        [[nodiscard]] auto
+        unit_offset() const noexcept -> uint64_t
+        {
+            return unit_offset_;
+        }
+
+        ///
+        /// @brief Returns the paths of the file name table of the line number program, indexed like the inclusions
+        ///
+        [[nodiscard]] auto
+        files() const noexcept -> std::span<std::string const>
+        {
+            return files_;
+        }
+
+        ///
+        /// @brief Returns the index of a file included by the unit
+        /// @param path the path of the file or its trailing components, e.g. "include/config.h"
+        /// @return std::nullopt if the unit does not include the file
+        ///
+        [[nodiscard]] auto
+        find_file(std::string_view const path) const noexcept -> std::optional<uint64_t>
+        {
+            for(auto const & inclusion : inclusions_) {
+                std::string_view const file = inclusion.file < files_.size() ? std::string_view(files_[inclusion.file]) : std::string_view();
+                if(file == path || (file.ends_with(path) && file.size() > path.size()
+                    && (file[file.size() - path.size() - 1] == '/' || file[file.size() - path.size() - 1] == '\\'))) {
+                    return inclusion.file;
+                }
+            }
+            return std::nullopt;
+        }
+
+        ///
+        /// @brief Returns the definition of a macro at a source location
+        /// @param name the name of the macro
+        /// @param file the index of the file, see find_file()
+        /// @param line the line in the file
+        /// @return nullptr if the macro is not defined at the location or the unit does not include the file
+        ///
+        [[nodiscard]] auto
+        find(std::string_view const name, uint64_t const file, uint64_t const line) const -> MacroEntry const *
+        {
+            auto const position = location_position(file, line);
+            return position.has_value() ? find_at(name, *position) : nullptr;
+        }
+
+        ///
+        /// @brief Returns the definitions of all macros defined at a source location, sorted by name
+        ///
+        [[nodiscard]] auto
+        macros_at(uint64_t const file, uint64_t const line) const -> std::vector<MacroEntry const *>
+        {
+            std::vector<MacroEntry const *> res;
+            auto const position = location_position(file, line);
+            if(!position.has_value()) {
+                return res;
+            }
+
+            for(auto const & [name, changes] : names_) {
+                if(auto const * const entry = definition_at(changes, *position); entry != nullptr) {
+                    res.push_back(entry);
+                }
+            }
+            std::ranges::sort(res, {}, &MacroEntry::name);
+            return res;
+        }
+
+        ///
+        /// @brief Returns the number of definitions and undefinitions of the replay, including imported tables
+        ///
+        [[nodiscard]] auto
+        size() const noexcept -> size_t
+        {
+            return size_;
+        }
+
+    private:
+        struct Change final
+        {
+            uint32_t position = 0;
+            /// @brief nullptr for an undefinition
+            MacroEntry const * definition = nullptr;
+        };
+
+        struct Checkpoint final
+        {
+            uint64_t line = 0;
+            /// @brief The position behind the entries of the line
+            uint32_t position = 0;
+        };
+
+        struct Inclusion final
+        {
+            uint64_t file = 0;
+            /// @brief The line of the inclusion in the including file
+            uint64_t line = 0;
+            /// @brief The position of the first entry of the file
+            uint32_t begin = 0;
+            std::vector<Checkpoint> checkpoints;
+        };
+
+        uint64_t unit_offset_ = 0;
+        std::vector<std::string> files_;
+        std::vector<Inclusion> inclusions_;
+        /// @brief The index of the first inclusion of each file
+        std::unordered_map<uint64_t, uint32_t> first_inclusions_;
+        /// @brief The changes of each name in the order of their position
+        std::unordered_map<std::string_view, std::vector<Change>> names_;
+        /// @brief The tables the entries point into
+        std::vector<std::shared_ptr<MacroTable const>> tables_;
+        size_t size_ = 0;
+
+        template<typename LOAD_T>
+        auto
+        replay(MacroTable const & table, LOAD_T & load, std::vector<uint32_t> & stack, std::vector<uint64_t> & imports) -> void
+        {
+            for(auto const & entry : table.entries()) {
+                if(entry.is_define() || entry.is_undef()) {
+                    if(entry.text.empty()) {
+                        continue;
+                    }
+
+                    names_[entry.name()].push_back({static_cast<uint32_t>(size_), entry.is_define() ? &entry : nullptr});
+                    ++size_;
+                    if(!stack.empty()) {
+                        inclusions_[stack.back()].checkpoints.push_back({entry.line, static_cast<uint32_t>(size_)});
+                    }
+                }
+                else if(entry.opcode == MacroInformation::dw_macro_start_file) {
+                    first_inclusions_.emplace(entry.file, static_cast<uint32_t>(inclusions_.size()));
+                    stack.push_back(static_cast<uint32_t>(inclusions_.size()));
+                    inclusions_.push_back({entry.file, entry.line, static_cast<uint32_t>(size_), {}});
+                }
+                else if(entry.opcode == MacroInformation::dw_macro_end_file && !stack.empty()) {
+                    auto const line = inclusions_[stack.back()].line;
+                    stack.pop_back();
+                    if(!stack.empty()) {
+                        inclusions_[stack.back()].checkpoints.push_back({line, static_cast<uint32_t>(size_)});
+                    }
+                }
+                else if(entry.opcode == MacroInformation::dw_macro_import && std::ranges::find(imports, entry.offset) == imports.end()) {
+                    // the imports of a table are replayed where they are imported, a cyclic import is ignored
+                    auto const imported = load(entry.offset);
+                    if(std::ranges::find(tables_, imported) == tables_.end()) {
+                        tables_.push_back(imported);
+                    }
+                    imports.push_back(entry.offset);
+                    replay(*imported, load, stack, imports);
+                    imports.pop_back();
+                }
+            }
+        }
+
+        ///
+        /// @brief Returns the position of a source location, the number of changes in effect at the location
+        ///
+        [[nodiscard]] auto
+        location_position(uint64_t const file, uint64_t const line) const noexcept -> std::optional<uint32_t>
+        {
+            auto const it = first_inclusions_.find(file);
+            if(it == first_inclusions_.end()) {
+                return std::nullopt;
+            }
+
+            auto const & inclusion = inclusions_[it->second];
+            auto const checkpoint = std::ranges::lower_bound(inclusion.checkpoints, line, {}, &Checkpoint::line);
+            return checkpoint == inclusion.checkpoints.begin() ? inclusion.begin : std::prev(checkpoint)->position;
+        }
+
+        [[nodiscard]] auto
+        find_at(std::string_view const name, uint32_t const position) const -> MacroEntry const *
+        {
+            auto const it = names_.find(name);
+            return it != names_.end() ? definition_at(it->second, position) : nullptr;
+        }
+
+        ///
+        /// @brief Returns the definition of the last change of a name before a position
+        ///
+        [[nodiscard]] static auto
+        definition_at(std::vector<Change> const & changes, uint32_t const position) noexcept -> MacroEntry const *
+        {
+            auto const change = std::ranges::lower_bound(changes, position, {}, &Change::position);
+            return change == changes.begin() ? nullptr : std::prev(change)->definition;
+        }
+    };
+
+    /// @class dwarf::MacroIndex
+    ///
+    /// @brief The macros of all units of a binary with a DW_AT_macros or DW_AT_GNU_macros attribute
+    /// @details Each table is read once, a table imported by several units is shared by them.
+    ///
+    class MacroIndex final
+    {
+    public:
+        MacroIndex() = default;
+
+        ///
+        /// @brief Builds the index of the macros of all units
+        /// @param sections the debug sections of a binary file
+        ///
+        explicit MacroIndex(DebugSections const & sections)
+        {
+            if(sections.debug_macro.empty()) {
+                return;
+            }
+
+            std::unordered_map<uint64_t, std::shared_ptr<MacroTable const>> tables;
+            for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+                Unit const unit(sections, unit_header);
+                DIE const die(unit, unit.first_die_offset());
+                auto macros = die.attribute(Attribute::dw_at_macros);
+                if(!macros.is_valid()) {
+                    macros = die.attribute(dw_at_gnu_macros);
+                }
+                if(!macros.is_valid()) {
+                    continue;
+                }
+
+                auto const load = [&](uint64_t const offset) {
+                    auto & table = tables[offset];
+                    if(table == nullptr) {
+                        table = std::make_shared<MacroTable const>(unit, offset);
+                    }
+                    return table;
+                };
+                units_.emplace_back(unit, macros.as_unsigned(), load);
+            }
+            table_count_ = tables.size();
+        }
+
+        [[nodiscard]] auto
+        units() const noexcept -> std::span<UnitMacros const>
+        {
+            return units_;
+        }
+
+        ///
+        /// @brief Returns the macros of the unit at an offset of the .debug_info section
+        /// @return nullptr if the unit has no macro information
+        ///
+        [[nodiscard]] auto
+        find_unit(uint64_t const unit_offset) const noexcept -> UnitMacros const *
+        {
+            auto const it = std::ranges::find(units_, unit_offset, &UnitMacros::unit_offset);
+            return it != units_.end() ? &*it : nullptr;
+        }
+
+        ///
+        /// @brief Returns the definition of a macro at a source location in the first unit including the file
+        /// @param file the path of the file or its trailing components
+        /// @return nullptr if the macro is not defined at the location or no unit includes the file
+        ///
+        [[nodiscard]] auto
+        find(std::string_view const name, std::string_view const file, uint64_t const line) const -> MacroEntry const *
+        {
+            for(auto const & unit : units_) {
+                if(auto const index = unit.find_file(file); index.has_value()) {
+                    return unit.find(name, *index, line);
+                }
+            }
+            return nullptr;
+        }
+
+        ///
+        /// @brief Returns the number of tables read, each imported table is counted once
+        ///
+        [[nodiscard]] auto
+        table_count() const noexcept -> size_t
+        {
+            return table_count_;
+        }
+
+    private:
+        /// @brief The GNU extension of DW_AT_macros for DWARF 4
+        static constexpr auto dw_at_gnu_macros = static_cast<Attribute>(0x2119);
+
+        std::vector<UnitMacros> units_;
+        size_t table_count_ = 0;
+    };
+}
@@ -0,0 +1,208 @@
+///
+/// @file:   range_list.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The address ranges of DW_AT_ranges in the .debug_ranges and .debug_rnglists sections
+///
+
+#pragma once
+
+#include "dwarf/debug_info/attribute_value.hpp"
+#include <vector>
+
+namespace dwarf
+{
+    /// @class dwarf::AddressRange
+    ///
+    /// @brief The address range [low_pc, high_pc)
+    ///
+    struct AddressRange final
+    {
+        uint64_t low_pc = 0;
+        uint64_t high_pc = 0;
+    };
+
+    /// @class dwarf::RangeList
+    ///
+    /// @brief The address ranges of a range list and the bytes they were read from
+    ///
+    struct RangeList final
+    {
+        /// @brief The non-empty ranges in the order of the list
+        std::vector<AddressRange> ranges = {};
+        /// @brief The section of the list, .debug_ranges or .debug_rnglists
+        std::span<char const> DebugSections::* section = nullptr;
+        /// @brief The bytes of the list in the section
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        /// @brief The bytes of the entry of the offsets table in the section, size 0 if the list is referenced by its offset
+        uint64_t index_offset = 0;
+        uint64_t index_size = 0;
+        /// @brief The offsets of the addresses read from the .debug_addr section
+        std::vector<uint64_t> addresses = {};
+    };
+
+    ///
+    /// @brief Reads the address ranges of a DW_AT_ranges attribute
+    /// @details Units before DWARF 5 refer to a list of address pairs in the .debug_ranges section,
+    ///     DWARF 5 units to a list of range list entries in the .debug_rnglists section, either by
+    ///     its offset or by its index in the offsets table at DW_AT_rnglists_base. A list ends at
+    ///     the end of its section.
+    /// @param unit the unit of the attribute
+    /// @param value the value of DW_AT_ranges
+    /// @param base_address the base address of the unit, the DW_AT_low_pc of its unit entry
+    ///
+    [[nodiscard]] constexpr auto
+    read_range_list(Unit const & unit, AttributeValue const & value, uint64_t base_address) -> RangeList
+    {
+        RangeList res = {};
+        size_t const address_size = unit.address_size();
+        if(address_size == 0 || address_size > sizeof(uint64_t)) [[unlikely]] {
+            return res;
+        }
+
+        uint64_t const max_address = address_size == sizeof(uint64_t) ? ~uint64_t{0} : (uint64_t{1} << (address_size * 8)) - 1;
+        auto const add = [&](uint64_t const low_pc, uint64_t const high_pc) {
+            if(low_pc < high_pc) {
+                res.ranges.push_back({low_pc, high_pc});
+            }
+        };
+
+        if(unit.version() < 5)
+        {   // pairs of addresses relative to the base address, a pair starting with the largest address selects a new base address
+            auto const & data = unit.sections().debug_ranges;
+            res.section = &DebugSections::debug_ranges;
+            res.offset = value.as_unsigned();
+
+            size_t index = res.offset;
+            while(index <= data.size() && 2 * address_size <= data.size() - index) {
+                uint64_t const begin = read_unsigned(data, index, address_size);
+                uint64_t const end = read_unsigned(data, index + address_size, address_size);
+                index += 2 * address_size;
+
+                if(begin == 0 && end == 0) {
+                    break;
+                }
+                if(begin == max_address) {
+                    base_address = end;
+                }
+                else {
+                    add(base_address + begin, base_address + end);
+                }
+            }
+
+            res.size = std::max<uint64_t>(index, res.offset) - res.offset;
+            return res;
+        }
+
+        auto const & data = unit.sections().debug_rnglists;
+        auto const & debug_addr = unit.sections().debug_addr;
+        res.section = &DebugSections::debug_rnglists;
+
+        size_t index = value.as_unsigned();
+        if(value.form() == Form::dw_form_rnglistx)
+        {   // the offsets table entry holds the offset of the list relative to the table
+            res.index_offset = unit.rnglists_base() + value.as_unsigned() * unit.offset_size();
+            res.index_size = unit.offset_size();
+            if(res.index_offset > data.size() || res.index_size > data.size() - res.index_offset) {
+                return res;
+            }
+            index = unit.rnglists_base() + read_unsigned(data, res.index_offset, res.index_size);
+        }
+        res.offset = index;
+
+        bool is_valid = true;
+        auto const read_uleb128 = [&]() -> uint64_t {
+            auto const [val, n] = ::details::uleb128<uint64_t>(data, index);
+            is_valid = is_valid && n > 0;
+            index += n;
+            return val;
+        };
+        auto const read_address = [&]() -> uint64_t {
+            if(index > data.size() || address_size > data.size() - index) {
+                is_valid = false;
+                return 0;
+            }
+            uint64_t const address = read_unsigned(data, index, address_size);
+            index += address_size;
+            return address;
+        };
+        auto const read_indexed_address = [&]() -> uint64_t {
+            uint64_t const offset = unit.addr_base() + read_uleb128() * address_size;
+            if(offset > debug_addr.size() || address_size > debug_addr.size() - offset) {
+                is_valid = false;
+                return 0;
+            }
+            res.addresses.push_back(offset);
+            return read_unsigned(debug_addr, offset, address_size);
+        };
+
+        while(is_valid && index < data.size()) {
+            auto const kind = static_cast<RangeListEntry>(std::bit_cast<uint8_t>(data[index++]));
+            switch (kind)
+            {
+            case RangeListEntry::dw_rle_end_of_list:
+                is_valid = false;
+                break;
+            case RangeListEntry::dw_rle_base_addressx:
+                base_address = read_indexed_address();
+                break;
+            case RangeListEntry::dw_rle_startx_endx:
+            {
+                uint64_t const low_pc = read_indexed_address();
+                uint64_t const high_pc = read_indexed_address();
+                if(is_valid) {
+                    add(low_pc, high_pc);
+                }
+                break;
+            }
+            case RangeListEntry::dw_rle_startx_length:
+            {
+                uint64_t const low_pc = read_indexed_address();
+                uint64_t const length = read_uleb128();
+                if(is_valid) {
+                    add(low_pc, low_pc + length);
+                }
+                break;
+            }
+            case RangeListEntry::dw_rle_offset_pair:
+            {
+                uint64_t const begin = read_uleb128();
+                uint64_t const end = read_uleb128();
+                if(is_valid) {
+                    add(base_address + begin, base_address + end);
+                }
+                break;
+            }
+            case RangeListEntry::dw_rle_base_address:
+                base_address = read_address();
+                break;
+            case RangeListEntry::dw_rle_start_end:
+            {
+                uint64_t const low_pc = read_address();
+                uint64_t const high_pc = read_address();
+                if(is_valid) {
+                    add(low_pc, high_pc);
+                }
+                break;
+            }
+            case RangeListEntry::dw_rle_start_length:
+            {
+                uint64_t const low_pc = read_address();
+                uint64_t const length = read_uleb128();
+                if(is_valid) {
+                    add(low_pc, low_pc + length);
+                }
+                break;
+            }
+            default:
+                // an unknown entry kind, the size of its operands is unknown
+                is_valid = false;
+                break;
+            }
+        }
+
+        res.size = std::max<uint64_t>(std::min(index, data.size()), res.offset) - res.offset;
+        return res;
+    }
+}
@@ -0,0 +1,160 @@
+///
+/// @file:   debug_sections.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The debug sections of a binary file
+///
+
+#pragma once
+
+#include "dwarf/reader_statistics.hpp"
+#include "pei/section_table.hpp"
+#include <array>
+#include <span>
+#include <string_view>
+
+namespace dwarf
+{
+    /// @class dwarf::DebugSections
+    ///
+    /// @brief The data of all debug sections of one binary file
+    /// @details The DWARF debugging information is spread over several object file sections.
+    ///     Sections not present in the binary file are empty. For a split DWARF object the
+    ///     sections hold the data of the .dwo sections, e.g. debug_info holds .debug_info.dwo.
+    ///
+    struct DebugSections final
+    {
+        /// @brief The .debug_info section
+        std::span<char const> debug_info;
+        /// @brief The .debug_abbrev section
+        std::span<char const> debug_abbrev;
+        /// @brief The .debug_str section
+        std::span<char const> debug_str;
+        /// @brief The .debug_line_str section
+        std::span<char const> debug_line_str;
+        /// @brief The .debug_str_offsets section
+        std::span<char const> debug_str_offsets;
+        /// @brief The .debug_addr section
+        std::span<char const> debug_addr;
+        /// @brief The .debug_line section
+        std::span<char const> debug_line;
+        /// @brief The .debug_rnglists section
+        std::span<char const> debug_rnglists;
+        /// @brief The .debug_ranges section of DWARF 4 and earlier
+        std::span<char const> debug_ranges;
+        /// @brief The .debug_loclists section
+        std::span<char const> debug_loclists;
+        /// @brief The .debug_aranges section
+        std::span<char const> debug_aranges;
+        /// @brief The .debug_macro section
+        std::span<char const> debug_macro;
+        /// @brief The .debug_cu_index section of a split DWARF package
+        std::span<char const> debug_cu_index;
+        /// @brief The .debug_tu_index section of a split DWARF package
+        std::span<char const> debug_tu_index;
+    };
+
+    /// @brief A member of dwarf::DebugSections
+    using DebugSectionMember = std::span<char const> DebugSections::*;
+
+    /// @class dwarf::DebugSectionName
+    ///
+    /// @brief The name of a debug section without the .debug_ prefix and its member in dwarf::DebugSections
+    ///
+    struct DebugSectionName final
+    {
+        std::string_view suffix;
+        DebugSectionMember member;
+    };
+
+    /// @brief All debug sections read from a binary file
+    constexpr std::array<DebugSectionName, 14> debug_section_names = {{
+        {"info",        &DebugSections::debug_info},
+        {"abbrev",      &DebugSections::debug_abbrev},
+        {"str",         &DebugSections::debug_str},
+        {"line_str",    &DebugSections::debug_line_str},
+        {"str_offsets", &DebugSections::debug_str_offsets},
+        {"addr",        &DebugSections::debug_addr},
+        {"line",        &DebugSections::debug_line},
+        {"rnglists",    &DebugSections::debug_rnglists},
+        {"ranges",      &DebugSections::debug_ranges},
+        {"loclists",    &DebugSections::debug_loclists},
+        {"aranges",     &DebugSections::debug_aranges},
+        {"macro",       &DebugSections::debug_macro},
+        {"cu_index",    &DebugSections::debug_cu_index},
+        {"tu_index",    &DebugSections::debug_tu_index}
+    }};
+
+    ///
+    /// @brief Returns the index of a section in dwarf::debug_section_names
+    /// @param suffix the name of the section without the .debug_ prefix and without a .dwo suffix
+    /// @return debug_section_names.size() if the section is not read
+    ///
+    [[nodiscard]] constexpr auto
+    find_debug_section(std::string_view const suffix) noexcept -> size_t
+    {
+        for(size_t i = 0; i < debug_section_names.size(); ++i) {
+            if(debug_section_names[i].suffix == suffix) {
+                return i;
+            }
+        }
+
+        return debug_section_names.size();
+    }
+
+    ///
+    /// @brief Returns the index of a section in dwarf::debug_section_names
+    /// @return debug_section_names.size() if the member is unknown
+    ///
+    [[nodiscard]] constexpr auto
+    find_debug_section(DebugSectionMember const member) noexcept -> size_t
+    {
+        for(size_t i = 0; i < debug_section_names.size(); ++i) {
+            if(debug_section_names[i].member == member) {
+                return i;
+            }
+        }
+
+        return debug_section_names.size();
+    }
+
+    ///
+    /// @brief Returns the debug sections of a portable executable file or of a COFF object file
+    /// @details Compressed .zdebug_ sections are not returned, they are read with dwarf::SectionCache
+    /// @param data the complete data of a binary .exe file
+    /// @return no sections if the headers are not valid, see pei::SectionTable::is_valid()
+    ///
+    [[nodiscard]] constexpr auto
+    get_debug_sections(std::span<char const> const data) noexcept -> DebugSections
+    {
+        StageTimer const timer(ReaderStage::sections);
+        pei::SectionTable const section_table(data);
+        if(!section_table.is_valid()) {
+            return {};
+        }
+
+        // one pass over the section table, the names of the debug sections are stored in the string table
+        DebugSections res = {};
+        size_t const count = section_table.number_of_sections();
+        for(size_t i = 0; i < count; ++i) {
+            pei::SectionHeader const section(data, i);
+            std::string_view const name = section.name();
+            if(!name.starts_with(".debug_")) {
+                continue;
+            }
+
+            // the sections of a split DWARF .dwo or .dwp file end with .dwo
+            std::string_view suffix = name.substr(7);
+            if(suffix.ends_with(".dwo")) {
+                suffix.remove_suffix(4);
+            }
+
+            size_t const index = find_debug_section(suffix);
+            if(index < debug_section_names.size()) {
+                res.*debug_section_names[index].member = section.data();
+            }
+        }
+
+        return res;
+    }
+}
@@ -0,0 +1,172 @@
+///
+/// @file:   buffered_writer.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Formats text into a growing buffer with std::to_chars
+///
+
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+namespace dwarf
+{
+    /// @class dwarf::BufferedWriter
+    ///
+    /// @brief Appends text and numbers to a buffer which is written to a file in large blocks
+    /// @details Numbers are formatted with std::to_chars, which neither allocates nor depends on
+    ///     a locale. Without a file the writer only collects the text, e.g. to format a unit on a
+    ///     worker thread and write it later in order.
+    ///
+    class BufferedWriter final
+    {
+    public:
+        ///
+        /// @brief constructor
+        /// @param file the file the text is written to, nullptr to only collect the text
+        /// @param capacity the size of the buffer above which the text is written to the file
+        ///
+        explicit BufferedWriter(std::FILE * const file = nullptr, size_t const capacity = 1 << 16)
+            : file_(file), capacity_(capacity)
+        {
+            buffer_.reserve(capacity_ + 256);
+        }
+
+        BufferedWriter(BufferedWriter const &) = delete;
+        auto operator=(BufferedWriter const &) -> BufferedWriter & = delete;
+
+        BufferedWriter(BufferedWriter &&) noexcept = default;
+        auto operator=(BufferedWriter &&) noexcept -> BufferedWriter & = default;
+
+        ~BufferedWriter()
+        {
+            flush();
+        }
+
+        auto
+        write(std::string_view const text) -> BufferedWriter &
+        {
+            buffer_.insert(buffer_.end(), text.begin(), text.end());
+            return flush_if_full();
+        }
+
+        auto
+        write(char const c) -> BufferedWriter &
+        {
+            buffer_.push_back(c);
+            return flush_if_full();
+        }
+
+        ///
+        /// @brief Writes a string padded with spaces to a minimum width
+        ///
+        auto
+        write_padded(std::string_view const text, size_t const width) -> BufferedWriter &
+        {
+            buffer_.insert(buffer_.end(), text.begin(), text.end());
+            if(text.size() < width) {
+                buffer_.insert(buffer_.end(), width - text.size(), ' ');
+            }
+            return flush_if_full();
+        }
+
+        ///
+        /// @brief Writes an unsigned number in decimal
+        ///
+        auto
+        dec(uint64_t const value) -> BufferedWriter &
+        {
+            return number(value, 10, 0);
+        }
+
+        ///
+        /// @brief Writes a signed number in decimal
+        ///
+        auto
+        dec_signed(int64_t const value) -> BufferedWriter &
+        {
+            char chars[24];
+            auto const res = std::to_chars(chars, chars + sizeof(chars), value);
+            return write(std::string_view(chars, static_cast<size_t>(res.ptr - chars)));
+        }
+
+        ///
+        /// @brief Writes a number in lower case hexadecimal without prefix
+        /// @param width the minimum number of digits, padded with zeros
+        ///
+        auto
+        hex(uint64_t const value, size_t const width = 0) -> BufferedWriter &
+        {
+            return number(value, 16, width);
+        }
+
+        ///
+        /// @brief Writes a number in hexadecimal with 0x prefix, except for 0, like printf("%#x")
+        ///
+        auto
+        hex_prefixed(uint64_t const value) -> BufferedWriter &
+        {
+            if(value != 0) {
+                write("0x");
+            }
+            return number(value, 16, 0);
+        }
+
+        ///
+        /// @brief Writes the collected text to the file
+        ///
+        auto
+        flush() -> void
+        {
+            if(file_ != nullptr && !buffer_.empty()) {
+                std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+                buffer_.clear();
+            }
+        }
+
+        ///
+        /// @brief Returns the text collected since the last flush
+        ///
+        [[nodiscard]] auto
+        view() const noexcept -> std::string_view
+        {
+            return std::string_view(buffer_.data(), buffer_.size());
+        }
+
+        auto
+        clear() noexcept -> void
+        {
+            buffer_.clear();
+        }
+
+    private:
+        auto
+        number(uint64_t const value, int const base, size_t const width) -> BufferedWriter &
+        {
+            char chars[24];
+            auto const res = std::to_chars(chars, chars + sizeof(chars), value, base);
+            auto const size = static_cast<size_t>(res.ptr - chars);
+            if(size < width) {
+                buffer_.insert(buffer_.end(), width - size, '0');
+            }
+            return write(std::string_view(chars, size));
+        }
+
+        auto
+        flush_if_full() -> BufferedWriter &
+        {
+            if(buffer_.size() >= capacity_) {
+                flush();
+            }
+            return *this;
+        }
+
+        std::FILE * file_ = nullptr;
+        size_t capacity_ = 0;
+        std::vector<char> buffer_;
+    };
+}
@@ -0,0 +1,789 @@
+///
+/// @file:   dwarf_dump.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Prints section headers, abbreviations and debugging information entries in the layout of objdump
+///
+
+#pragma once
+
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/die.hpp"
+#include "dwarf/dump/buffered_writer.hpp"
+#include "dwarf/dump/dwarf_names.hpp"
+#include "pei/pei.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace dwarf
+{
+    /// @brief The number of .debug_info bytes formatted as one batch by dwarf::dump_debug_info()
+    constexpr size_t dump_batch_size = 64 * 1024;
+
+    namespace details
+    {
+        ///
+        /// @brief Writes the name of a DWARF constant or the objdump text for an unknown value
+        /// @param unknown the text written before the value if the constant has no name
+        /// @param width the minimum width, padded with spaces
+        ///
+        template<typename ENUM_T>
+        auto
+        write_dwarf_name(BufferedWriter & writer, ENUM_T const value, std::string_view const unknown, size_t const width = 0) -> void
+        {
+            auto const name = dwarf_name(value);
+            if(!name.empty()) {
+                writer.write_padded(name, width);
+                return;
+            }
+
+            BufferedWriter text;
+            text.write(unknown).hex(static_cast<uint64_t>(value));
+            writer.write_padded(text.view(), width);
+        }
+
+        ///
+        /// @brief Returns true for the attributes whose block values are DWARF expressions
+        ///
+        [[nodiscard]] constexpr auto
+        is_expression_attribute(Attribute const attribute) noexcept -> bool
+        {
+            switch (attribute)
+            {
+            case Attribute::dw_at_location:
+            case Attribute::dw_at_string_length:
+            case Attribute::dw_at_return_addr:
+            case Attribute::dw_at_data_member_location:
+            case Attribute::dw_at_vtable_elem_location:
+            case Attribute::dw_at_allocated:
+            case Attribute::dw_at_associated:
+            case Attribute::dw_at_data_location:
+            case Attribute::dw_at_byte_stride:
+            case Attribute::dw_at_upper_bound:
+            case Attribute::dw_at_lower_bound:
+            case Attribute::dw_at_count:
+            case Attribute::dw_at_call_value:
+            case Attribute::dw_at_call_target:
+            case Attribute::dw_at_call_data_location:
+            case Attribute::dw_at_call_data_value:
+            case Attribute::dw_at_frame_base:
+            case Attribute::dw_at_static_link:
+            case Attribute::dw_at_use_location:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        ///
+        /// @brief Writes the bytes of a block like objdump, e.g. "2 byte block: 91 8 "
+        ///
+        inline auto
+        write_block(BufferedWriter & writer, std::span<char const> const block) -> void
+        {
+            writer.dec(block.size()).write(" byte block: ");
+            for(char const c : block) {
+                writer.hex(static_cast<uint8_t>(c)).write(' ');
+            }
+        }
+
+        ///
+        /// @brief Writes the operations of a DWARF expression, separated by "; "
+        /// @details Decoding stops at the first operation with unknown operands
+        /// @param encoding the encoding of the unit, for the size of addresses and offsets
+        /// @return true if an operation is relative to the frame base
+        ///
+        inline auto
+        write_expression(BufferedWriter & writer, std::span<char const> const expression, FormEncoding const & encoding) -> bool
+        {
+            size_t index = 0;
+            bool uses_frame_base = false;
+
+            auto const read_fixed = [&](size_t const size) {
+                auto const res = read_unsigned(expression, index, size);
+                index += size;
+                return res;
+            };
+            auto const read_signed = [&](size_t const size) {
+                auto const shift = 64 - 8 * size;
+                return static_cast<int64_t>(read_fixed(size) << shift) >> shift;
+            };
+            auto const read_uleb = [&]() {
+                auto const [value, n] = ::details::uleb128<uint64_t>(expression, index);
+                if(n == 0) {
+                    throw std::range_error("dwarf dump: uleb128 wrong format in expression");
+                }
+                index += n;
+                return value;
+            };
+            auto const read_sleb = [&]() {
+                auto const [value, n] = ::details::sleb128<int64_t>(expression, index);
+                if(n == 0) {
+                    throw std::range_error("dwarf dump: sleb128 wrong format in expression");
+                }
+                index += n;
+                return value;
+            };
+            auto const write_register = [&](uint64_t const number) {
+                auto const name = register_name(number, encoding.address_size);
+                if(!name.empty()) {
+                    writer.write(" (").write(name).write(')');
+                }
+            };
+
+            while(index < expression.size()) {
+                if(index != 0) {
+                    writer.write("; ");
+                }
+
+                // DW_OP_GNU_entry_value is the GNU extension standardized as DW_OP_entry_value
+                constexpr uint8_t gnu_entry_value = 0xf3;
+                constexpr uint8_t gnu_uninit = 0xf0;
+
+                auto const code = static_cast<uint8_t>(expression[index++]);
+                auto const operation = code == gnu_entry_value ? Operation::dw_op_entry_value : static_cast<Operation>(code);
+                auto const name = code == gnu_entry_value ? "DW_OP_GNU_entry_value" : dwarf_name(operation);
+
+                if((code >= 0x30 && code <= 0x4f) || code == gnu_uninit) {
+                    writer.write(code == gnu_uninit ? "DW_OP_GNU_uninit" : name);
+                    continue;
+                }
+                if(code >= 0x50 && code <= 0x6f) {
+                    writer.write(name);
+                    write_register(code - 0x50u);
+                    continue;
+                }
+                if(code >= 0x70 && code <= 0x8f) {
+                    writer.write(name);
+                    write_register(code - 0x70u);
+                    writer.write(": ").dec_signed(read_sleb());
+                    continue;
+                }
+
+                switch (operation)
+                {
+                case Operation::dw_op_addr:
+                    writer.write(name).write(": ").hex(read_fixed(encoding.address_size));
+                    break;
+                case Operation::dw_op_const1u:
+                case Operation::dw_op_pick:
+                case Operation::dw_op_deref_size:
+                case Operation::dw_op_xderef_size:
+                    writer.write(name).write(": ").dec(read_fixed(1));
+                    break;
+                case Operation::dw_op_const1s:
+                    writer.write(name).write(": ").dec_signed(read_signed(1));
+                    break;
+                case Operation::dw_op_const2u:
+                    writer.write(name).write(": ").dec(read_fixed(2));
+                    break;
+                case Operation::dw_op_const2s:
+                case Operation::dw_op_bra:
+                case Operation::dw_op_skip:
+                    writer.write(name).write(": ").dec_signed(read_signed(2));
+                    break;
+                case Operation::dw_op_const4u:
+                    writer.write(name).write(": ").dec(read_fixed(4));
+                    break;
+                case Operation::dw_op_const4s:
+                    writer.write(name).write(": ").dec_signed(read_signed(4));
+                    break;
+                case Operation::dw_op_const8u:
+                    writer.write(name).write(": ").dec(read_fixed(8));
+                    break;
+                case Operation::dw_op_const8s:
+                    writer.write(name).write(": ").dec_signed(read_signed(8));
+                    break;
+                case Operation::dw_op_constu:
+                case Operation::dw_op_plus_uconst:
+                case Operation::dw_op_piece:
+                    writer.write(name).write(": ").dec(read_uleb());
+                    break;
+                case Operation::dw_op_consts:
+                    writer.write(name).write(": ").dec_signed(read_sleb());
+                    break;
+                case Operation::dw_op_fbreg:
+                    writer.write(name).write(": ").dec_signed(read_sleb());
+                    uses_frame_base = true;
+                    break;
+                case Operation::dw_op_regx:
+                {
+                    auto const number = read_uleb();
+                    writer.write(name).write(": ").dec(number);
+                    write_register(number);
+                    break;
+                }
+                case Operation::dw_op_bregx:
+                {
+                    auto const number = read_uleb();
+                    writer.write(name).write(": ").dec(number);
+                    write_register(number);
+                    writer.write(' ').dec_signed(read_sleb());
+                    break;
+                }
+                case Operation::dw_op_bit_piece:
+                {
+                    auto const size = read_uleb();
+                    writer.write(name).write(": size: ").dec(size).write(" offset: ").dec(read_uleb()).write(' ');
+                    break;
+                }
+                case Operation::dw_op_call2:
+                    writer.write(name).write(": <0x").hex(read_fixed(2)).write('>');
+                    break;
+                case Operation::dw_op_call4:
+                    writer.write(name).write(": <0x").hex(read_fixed(4)).write('>');
+                    break;
+                case Operation::dw_op_call_ref:
+                    writer.write(name).write(": <0x").hex(read_fixed(encoding.offset_size)).write('>');
+                    break;
+                case Operation::dw_op_addrx:
+                case Operation::dw_op_constx:
+                case Operation::dw_op_convert:
+                case Operation::dw_op_reinterpret:
+                    writer.write(name).write(" <0x").hex(read_uleb()).write('>');
+                    break;
+                case Operation::dw_op_implicit_value:
+                {
+                    auto const size = read_uleb();
+                    if(index + size > expression.size()) {
+                        throw std::range_error("dwarf dump: implicit value out of bounds");
+                    }
+                    writer.write(name).write(' ');
+                    write_block(writer, expression.subspan(index, size));
+                    index += size;
+                    break;
+                }
+                case Operation::dw_op_implicit_pointer:
+                {
+                    auto const offset = read_fixed(encoding.offset_size);
+                    writer.write(name).write(": <0x").hex(offset).write("> ").dec_signed(read_sleb());
+                    break;
+                }
+                case Operation::dw_op_entry_value:
+                {
+                    auto const size = read_uleb();
+                    if(index + size > expression.size()) {
+                        throw std::range_error("dwarf dump: entry value out of bounds");
+                    }
+                    writer.write(name).write(": (");
+                    uses_frame_base |= write_expression(writer, expression.subspan(index, size), encoding);
+                    writer.write(')');
+                    index += size;
+                    break;
+                }
+                case Operation::dw_op_deref:
+                case Operation::dw_op_dup:
+                case Operation::dw_op_drop:
+                case Operation::dw_op_over:
+                case Operation::dw_op_swap:
+                case Operation::dw_op_rot:
+                case Operation::dw_op_xderef:
+                case Operation::dw_op_abs:
+                case Operation::dw_op_and_:
+                case Operation::dw_op_div:
+                case Operation::dw_op_minus:
+                case Operation::dw_op_mod:
+                case Operation::dw_op_mul:
+                case Operation::dw_op_neg:
+                case Operation::dw_op_not_:
+                case Operation::dw_op_or_:
+                case Operation::dw_op_plus:
+                case Operation::dw_op_shl:
+                case Operation::dw_op_shr:
+                case Operation::dw_op_shra:
+                case Operation::dw_op_xor_:
+                case Operation::dw_op_eq:
+                case Operation::dw_op_ge:
+                case Operation::dw_op_gt:
+                case Operation::dw_op_le:
+                case Operation::dw_op_lt:
+                case Operation::dw_op_ne:
+                case Operation::dw_op_nop:
+                case Operation::dw_op_push_object_address:
+                case Operation::dw_op_form_tls_address:
+                case Operation::dw_op_call_frame_cfa:
+                case Operation::dw_op_stack_value:
+                    writer.write(name);
+                    break;
+                case Operation::dw_op_lo_user:
+                    writer.write("DW_OP_GNU_push_tls_address");
+                    break;
+                default:
+                    writer.write(code >= 0xe0 ? "(User defined location op 0x" : "(Unknown location op 0x").hex(code).write(')');
+                    return uses_frame_base;
+                }
+            }
+
+            return uses_frame_base;
+        }
+
+        ///
+        /// @brief Writes the value of an attribute like objdump
+        /// @param has_frame_base false to mark expressions relative to the frame base, outside of a
+        ///     subprogram with DW_AT_frame_base
+        ///
+        inline auto
+        write_attribute_value(BufferedWriter & writer, Unit const & unit, Attribute const attribute, AttributeValue const & value,
+            bool const has_frame_base = true) -> void
+        {
+            auto const & raw = value.raw();
+
+            switch (raw.form)
+            {
+            case Form::dw_form_addr:
+                writer.hex_prefixed(raw.value);
+                break;
+            case Form::dw_form_addrx:
+            case Form::dw_form_addrx1:
+            case Form::dw_form_addrx2:
+            case Form::dw_form_addrx3:
+            case Form::dw_form_addrx4:
+                writer.write("(index: ").hex_prefixed(raw.value).write("): ").hex(value.as_address());
+                break;
+            case Form::dw_form_block:
+            case Form::dw_form_block1:
+            case Form::dw_form_block2:
+            case Form::dw_form_block4:
+            case Form::dw_form_exprloc:
+                write_block(writer, raw.block);
+                if(raw.form == Form::dw_form_exprloc || is_expression_attribute(attribute)) {
+                    writer.write("\t(");
+                    bool const uses_frame_base = write_expression(writer, raw.block, unit.encoding());
+                    writer.write(')');
+                    if(uses_frame_base && !has_frame_base) {
+                        writer.write(" [without DW_AT_frame_base]");
+                    }
+                }
+                break;
+            case Form::dw_form_data_16:
+                write_block(writer, raw.block);
+                break;
+            case Form::dw_form_data4:
+                writer.hex_prefixed(raw.value);
+                break;
+            case Form::dw_form_data1:
+            case Form::dw_form_data2:
+            case Form::dw_form_udata:
+                if(attribute == Attribute::dw_at_high_pc) {
+                    writer.hex_prefixed(raw.value);
+                }
+                else {
+                    writer.dec(raw.value);
+                }
+                break;
+            case Form::dw_form_data8:
+                writer.hex_prefixed(raw.value);
+                break;
+            case Form::dw_form_sdata:
+            case Form::dw_form_implicit_const:
+                writer.dec_signed(value.as_signed());
+                break;
+            case Form::dw_form_flag:
+                writer.dec(raw.value);
+                break;
+            case Form::dw_form_flag_present:
+                writer.write('1');
+                break;
+            case Form::dw_form_string:
+                writer.write(value.as_string());
+                break;
+            case Form::dw_form_strp:
+                writer.write("(indirect string, offset: ").hex_prefixed(raw.value).write("): ").write(value.as_string());
+                break;
+            case Form::dw_form_line_strp:
+                writer.write("(indirect line string, offset: ").hex_prefixed(raw.value).write("): ").write(value.as_string());
+                break;
+            case Form::dw_form_strx:
+            case Form::dw_form_strx1:
+            case Form::dw_form_strx2:
+            case Form::dw_form_strx3:
+            case Form::dw_form_strx4:
+                writer.write("(indexed string: 0x").hex(raw.value).write("): ").write(value.as_string());
+                break;
+            case Form::dw_form_ref1:
+            case Form::dw_form_ref2:
+            case Form::dw_form_ref4:
+            case Form::dw_form_ref8:
+            case Form::dw_form_ref_udata:
+            case Form::dw_form_ref_addr:
+                writer.write("<0x").hex(value.as_reference()).write('>');
+                break;
+            case Form::dw_form_ref_sig8:
+                writer.write("signature: 0x").hex(raw.value);
+                break;
+            default:
+                writer.hex_prefixed(raw.value);
+                break;
+            }
+
+            switch (raw.form)
+            {
+            case Form::dw_form_data1:
+            case Form::dw_form_data2:
+            case Form::dw_form_data4:
+            case Form::dw_form_data8:
+            case Form::dw_form_udata:
+            case Form::dw_form_sdata:
+            case Form::dw_form_implicit_const:
+            {
+                auto const description = constant_description(attribute, raw.value);
+                if(!description.empty()) {
+                    writer.write("\t(").write(description).write(')');
+                }
+                break;
+            }
+            case Form::dw_form_sec_offset:
+            case Form::dw_form_loclistx:
+                if(attribute == Attribute::dw_at_location || attribute == Attribute::dw_at_frame_base) {
+                    writer.write("\t(location list)");
+                }
+                break;
+            default:
+                break;
+            }
+
+            if(attribute == Attribute::dw_at_import && value.is_reference()) {
+                size_t const offset = value.as_reference();
+                if(offset >= unit.first_die_offset() && offset < unit.end_offset()) {
+                    DIE const die(unit, offset);
+                    if(!die.is_null()) {
+                        writer.write("\t[Abbrev Number: ").dec(die.abbrev()->code()).write(" (");
+                        write_dwarf_name(writer, die.tag(), "Unknown TAG value: 0x");
+                        writer.write(")]");
+                    }
+                }
+            }
+        }
+    }
+
+    ///
+    /// @brief Returns the name objdump uses for the format of a portable executable or COFF object file
+    /// @param data the complete data of a binary file
+    ///
+    [[nodiscard]] inline auto
+    file_format(std::span<char const> const data) -> std::string
+    {
+        pei::FileHeader const file_header(data);
+        std::string res = file_header.size_of_optional_header() != 0 ? "pei-" : "pe-";
+
+        switch (file_header.machine())
+        {
+        case 0x8664: return res + "x86-64";
+        case 0x014c: return res + "i386";
+        case 0xaa64: return res + "aarch64-little";
+        default: return res + "unknown";
+        }
+    }
+
+    ///
+    /// @brief Writes the line naming the file and its format, which precedes all other output of objdump
+    ///
+    inline auto
+    dump_file_header(BufferedWriter & writer, std::string_view const file_name, std::span<char const> const data) -> void
+    {
+        writer.write('\n').write(file_name).write(":     file format ").write(file_format(data)).write("\n\n");
+    }
+
+    ///
+    /// @brief Writes the section table like objdump -h
+    /// @param data the complete data of a binary file
+    ///
+    inline auto
+    dump_sections(BufferedWriter & writer, std::span<char const> const data) -> void
+    {
+        constexpr uint32_t scn_cnt_code = 0x00000020;
+        constexpr uint32_t scn_cnt_initialized_data = 0x00000040;
+        constexpr uint32_t scn_mem_write = 0x80000000;
+
+        pei::OptionalHeader const optional_header(data);
+        uint64_t const image_base = optional_header.image_base();
+        bool const is_image = optional_header.size() != 0;
+
+        writer.write("Sections:\nIdx Name          Size      VMA               LMA               File off  Algn\n");
+
+        pei::SectionTable const section_table(data);
+        size_t const count = section_table.number_of_sections();
+        for(size_t i = 0; i < count; ++i) {
+            pei::SectionHeader const section(data, i);
+            auto const name = section.name();
+            auto const characteristics = section.characteristics();
+            uint64_t const size = is_image && section.virtual_size() != 0 ? section.virtual_size() : section.size_of_raw_data();
+            uint64_t const address = image_base + section.virtual_address();
+            uint32_t const alignment = (characteristics >> 20) & 0xf;
+
+            writer.write(i < 10 ? "  " : i < 100 ? " " : "").dec(i).write(' ').write_padded(name, 13).write(' ')
+                .hex(size, 8).write("  ").hex(address, 16).write("  ").hex(address, 16).write("  ")
+                .hex(section.pointer_to_raw_data(), 8).write("  2**").dec(alignment != 0 ? alignment - 1 : 0).write('\n');
+
+            bool const has_contents = section.pointer_to_raw_data() != 0 && section.size_of_raw_data() != 0;
+            bool const is_debugging = name.starts_with(".debug") || name.starts_with(".zdebug");
+            std::string_view separator = "";
+            auto const flag = [&](bool const is_set, std::string_view const text) {
+                if(is_set) {
+                    writer.write(separator).write(text);
+                    separator = ", ";
+                }
+            };
+
+            writer.write("                  ");
+            flag(has_contents, "CONTENTS");
+            flag(!is_debugging, "ALLOC");
+            flag(!is_debugging && has_contents, "LOAD");
+            flag((characteristics & scn_mem_write) == 0, "READONLY");
+            flag((characteristics & scn_cnt_code) != 0, "CODE");
+            flag(!is_debugging && (characteristics & scn_cnt_initialized_data) != 0, "DATA");
+            flag(is_debugging, "DEBUGGING");
+            writer.write('\n');
+        }
+    }
+
+    ///
+    /// @brief Writes the abbreviation tables of the .debug_abbrev section like objdump --dwarf=abbrev
+    ///
+    inline auto
+    dump_abbrev(BufferedWriter & writer, std::span<char const> const debug_abbrev) -> void
+    {
+        writer.write("Contents of the .debug_abbrev section:\n\n");
+
+        DebugAbbrevParser parser(debug_abbrev);
+        size_t table_offset = 0;
+        bool is_table_start = true;
+        Attribute attribute = {};
+        Tag tag = {};
+
+        while(parser.next()) {
+            if(parser.is_end_of_table()) {
+                table_offset = parser.get_index();
+                is_table_start = true;
+            }
+            else if(parser.is_abbreviation_code() && is_table_start) {
+                writer.write("  Number TAG (").hex_prefixed(table_offset).write(")\n");
+                is_table_start = false;
+            }
+            else if(parser.is_tag()) {
+                tag = parser.get_tag();
+            }
+            else if(parser.is_children()) {
+                writer.write("   ").dec(parser.get_abbreviation_code()).write("      ");
+                details::write_dwarf_name(writer, tag, "Unknown TAG value: 0x");
+                writer.write(parser.get_children() == ChildrenDetermination::dw_children_yes ? "    [has children]\n" : "    [no children]\n");
+            }
+            else if(parser.is_attribute()) {
+                attribute = parser.get_attribute();
+            }
+            else if(parser.is_end_of_attributes()) {
+                writer.write("    DW_AT value: 0     DW_FORM value: 0\n");
+            }
+            else if(parser.is_form()) {
+                writer.write("    ");
+                details::write_dwarf_name(writer, attribute, "Unknown AT value: ", 18);
+                writer.write(' ');
+                details::write_dwarf_name(writer, parser.get_form(), "Unknown FORM value: ");
+                if(parser.get_form() == Form::dw_form_implicit_const) {
+                    writer.write(": ").dec_signed(parser.get_implicit_const());
+                }
+                writer.write('\n');
+            }
+        }
+
+        writer.write('\n');
+    }
+
+    ///
+    /// @brief Writes the header and all entries of one unit like objdump --dwarf=info
+    ///
+    inline auto
+    dump_unit(BufferedWriter & writer, DebugSections const & sections, UnitHeader const & unit_header) -> void
+    {
+        Unit const unit(sections, unit_header);
+
+        writer.write("  Compilation Unit @ offset ").hex_prefixed(unit.offset()).write(":\n");
+        writer.write("   Length:        ").hex_prefixed(unit_header.unit_length()).write(unit_header.is64bit() ? " (64-bit)\n" : " (32-bit)\n");
+        writer.write("   Version:       ").dec(unit.version()).write('\n');
+        if(unit.version() >= 5) {
+            writer.write("   Unit Type:     ");
+            details::write_dwarf_name(writer, unit.unit_type(), "Unknown UT value: 0x");
+            writer.write(" (").dec(static_cast<uint64_t>(unit.unit_type())).write(")\n");
+        }
+        writer.write("   Abbrev Offset: ").hex_prefixed(unit.debug_abbrev_offset()).write('\n');
+        writer.write("   Pointer Size:  ").dec(unit.address_size()).write('\n');
+        if(unit.unit_type() == UnitHeaderUnitType::dw_ut_type || unit.unit_type() == UnitHeaderUnitType::dw_ut_split_type) {
+            writer.write("   Signature:     0x").hex(unit.type_signature(), 16).write('\n');
+            writer.write("   Type Offset:   ").hex_prefixed(unit.type_offset()).write('\n');
+        }
+        else if(unit.unit_type() == UnitHeaderUnitType::dw_ut_skeleton || unit.unit_type() == UnitHeaderUnitType::dw_ut_split_compile) {
+            writer.write("   DWO ID:        0x").hex(unit.dwo_id(), 16).write('\n');
+        }
+
+        auto const & data = sections.debug_info;
+        // objdump forgets the frame base at the next subprogram, not at the end of the subprogram
+        bool has_frame_base = false;
+        size_t depth = 0;
+        size_t offset = unit.first_die_offset();
+        while(offset < unit.end_offset()) {
+            DIE const die(unit, offset);
+            writer.write(" <").dec(depth).write("><").hex(offset).write(">: Abbrev Number: ");
+
+            if(die.is_null()) {
+                writer.write("0\n");
+                offset = die.attributes_offset();
+                depth -= depth > 0 ? 1 : 0;
+                continue;
+            }
+
+            writer.dec(die.abbrev()->code()).write(" (");
+            details::write_dwarf_name(writer, die.tag(), "Unknown TAG value: 0x");
+            writer.write(")\n");
+            if(die.tag() == Tag::dw_tag_subprogram) {
+                has_frame_base = false;
+            }
+
+            size_t index = die.attributes_offset();
+            for(auto const & specification : die.abbrev()->attributes()) {
+                writer.write("    <").hex(index).write(">   ");
+                details::write_dwarf_name(writer, specification.attribute, "Unknown AT value: ", 18);
+                writer.write(": ");
+
+                has_frame_base |= specification.attribute == Attribute::dw_at_frame_base;
+                auto const value = read_form(data, index, specification.form, specification.implicit_const, unit.encoding());
+                details::write_attribute_value(writer, unit, specification.attribute, AttributeValue(unit, value), has_frame_base);
+                writer.write('\n');
+            }
+            count(ReaderCounter::info_bytes, index - die.attributes_offset());
+
+            offset = index;
+            depth += die.has_children() ? 1 : 0;
+        }
+    }
+
+    ///
+    /// @brief Writes all units of the .debug_info section like objdump --dwarf=info
+    /// @details With more than one thread, the worker threads take batches of consecutive units
+    ///     in order and format each into one of a ring of two buffers per thread. The calling
+    ///     thread writes the buffers in the order of the units and hands each back to the ring.
+    /// @param threads the number of worker threads formatting units
+    ///
+    inline auto
+    dump_debug_info(BufferedWriter & writer, DebugSections const & sections, size_t const threads = 1) -> void
+    {
+        StageTimer const timer(ReaderStage::dump);
+        writer.write("Contents of the .debug_info section:\n\n");
+
+        if(threads <= 1) {
+            for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+                dump_unit(writer, sections, unit_header);
+            }
+        }
+        else {
+            // consecutive units are formatted as one batch, so that small units do not cost a hand-off each
+            std::vector<std::vector<UnitHeader>> batches;
+            size_t batch_offset = 0;
+            for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+                if(batches.empty() || unit_header.base_index() - batch_offset >= dump_batch_size) {
+                    batches.emplace_back();
+                    batch_offset = unit_header.base_index();
+                }
+                batches.back().push_back(unit_header);
+            }
+
+            // the batch with index i is formatted into the slot i % slots.size(), once the batch
+            // formatted into that slot before has been written
+            struct Slot final
+            {
+                BufferedWriter text;
+                bool is_ready = false;
+            };
+            std::vector<Slot> slots(2 * threads);
+            std::atomic<size_t> next_batch = 0;
+            std::mutex mutex;
+            std::condition_variable slot_ready;
+            std::condition_variable slot_free;
+            size_t written = 0;
+            std::exception_ptr error;
+
+            auto const fail = [&](std::exception_ptr const exception) {
+                {
+                    std::lock_guard const lock(mutex);
+                    if(!error) {
+                        error = exception;
+                    }
+                }
+                slot_ready.notify_all();
+                slot_free.notify_all();
+            };
+
+            auto const format_batches = [&]() {
+                for(size_t batch = next_batch++; batch < batches.size(); batch = next_batch++) {
+                    auto & slot = slots[batch % slots.size()];
+                    {
+                        std::unique_lock lock(mutex);
+                        slot_free.wait(lock, [&]() { return batch < written + slots.size() || error; });
+                        if(error) {
+                            return;
+                        }
+                    }
+
+                    try {
+                        for(auto const & unit_header : batches[batch]) {
+                            dump_unit(slot.text, sections, unit_header);
+                        }
+                    }
+                    catch(...) {
+                        fail(std::current_exception());
+                        return;
+                    }
+
+                    {
+                        std::lock_guard const lock(mutex);
+                        slot.is_ready = true;
+                    }
+                    slot_ready.notify_all();
+                }
+            };
+
+            std::vector<std::thread> workers;
+            try {
+                for(size_t i = 0; i < std::min(threads, batches.size()); ++i) {
+                    workers.emplace_back(format_batches);
+                }
+
+                for(size_t batch = 0; batch < batches.size(); ++batch) {
+                    auto & slot = slots[batch % slots.size()];
+                    {
+                        std::unique_lock lock(mutex);
+                        slot_ready.wait(lock, [&]() { return slot.is_ready || error; });
+                        if(error) {
+                            break;
+                        }
+                    }
+
+                    writer.write(slot.text.view());
+                    slot.text.clear();
+
+                    {
+                        std::lock_guard const lock(mutex);
+                        slot.is_ready = false;
+                        ++written;
+                    }
+                    slot_free.notify_all();
+                }
+            }
+            catch(...) {
+                fail(std::current_exception());
+            }
+
+            for(auto & worker : workers) {
+                worker.join();
+            }
+            if(error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        writer.write('\n');
+    }
+}
@@ -0,0 +1,241 @@
+///
+/// @file:   dwarf_names.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The names of DWARF constants as printed by objdump
+///
+
+#pragma once
+
+#include "dwarf/debug_abbrev/dubug_abbrev_parser.hpp"
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dwarf
+{
+    namespace details
+    {
+        ///
+        /// @brief Converts the names of an enumeration to the spelling of the DWARF standard
+        /// @details e.g. dw_tag_typedef_ to DW_TAG_typedef, the trailing underscore avoids keywords
+        /// @return the names indexed by value, empty for values without a name
+        ///
+        template<typename ENUM_T>
+        auto
+        make_dwarf_names() -> std::vector<std::string>
+        {
+            std::vector<std::string> res(MAGIC_ENUM_RANGE_MAX + 1);
+            for(size_t index = 0; index < res.size(); ++index) {
+                auto const enum_name = magic_enum::enum_name(static_cast<ENUM_T>(index));
+                if(enum_name.empty()) {
+                    continue;
+                }
+
+                std::string name(enum_name);
+                if(name.ends_with('_')) {
+                    name.pop_back();
+                }
+
+                size_t const prefix_end = std::min(name.find('_', 3), name.size());
+                for(size_t i = 0; i < prefix_end; ++i) {
+                    name[i] = static_cast<char>(name[i] - ('a' <= name[i] && name[i] <= 'z' ? 'a' - 'A' : 0));
+                }
+
+                res[index] = std::move(name);
+            }
+
+            return res;
+        }
+
+        struct UserName final
+        {
+            uint16_t value;
+            std::string_view name;
+        };
+
+        /// @brief Vendor extensions emitted by GCC, outside of the range of magic_enum
+        constexpr std::array<UserName, 19> gnu_attribute_names = {{
+            {0x2007, "DW_AT_MIPS_linkage_name"},
+            {0x2107, "DW_AT_GNU_vector"},
+            {0x2110, "DW_AT_GNU_template_name"},
+            {0x2111, "DW_AT_GNU_call_site_value"},
+            {0x2113, "DW_AT_GNU_call_site_target"},
+            {0x2115, "DW_AT_GNU_tail_call"},
+            {0x2116, "DW_AT_GNU_all_tail_call_sites"},
+            {0x2117, "DW_AT_GNU_all_call_sites"},
+            {0x2119, "DW_AT_GNU_macros"},
+            {0x211a, "DW_AT_GNU_deleted"},
+            {0x2130, "DW_AT_GNU_dwo_name"},
+            {0x2131, "DW_AT_GNU_dwo_id"},
+            {0x2132, "DW_AT_GNU_ranges_base"},
+            {0x2133, "DW_AT_GNU_addr_base"},
+            {0x2134, "DW_AT_GNU_pubnames"},
+            {0x2135, "DW_AT_GNU_pubtypes"},
+            {0x2136, "DW_AT_GNU_discriminator"},
+            {0x2137, "DW_AT_GNU_locviews"},
+            {0x2138, "DW_AT_GNU_entry_view"}
+        }};
+
+        constexpr std::array<UserName, 5> gnu_tag_names = {{
+            {0x4106, "DW_TAG_GNU_template_template_param"},
+            {0x4107, "DW_TAG_GNU_template_parameter_pack"},
+            {0x4108, "DW_TAG_GNU_formal_parameter_pack"},
+            {0x4109, "DW_TAG_GNU_call_site"},
+            {0x410a, "DW_TAG_GNU_call_site_parameter"}
+        }};
+
+        [[nodiscard]] constexpr auto
+        find_user_name(std::span<UserName const> const names, uint64_t const value) noexcept -> std::string_view
+        {
+            for(auto const & entry : names) {
+                if(entry.value == value) {
+                    return entry.name;
+                }
+            }
+            return std::string_view();
+        }
+    }
+
+    ///
+    /// @brief Returns the name of a DWARF constant, e.g. DW_TAG_typedef
+    /// @return an empty string for values without a name
+    ///
+    template<typename ENUM_T>
+    [[nodiscard]] auto
+    dwarf_name(ENUM_T const value) -> std::string_view
+    {
+        static std::vector<std::string> const names = details::make_dwarf_names<ENUM_T>();
+
+        // objdump keeps the spelling of the DWARF 3 draft for the template parameters
+        if constexpr(std::is_same_v<ENUM_T, Tag>) {
+            if(value == Tag::dw_tag_template_type_parameter) {
+                return "DW_TAG_template_type_param";
+            }
+            if(value == Tag::dw_tag_template_value_parameter) {
+                return "DW_TAG_template_value_param";
+            }
+        }
+
+        auto const index = static_cast<size_t>(value);
+        if(index < names.size() && !names[index].empty()) {
+            return names[index];
+        }
+
+        if constexpr(std::is_same_v<ENUM_T, Attribute>) {
+            return details::find_user_name(details::gnu_attribute_names, index);
+        }
+        else if constexpr(std::is_same_v<ENUM_T, Tag>) {
+            return details::find_user_name(details::gnu_tag_names, index);
+        }
+        else {
+            return std::string_view();
+        }
+    }
+
+    ///
+    /// @brief Returns the description of a DW_AT_language value
+    ///
+    [[nodiscard]] constexpr auto
+    language_description(uint64_t const value) noexcept -> std::string_view
+    {
+        constexpr std::array<std::string_view, 0x26> names = {
+            "", "ANSI C", "non-ANSI C", "Ada", "C++", "Cobol 74", "Cobol 85", "FORTRAN 77", "Fortran 90",
+            "ANSI Pascal", "Modula 2", "Java", "ANSI C99", "ADA 95", "Fortran 95", "PLI", "Objective C",
+            "Objective C++", "Unified Parallel C", "D", "Python", "OpenCL", "Go", "Modula 3", "Haskell",
+            "C++03", "C++11", "OCaml", "Rust", "C11", "Swift", "Julia", "Dylan", "C++14", "Fortran 03",
+            "Fortran 08", "RenderScript", "BLISS"
+        };
+
+        if(value < names.size() && value != 0) {
+            return names[value];
+        }
+        if(value == 0x8001) {
+            return "MIPS assembler";
+        }
+        return value >= 0x8000 ? "implementation defined" : "Unknown";
+    }
+
+    ///
+    /// @brief Returns the description of a DW_AT_encoding value
+    ///
+    [[nodiscard]] constexpr auto
+    encoding_description(uint64_t const value) noexcept -> std::string_view
+    {
+        constexpr std::array<std::string_view, 0x13> names = {
+            "void", "machine address", "boolean", "complex float", "float", "signed", "signed char",
+            "unsigned", "unsigned char", "imaginary float", "packed_decimal", "numeric_string", "edited",
+            "signed_fixed", "unsigned_fixed", "decimal_float", "unicode string", "UCS", "ASCII"
+        };
+
+        return value < names.size() ? names[value] : "unknown type";
+    }
+
+    ///
+    /// @brief Returns the description of the value of an attribute with enumerated constants
+    /// @return an empty string if the values of the attribute are not enumerated
+    ///
+    [[nodiscard]] constexpr auto
+    constant_description(Attribute const attribute, uint64_t const value) noexcept -> std::string_view
+    {
+        auto const pick = [value](std::initializer_list<std::string_view> const names, std::string_view const unknown) {
+            return value < names.size() ? names.begin()[value] : unknown;
+        };
+
+        switch (attribute)
+        {
+        case Attribute::dw_at_language:
+            return language_description(value);
+        case Attribute::dw_at_encoding:
+            return encoding_description(value);
+        case Attribute::dw_at_accessibility:
+            return pick({"unknown accessibility", "public", "protected", "private"}, "unknown accessibility");
+        case Attribute::dw_at_visibility:
+            return pick({"unknown visibility", "local", "exported", "qualified"}, "unknown visibility");
+        case Attribute::dw_at_virtuality:
+            return pick({"none", "virtual", "pure_virtual"}, "unknown virtuality");
+        case Attribute::dw_at_inline_:
+            return pick({"not inlined", "inlined", "declared as inline but ignored", "declared as inline and inlined"}, "unknown inline attribute value");
+        case Attribute::dw_at_defaulted:
+            return pick({"no", "in class", "out of class"}, "unknown");
+        case Attribute::dw_at_calling_convention:
+            return pick({"unknown convention", "normal", "program", "nocall", "pass by ref", "pass by value"}, "unknown convention");
+        case Attribute::dw_at_ordering:
+            return pick({"row major", "column major"}, "unknown ordering");
+        case Attribute::dw_at_identifier_case:
+            return pick({"case_sensitive", "up_case", "down_case", "case_insensitive"}, "unknown case");
+        case Attribute::dw_at_endianity:
+            return pick({"default", "big", "little"}, "unknown endianity");
+        default:
+            return std::string_view();
+        }
+    }
+
+    ///
+    /// @brief Returns the name of a register in the DWARF register numbering of the target
+    /// @param address_size 8 for x86-64, 4 for i386
+    /// @return an empty string for an unknown register
+    ///
+    [[nodiscard]] constexpr auto
+    register_name(uint64_t const number, uint8_t const address_size) noexcept -> std::string_view
+    {
+        constexpr std::array<std::string_view, 49> x86_64 = {
+            "rax", "rdx", "rcx", "rbx", "rsi", "rdi", "rbp", "rsp", "r8", "r9", "r10", "r11", "r12",
+            "r13", "r14", "r15", "rip", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7",
+            "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15", "st0", "st1", "st2",
+            "st3", "st4", "st5", "st6", "st7", "mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7"
+        };
+        constexpr std::array<std::string_view, 10> i386 = {
+            "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi", "eip", "eflags"
+        };
+
+        if(address_size == 8 && number < x86_64.size()) {
+            return x86_64[number];
+        }
+        if(address_size == 4 && number < i386.size()) {
+            return i386[number];
+        }
+        return std::string_view();
+    }
+}
@@ -33,7 +33,7 @@ namespace dwarf
         dw_tag_formal_parameter = 0x05,
         dw_tag_reserved1 = 0x06,
         dw_tag_reserved2 = 0x07,
-        dw_tag_imported_decleration = 0x08,
+        dw_tag_imported_declaration = 0x08,
         dw_tag_reserved3 = 0x09,
         dw_tag_label = 0x0a,
         dw_tag_lexical_block = 0x0b,
@@ -142,7 +142,7 @@ namespace dwarf
         dw_at_discr_value = 0x16,
         dw_at_visibility = 0x17,
         dw_at_import = 0x18,
-        dw_at_sting_length = 0x19,
+        dw_at_string_length = 0x19,
         dw_at_common_reference = 0x1a,
         dw_at_comp_dir = 0x1b,
         dw_at_const_value = 0x1c,
@@ -237,7 +237,7 @@ namespace dwarf
         
         dw_at_string_length_byte_size = 0x70,
         dw_at_rank = 0x71,
-        dw_at_str_offset_base = 0x72,
+        dw_at_str_offsets_base = 0x72,
         dw_at_addr_base = 0x73,
         dw_at_rnglists_base = 0x74,
         dw_at_reserved21 = 0x75,
@@ -516,6 +516,18 @@ namespace dwarf
         dw_lle_start_length = 0x08
     };
 
+    enum class RangeListEntry : uint8_t 
+    {
+        dw_rle_end_of_list = 0x00,
+        dw_rle_base_addressx = 0x01,
+        dw_rle_startx_endx = 0x02,
+        dw_rle_startx_length = 0x03,
+        dw_rle_offset_pair = 0x04,
+        dw_rle_base_address = 0x05,
+        dw_rle_start_end = 0x06,
+        dw_rle_start_length = 0x07
+    };
+
     enum class BaseTypeAttributeEncoding : uint8_t 
     {
         dw_ate_address = 0x01,
@@ -743,6 +755,18 @@ namespace dwarf
         dw_macro_lo_user = 0xe0,
         dw_macro_hi_user = 0xff
     };
+
+    enum class SectionIdentifier : uint32_t
+    {
+        dw_sect_info = 1,
+        dw_sect_reserved = 2,
+        dw_sect_abbrev = 3,
+        dw_sect_line = 4,
+        dw_sect_loclists = 5,
+        dw_sect_str_offsets = 6,
+        dw_sect_macro = 7,
+        dw_sect_rnglists = 8
+    };
 }
 
 
@@ -0,0 +1,218 @@
+///
+/// @file:   image_arena.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Owns all objects derived from one binary image
+///
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+namespace dwarf
+{
+    /// @class dwarf::CountingResource
+    ///
+    /// @brief Forwards to another memory resource and counts the allocations
+    ///
+    class CountingResource final : public std::pmr::memory_resource
+    {
+    public:
+
+        ///
+        /// @brief constructor
+        /// @param upstream the memory resource which allocates the memory
+        ///
+        explicit CountingResource(std::pmr::memory_resource * const upstream = std::pmr::get_default_resource()) noexcept
+            : upstream_(upstream) {}
+
+        [[nodiscard]] auto
+        allocation_count() const noexcept -> size_t
+        {
+            return allocation_count_;
+        }
+
+        [[nodiscard]] auto
+        allocated_bytes() const noexcept -> size_t
+        {
+            return allocated_bytes_;
+        }
+
+        [[nodiscard]] auto
+        upstream() const noexcept -> std::pmr::memory_resource *
+        {
+            return upstream_;
+        }
+
+    private:
+        auto
+        do_allocate(size_t const bytes, size_t const alignment) -> void * override
+        {
+            ++allocation_count_;
+            allocated_bytes_ += bytes;
+            return upstream_->allocate(bytes, alignment);
+        }
+
+        auto
+        do_deallocate(void * const p, size_t const bytes, size_t const alignment) -> void override
+        {
+            upstream_->deallocate(p, bytes, alignment);
+        }
+
+        [[nodiscard]] auto
+        do_is_equal(std::pmr::memory_resource const & other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+
+        std::pmr::memory_resource * upstream_ = nullptr;
+        size_t allocation_count_ = 0;
+        size_t allocated_bytes_ = 0;
+    };
+
+    /// @class dwarf::ImageArena
+    ///
+    /// @brief Owns all objects derived from one binary image, e.g. tree nodes and interned names
+    /// @details Objects are allocated contiguously from large blocks of a monotonic buffer and are
+    ///     released together when the arena is destroyed or released, objects are never freed
+    ///     one by one. Containers of the library which take a std::pmr::memory_resource can use
+    ///     resource() to place their elements into the arena. The blocks are requested from an
+    ///     upstream memory resource supplied by the caller.
+    ///     Not thread safe.
+    ///
+    class ImageArena final
+    {
+    public:
+
+        ///
+        /// @brief constructor
+        /// @param upstream the memory resource the blocks of the arena are allocated from
+        /// @param initial_size the size of the first block, following blocks grow geometrically
+        ///
+        explicit ImageArena(std::pmr::memory_resource * const upstream = std::pmr::get_default_resource(),
+            size_t const initial_size = 64 * 1024)
+            : counting_(upstream), buffer_(initial_size, &counting_), strings_(&buffer_) {}
+
+        ImageArena(ImageArena const &) = delete;
+        auto operator=(ImageArena const &) -> ImageArena & = delete;
+
+        ///
+        /// @brief Returns the memory resource of the arena for std::pmr containers
+        ///
+        [[nodiscard]] auto
+        resource() noexcept -> std::pmr::memory_resource *
+        {
+            return &buffer_;
+        }
+
+        ///
+        /// @brief Creates an object in the arena
+        /// @details The destructor is never called, so only trivially destructible types are allowed
+        ///
+        template<typename T, typename... ARGS_T>
+        [[nodiscard]] auto
+        create(ARGS_T &&... args) -> T *
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "objects in the arena are never destroyed");
+
+            void * const p = buffer_.allocate(sizeof(T), alignof(T));
+            ++object_count_;
+            return ::new(p) T(std::forward<ARGS_T>(args)...);
+        }
+
+        ///
+        /// @brief Creates an array of default initialized objects in the arena
+        ///
+        template<typename T>
+        [[nodiscard]] auto
+        create_array(size_t const count) -> T *
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "objects in the arena are never destroyed");
+
+            void * const p = buffer_.allocate(sizeof(T) * count, alignof(T));
+            ++object_count_;
+            return ::new(p) T[count]();
+        }
+
+        ///
+        /// @brief Stores a string once in the arena
+        /// @return the stored string, equal strings return the same address
+        ///
+        [[nodiscard]] auto
+        intern(std::string_view const str) -> std::string_view
+        {
+            auto const it = strings_.find(str);
+            if(it != strings_.end()) {
+                return *it;
+            }
+
+            char * const p = static_cast<char *>(buffer_.allocate(str.size() + 1, alignof(char)));
+            std::memcpy(p, str.data(), str.size());
+            p[str.size()] = '\0';
+
+            std::string_view const res(p, str.size());
+            strings_.insert(res);
+            return res;
+        }
+
+        ///
+        /// @brief Releases all objects and strings at once
+        ///
+        auto
+        release() -> void
+        {
+            // the set allocates from the buffer, so it must be emptied before
+            strings_ = std::pmr::unordered_set<std::string_view>(&buffer_);
+            buffer_.release();
+            object_count_ = 0;
+        }
+
+        ///
+        /// @brief Returns the number of objects created with create() and create_array()
+        ///
+        [[nodiscard]] auto
+        object_count() const noexcept -> size_t
+        {
+            return object_count_;
+        }
+
+        ///
+        /// @brief Returns the number of distinct interned strings
+        ///
+        [[nodiscard]] auto
+        string_count() const noexcept -> size_t
+        {
+            return strings_.size();
+        }
+
+        ///
+        /// @brief Returns the number of blocks allocated from the upstream memory resource
+        ///
+        [[nodiscard]] auto
+        upstream_allocation_count() const noexcept -> size_t
+        {
+            return counting_.allocation_count();
+        }
+
+        ///
+        /// @brief Returns the number of bytes allocated from the upstream memory resource
+        ///
+        [[nodiscard]] auto
+        upstream_allocated_bytes() const noexcept -> size_t
+        {
+            return counting_.allocated_bytes();
+        }
+
+    private:
+        CountingResource counting_;
+        std::pmr::monotonic_buffer_resource buffer_;
+        std::pmr::unordered_set<std::string_view> strings_;
+        size_t object_count_ = 0;
+    };
+}
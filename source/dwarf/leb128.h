@@ -7,9 +7,12 @@
 
 #pragma once
 
+#include "dwarf/reader_statistics.hpp"
 #include <cstdint>
 #include <cstddef>
 #include <span>
+#include <bit>
+#include <type_traits>
 
 /// 
 /// \brief   Decodes an unsigned Little Endian Base 128 (LEB128) encoded number
@@ -49,41 +52,107 @@ inline size_t decodeUleb128(std::span<uint8_t const> const data, uint64_t & resu
 
 namespace details 
 {
-
+    /// 
+    /// \brief The decoded number and the number of bytes read, 0 if decoding failed
+    ///
+    template<typename T>
+    struct Leb128Result 
+    {
+        T val;
+        size_t bytes_read;
+    };
+
+    /// 
+    /// \brief Decodes an unsigned LEB128 number starting at an index of the data
+    /// \details Reading with an index instead of a subspan of the data takes much less 
+    ///     constexpr evaluation steps and memory in large sections
+    ///
     template<typename T>
     [[nodiscard]] constexpr auto
-    uleb128(std::span<const char> const & data) 
+    uleb128(std::span<const char> const & data, size_t const index) -> Leb128Result<T>
     {
-        struct Res {
-            T val;
-            size_t bytes_read;
-        };
+        using Res = Leb128Result<T>;
 
         Res res = {};
 
-        size_t n = 0;
+        size_t n = index;
         size_t shift = 0;
 
-        if(data.empty()) 
-        {
-            return Res();
-        }
-
-        while(true) {
+        while(n < data.size()) {
             uint8_t const byte = std::bit_cast<uint8_t>(data[n++]);
-            res.val |= (byte & 0x7F) << shift;
+            if(shift < sizeof(T) * 8) {
+                res.val |= static_cast<T>(byte & 0x7F) << shift;
+            }
             shift += 7;
 
             if((byte & 0x80) == 0) 
             {   // success
-                res.bytes_read = n;
+                res.bytes_read = n - index;
+                dwarf::count(dwarf::ReaderCounter::leb128_calls);
+                dwarf::count(dwarf::ReaderCounter::leb128_bytes, res.bytes_read);
                 return res;
             }
-            else if(n >= data.size()) 
-            {   // decoding failed
-                return Res();
+        }  
+
+        // decoding failed
+        return Res();
+    }
+
+    /// 
+    /// \brief The number of bytes of the longest LEB128 encoding of a value of type T, 7 bits per byte
+    ///
+    template<typename T>
+    constexpr size_t max_leb128_size = (sizeof(T) * 8 + 6) / 7;
+
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    uleb128(std::span<const char> const & data) -> Leb128Result<T>
+    {
+        return uleb128<T>(data, 0);
+    }
+
+    /// 
+    /// \brief Decodes a signed LEB128 number starting at an index of the data
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    sleb128(std::span<const char> const & data, size_t const index) -> Leb128Result<T>
+    {
+        using Res = Leb128Result<T>;
+        using UnsignedType = std::make_unsigned_t<T>;
+
+        UnsignedType val = 0;
+        size_t n = index;
+        size_t shift = 0;
+
+        while(n < data.size()) {
+            uint8_t const byte = std::bit_cast<uint8_t>(data[n++]);
+            if(shift < sizeof(T) * 8) {
+                val |= static_cast<UnsignedType>(byte & 0x7F) << shift;
+            }
+            shift += 7;
+
+            if((byte & 0x80) == 0) 
+            {   // success
+                if(shift < sizeof(T) * 8 && (byte & 0x40) != 0) {
+                    val |= ~static_cast<UnsignedType>(0) << shift;     // sign extend
+                }
+
+                dwarf::count(dwarf::ReaderCounter::leb128_calls);
+                dwarf::count(dwarf::ReaderCounter::leb128_bytes, n - index);
+                return Res{static_cast<T>(val), n - index};
             }
         }  
+
+        // decoding failed
+        return Res();
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    sleb128(std::span<const char> const & data) -> Leb128Result<T>
+    {
+        return sleb128<T>(data, 0);
     }
 };
 
@@ -0,0 +1,135 @@
+///
+/// @file:   mapped_file.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  A read-only memory mapping of a file
+///
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dwarf
+{
+    /// @class dwarf::MappedFile
+    ///
+    /// @brief Maps a complete file read-only into memory
+    /// @details The pages are loaded by the operating system on first access, so mapping a large
+    ///     file is cheap and only the sections that are read occupy memory. The mapping is
+    ///     removed when the object is destroyed.
+    ///
+    class MappedFile final
+    {
+    public:
+        MappedFile() noexcept = default;
+
+        ///
+        /// @brief constructor
+        /// @param path the file to map
+        /// @details If the file can not be opened or is empty, is_open() returns false
+        ///
+        explicit MappedFile(std::filesystem::path const & path) noexcept
+        {
+#if defined(_WIN32)
+            HANDLE const file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if(file == INVALID_HANDLE_VALUE) {
+                return;
+            }
+
+            LARGE_INTEGER size = {};
+            if(GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+                HANDLE const mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if(mapping != nullptr) {
+                    void * const p = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    if(p != nullptr) {
+                        data_ = std::span<char const>(static_cast<char const *>(p), static_cast<size_t>(size.QuadPart));
+                    }
+                    CloseHandle(mapping);
+                }
+            }
+            CloseHandle(file);
+#else
+            int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if(fd < 0) {
+                return;
+            }
+
+            struct stat status = {};
+            if(::fstat(fd, &status) == 0 && status.st_size > 0) {
+                void * const p = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if(p != MAP_FAILED) {
+                    data_ = std::span<char const>(static_cast<char const *>(p), static_cast<size_t>(status.st_size));
+                }
+            }
+            ::close(fd);
+#endif
+        }
+
+        MappedFile(MappedFile const &) = delete;
+        auto operator=(MappedFile const &) -> MappedFile & = delete;
+
+        MappedFile(MappedFile && other) noexcept
+            : data_(std::exchange(other.data_, {})) {}
+
+        auto
+        operator=(MappedFile && other) noexcept -> MappedFile &
+        {
+            if(this != &other) {
+                unmap();
+                data_ = std::exchange(other.data_, {});
+            }
+            return *this;
+        }
+
+        ~MappedFile()
+        {
+            unmap();
+        }
+
+        [[nodiscard]] auto
+        is_open() const noexcept -> bool
+        {
+            return !data_.empty();
+        }
+
+        ///
+        /// @brief Returns the content of the file
+        ///
+        [[nodiscard]] auto
+        data() const noexcept -> std::span<char const>
+        {
+            return data_;
+        }
+
+    private:
+        auto
+        unmap() noexcept -> void
+        {
+            if(data_.empty()) {
+                return;
+            }
+#if defined(_WIN32)
+            UnmapViewOfFile(data_.data());
+#else
+            ::munmap(const_cast<char *>(data_.data()), data_.size());
+#endif
+            data_ = {};
+        }
+
+        std::span<char const> data_ = {};
+    };
+}
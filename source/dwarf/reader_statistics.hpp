@@ -0,0 +1,349 @@
+///
+/// @file:   reader_statistics.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Counts the work of the reader on its hot paths, enabled with DWARF_READER_HAS_STATISTICS
+///
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#if defined(DWARF_READER_HAS_STATISTICS)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+#endif
+
+namespace dwarf
+{
+    /// @brief True if the library counts its work, set with the CMake option DWARF_READER_STATISTICS
+#if defined(DWARF_READER_HAS_STATISTICS)
+    constexpr bool has_reader_statistics = true;
+#else
+    constexpr bool has_reader_statistics = false;
+#endif
+
+    ///
+    /// @brief The events counted on the hot paths of the reader
+    ///
+    enum class ReaderCounter : uint8_t
+    {
+        /// @brief Decoded LEB128 numbers
+        leb128_calls,
+        /// @brief Bytes of all decoded LEB128 numbers
+        leb128_bytes,
+        /// @brief Bytes of entries decoded from .debug_info
+        info_bytes,
+        /// @brief Bytes of abbreviation tables decoded from .debug_abbrev
+        abbrev_bytes,
+        /// @brief Bytes of strings read from .debug_str
+        str_bytes,
+        /// @brief Bytes of line number programs read from .debug_line
+        line_bytes,
+        /// @brief Decoded abbreviation tables
+        abbrev_tables,
+        /// @brief Abbreviations found by their code as index, the codes of the table are consecutive
+        abbrev_hits,
+        /// @brief Abbreviations searched in a table with codes that are not consecutive
+        abbrev_misses,
+        /// @brief Units with a decoded header and abbreviation table
+        units,
+        /// @brief Entries visited by a dwarf::DieCursor
+        entries_visited,
+        /// @brief Entries skipped with dwarf::DieCursor::skip_children()
+        entries_skipped,
+        count
+    };
+
+    constexpr std::array<std::string_view, static_cast<size_t>(ReaderCounter::count)> reader_counter_names = {
+        "leb128_calls", "leb128_bytes", "info_bytes", "abbrev_bytes", "str_bytes", "line_bytes",
+        "abbrev_tables", "abbrev_hits", "abbrev_misses", "units", "entries_visited", "entries_skipped"
+    };
+
+    ///
+    /// @brief The stages of the pipeline whose time is measured
+    ///
+    enum class ReaderStage : uint8_t
+    {
+        /// @brief Finding the debug sections in the section table
+        sections,
+        /// @brief Decompressing compressed debug sections
+        decompress,
+        /// @brief Building the index of units, names and addresses
+        index,
+        /// @brief Adding units to the type graph
+        type_graph,
+        /// @brief Formatting .debug_info like objdump
+        dump,
+        /// @brief Symbolizing addresses
+        symbolize,
+        count
+    };
+
+    constexpr std::array<std::string_view, static_cast<size_t>(ReaderStage::count)> reader_stage_names = {
+        "sections", "decompress", "index", "type_graph", "dump", "symbolize"
+    };
+
+    /// @class dwarf::ReaderStatistics
+    ///
+    /// @brief The counters of all threads, added up
+    ///
+    struct ReaderStatistics final
+    {
+        std::array<uint64_t, static_cast<size_t>(ReaderCounter::count)> counters = {};
+        /// @brief The time spent in each stage
+        std::array<uint64_t, static_cast<size_t>(ReaderStage::count)> stage_nanoseconds = {};
+        /// @brief How often each stage was entered
+        std::array<uint64_t, static_cast<size_t>(ReaderStage::count)> stage_calls = {};
+
+        [[nodiscard]] constexpr auto
+        operator[](ReaderCounter const counter) const noexcept -> uint64_t
+        {
+            return counters[static_cast<size_t>(counter)];
+        }
+
+        ///
+        /// @brief Returns the average number of bytes of a LEB128 number
+        ///
+        [[nodiscard]] constexpr auto
+        leb128_average_length() const noexcept -> double
+        {
+            auto const calls = (*this)[ReaderCounter::leb128_calls];
+            return calls == 0 ? 0.0 : static_cast<double>((*this)[ReaderCounter::leb128_bytes]) / static_cast<double>(calls);
+        }
+
+        [[nodiscard]] constexpr auto
+        stage_seconds(ReaderStage const stage) const noexcept -> double
+        {
+            return static_cast<double>(stage_nanoseconds[static_cast<size_t>(stage)]) * 1e-9;
+        }
+    };
+}
+
+#if defined(DWARF_READER_HAS_STATISTICS)
+namespace details
+{
+    /// @class details::ThreadCounters
+    ///
+    /// @brief The counters of one thread, only written by the thread, read by any thread
+    ///
+    struct ThreadCounters final
+    {
+        std::array<std::atomic<uint64_t>, static_cast<size_t>(dwarf::ReaderCounter::count)> counters = {};
+        std::array<std::atomic<uint64_t>, static_cast<size_t>(dwarf::ReaderStage::count)> stage_nanoseconds = {};
+        std::array<std::atomic<uint64_t>, static_cast<size_t>(dwarf::ReaderStage::count)> stage_calls = {};
+    };
+
+    ///
+    /// @brief Adds to a counter only written by the calling thread, cheaper than fetch_add
+    ///
+    inline auto
+    add(std::atomic<uint64_t> & counter, uint64_t const value) noexcept -> void
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    template<size_t SIZE>
+    auto
+    add_to(std::array<uint64_t, SIZE> & sum, std::array<std::atomic<uint64_t>, SIZE> const & counters) noexcept -> void
+    {
+        for(size_t i = 0; i < SIZE; ++i) {
+            sum[i] += counters[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    /// @class details::CounterRegistry
+    ///
+    /// @brief The counters of all running threads and the sum of the counters of finished threads
+    ///
+    class CounterRegistry final
+    {
+    public:
+        auto
+        add(ThreadCounters * const counters) -> void
+        {
+            std::scoped_lock const lock(mutex_);
+            threads_.push_back(counters);
+        }
+
+        auto
+        remove(ThreadCounters * const counters) -> void
+        {
+            std::scoped_lock const lock(mutex_);
+            add_to(finished_.counters, counters->counters);
+            add_to(finished_.stage_nanoseconds, counters->stage_nanoseconds);
+            add_to(finished_.stage_calls, counters->stage_calls);
+            threads_.erase(std::find(threads_.begin(), threads_.end(), counters));
+        }
+
+        [[nodiscard]] auto
+        sum() const -> dwarf::ReaderStatistics
+        {
+            std::scoped_lock const lock(mutex_);
+            dwarf::ReaderStatistics res = finished_;
+            for(auto const * const counters : threads_) {
+                add_to(res.counters, counters->counters);
+                add_to(res.stage_nanoseconds, counters->stage_nanoseconds);
+                add_to(res.stage_calls, counters->stage_calls);
+            }
+            return res;
+        }
+
+        ///
+        /// @brief Sets the counters of all threads to 0, not synchronized with threads counting
+        ///
+        auto
+        reset() -> void
+        {
+            std::scoped_lock const lock(mutex_);
+            finished_ = {};
+            for(auto * const counters : threads_) {
+                for(auto & counter : counters->counters) {
+                    counter.store(0, std::memory_order_relaxed);
+                }
+                for(auto & counter : counters->stage_nanoseconds) {
+                    counter.store(0, std::memory_order_relaxed);
+                }
+                for(auto & counter : counters->stage_calls) {
+                    counter.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector<ThreadCounters *> threads_;
+        dwarf::ReaderStatistics finished_;
+    };
+
+    inline auto
+    counter_registry() -> CounterRegistry &
+    {
+        static CounterRegistry registry;
+        return registry;
+    }
+
+    /// @class details::ThreadCountersSlot
+    ///
+    /// @brief Registers the counters of a thread while the thread runs
+    ///
+    struct ThreadCountersSlot final
+    {
+        ThreadCountersSlot()
+        {
+            counter_registry().add(&counters);
+        }
+
+        ThreadCountersSlot(ThreadCountersSlot const &) = delete;
+        auto operator=(ThreadCountersSlot const &) -> ThreadCountersSlot & = delete;
+
+        ~ThreadCountersSlot()
+        {
+            counter_registry().remove(&counters);
+        }
+
+        ThreadCounters counters;
+    };
+
+    inline auto
+    thread_counters() -> ThreadCounters &
+    {
+        thread_local ThreadCountersSlot slot;
+        return slot.counters;
+    }
+
+    inline auto
+    now_nanoseconds() noexcept -> uint64_t
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+}
+#endif
+
+namespace dwarf
+{
+    ///
+    /// @brief Adds to a counter of the calling thread
+    /// @details Does nothing during constant evaluation and without DWARF_READER_HAS_STATISTICS
+    ///
+    constexpr auto
+    count([[maybe_unused]] ReaderCounter const counter, [[maybe_unused]] uint64_t const value = 1) noexcept -> void
+    {
+#if defined(DWARF_READER_HAS_STATISTICS)
+        if(!std::is_constant_evaluated()) {
+            ::details::add(::details::thread_counters().counters[static_cast<size_t>(counter)], value);
+        }
+#endif
+    }
+
+    /// @class dwarf::StageTimer
+    ///
+    /// @brief Adds the time until it is destroyed to a stage of the calling thread
+    /// @details Does nothing during constant evaluation and without DWARF_READER_HAS_STATISTICS
+    ///
+    class StageTimer final
+    {
+    public:
+        explicit constexpr StageTimer([[maybe_unused]] ReaderStage const stage) noexcept
+#if defined(DWARF_READER_HAS_STATISTICS)
+            : stage_(stage)
+        {
+            if(!std::is_constant_evaluated()) {
+                start_ = ::details::now_nanoseconds();
+            }
+        }
+#else
+        {}
+#endif
+
+        StageTimer(StageTimer const &) = delete;
+        auto operator=(StageTimer const &) -> StageTimer & = delete;
+
+#if defined(DWARF_READER_HAS_STATISTICS)
+        constexpr ~StageTimer()
+        {
+            if(!std::is_constant_evaluated()) {
+                auto & counters = ::details::thread_counters();
+                ::details::add(counters.stage_nanoseconds[static_cast<size_t>(stage_)], ::details::now_nanoseconds() - start_);
+                ::details::add(counters.stage_calls[static_cast<size_t>(stage_)], 1);
+            }
+        }
+
+    private:
+        ReaderStage stage_;
+        uint64_t start_ = 0;
+#endif
+    };
+
+    ///
+    /// @brief Returns the counters of all threads added up
+    /// @return all counters 0 without DWARF_READER_HAS_STATISTICS
+    ///
+    [[nodiscard]] inline auto
+    reader_statistics() -> ReaderStatistics
+    {
+#if defined(DWARF_READER_HAS_STATISTICS)
+        return ::details::counter_registry().sum();
+#else
+        return {};
+#endif
+    }
+
+    ///
+    /// @brief Sets the counters of all threads to 0
+    ///
+    inline auto
+    reset_reader_statistics() -> void
+    {
+#if defined(DWARF_READER_HAS_STATISTICS)
+        ::details::counter_registry().reset();
+#endif
+    }
+}
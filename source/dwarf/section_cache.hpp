@@ -0,0 +1,542 @@
+///
+/// @file:   section_cache.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Decompresses compressed debug sections on first access
+///
+
+#pragma once
+
+#include "dwarf/debug_sections.hpp"
+#include "details/bit_cast.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#if defined(DWARF_READER_HAS_ZLIB)
+#include <zlib.h>
+#endif
+
+#if defined(DWARF_READER_HAS_ZSTD)
+#include <zstd.h>
+#endif
+
+namespace dwarf
+{
+    enum class SectionCompression : uint8_t
+    {
+        none,
+        zlib,
+        zstd
+    };
+
+    /// @class dwarf::CompressionHeader
+    ///
+    /// @brief The header in front of the compressed data of a section
+    ///
+    struct CompressionHeader final
+    {
+        SectionCompression compression = SectionCompression::none;
+        /// @brief The size of the header, the compressed data follows the header
+        size_t header_size = 0;
+        /// @brief The size of the decompressed data
+        uint64_t size = 0;
+    };
+
+    ///
+    /// @brief Reads the header of a GNU .zdebug_ section, "ZLIB" followed by the size as 8 byte big endian
+    /// @return a header with SectionCompression::none if the section has no such header
+    ///
+    [[nodiscard]] constexpr auto
+    read_zdebug_header(std::span<char const> const data) noexcept -> CompressionHeader
+    {
+        size_t const header_size = 12;
+        if(data.size() < header_size || std::string_view(data.data(), 4) != "ZLIB") {
+            return {};
+        }
+
+        uint64_t size = 0;
+        for(size_t i = 4; i < header_size; ++i) {
+            size = (size << 8) | static_cast<uint8_t>(data[i]);
+        }
+
+        return {SectionCompression::zlib, header_size, size};
+    }
+
+    ///
+    /// @brief Reads the Elf64_Chdr header of a section with the SHF_COMPRESSED flag
+    /// @details ch_type, ch_reserved, ch_size and ch_addralign, little endian.
+    ///     The flag is stored in the ELF section header, so the caller decides if a section has this header.
+    /// @return a header with SectionCompression::none for an unknown ch_type
+    ///
+    [[nodiscard]] constexpr auto
+    read_elf_compression_header(std::span<char const> const data) -> CompressionHeader
+    {
+        size_t const header_size = 24;
+        if(data.size() < header_size) {
+            return {};
+        }
+
+        auto const type = ::details::bit_cast<uint32_t>(data, 0);
+        auto const size = ::details::bit_cast<uint64_t>(data, 8);
+
+        switch(type) {
+            case 1: return {SectionCompression::zlib, header_size, size};   // ELFCOMPRESS_ZLIB
+            case 2: return {SectionCompression::zstd, header_size, size};   // ELFCOMPRESS_ZSTD
+            default: return {};
+        }
+    }
+
+    /// @class dwarf::CompressedSection
+    ///
+    /// @brief A compressed section, decompressed in chunks on demand
+    /// @details The buffer of the decompressed data is allocated once with the size of the header,
+    ///     so a prefix stays valid while more data is decompressed. prefix() decompresses only up to
+    ///     the requested size, e.g. to read the first units of a large section before the rest is
+    ///     decompressed. Thread safe, the decompressed part is read without a lock.
+    ///
+    class CompressedSection final
+    {
+    public:
+        static constexpr size_t default_chunk_size = 64 * 1024;
+
+        ///
+        /// @brief constructor
+        /// @param data the data of the section including the compression header
+        /// @param header the compression header of the section
+        /// @param chunk_size the size decompressed at once
+        ///
+        CompressedSection(std::span<char const> const data, CompressionHeader const & header, size_t const chunk_size = default_chunk_size)
+            : compressed_(data.subspan(std::min(header.header_size, data.size()))), header_(header),
+              chunk_size_(std::clamp<size_t>(chunk_size, 1, UINT_MAX))
+        {
+            check_size();
+            buffer_ = std::make_unique_for_overwrite<char[]>(header_.size);
+        }
+
+        CompressedSection(CompressedSection const &) = delete;
+        auto operator=(CompressedSection const &) -> CompressedSection & = delete;
+
+        ~CompressedSection()
+        {
+            end_decoder();
+        }
+
+        [[nodiscard]] auto
+        compression() const noexcept -> SectionCompression
+        {
+            return header_.compression;
+        }
+
+        ///
+        /// @brief Returns the size of the decompressed data
+        ///
+        [[nodiscard]] auto
+        size() const noexcept -> size_t
+        {
+            return header_.size;
+        }
+
+        [[nodiscard]] auto
+        compressed_size() const noexcept -> size_t
+        {
+            return compressed_.size();
+        }
+
+        ///
+        /// @brief Returns the size of the data decompressed so far
+        ///
+        [[nodiscard]] auto
+        available() const noexcept -> size_t
+        {
+            return available_.load(std::memory_order_acquire);
+        }
+
+        ///
+        /// @brief Returns the first bytes of the decompressed data
+        /// @param size the number of bytes, limited to size()
+        ///
+        [[nodiscard]] auto
+        prefix(size_t const size) -> std::span<char const>
+        {
+            size_t const required = std::min(size, this->size());
+            if(available() < required) {
+                std::lock_guard const lock(mutex_);
+                decompress(required);
+            }
+
+            return std::span<char const>(buffer_.get(), required);
+        }
+
+        ///
+        /// @brief Returns the complete decompressed data
+        ///
+        [[nodiscard]] auto
+        data() -> std::span<char const>
+        {
+            return prefix(size());
+        }
+
+    private:
+        ///
+        /// @brief Rejects a decompressed size in the header that the compressed data cannot produce
+        /// @details The buffer is allocated with the size of the header, so a corrupt header would
+        ///     otherwise allocate gigabytes before the first byte is decompressed.
+        ///
+        auto
+        check_size() const -> void
+        {
+            // zlib expands the data at most by a factor of 1032, zstd by 32768 with a 4 byte RLE
+            // block of 128 KiB
+            size_t const max_ratio = header_.compression == SectionCompression::zstd ? 32768 : 1032;
+            if(header_.size / max_ratio > compressed_.size()) {
+                throw std::range_error("compressed section: size out of bounds");
+            }
+
+#if defined(DWARF_READER_HAS_ZSTD)
+            if(header_.compression == SectionCompression::zstd) {
+                auto const content_size = ZSTD_getFrameContentSize(compressed_.data(), compressed_.size());
+                if(content_size == ZSTD_CONTENTSIZE_ERROR) {
+                    throw std::range_error("compressed section: invalid zstd frame header");
+                }
+
+                // the size of the first frame, the data may be split into several frames
+                bool const is_single_frame = ZSTD_findFrameCompressedSize(compressed_.data(), compressed_.size()) == compressed_.size();
+                if(content_size != ZSTD_CONTENTSIZE_UNKNOWN
+                    && (content_size > header_.size || (is_single_frame && content_size != header_.size))) {
+                    throw std::range_error("compressed section: size does not match the zstd frame");
+                }
+            }
+#endif
+        }
+
+        ///
+        /// @brief Decompresses chunks until at least size bytes are available
+        ///
+        auto
+        decompress(size_t const size) -> void
+        {
+            StageTimer const timer(ReaderStage::decompress);
+            size_t available = available_.load(std::memory_order_relaxed);
+            while(available < size) {
+                size_t const chunk = std::min(chunk_size_, header_.size - available);
+                size_t const produced = decompress_chunk(buffer_.get() + available, chunk);
+                if(produced == 0) {
+                    throw std::range_error("compressed section: data truncated");
+                }
+
+                available += produced;
+                available_.store(available, std::memory_order_release);
+            }
+
+            if(available == header_.size) {
+                end_decoder();
+            }
+        }
+
+        ///
+        /// @brief Decompresses the next bytes of the section
+        /// @return the number of bytes written to output
+        ///
+        auto
+        decompress_chunk([[maybe_unused]] char * const output, [[maybe_unused]] size_t const size) -> size_t
+        {
+            switch(header_.compression) {
+#if defined(DWARF_READER_HAS_ZLIB)
+                case SectionCompression::zlib: {
+                    if(!is_zlib_initialized_) {
+                        zlib_ = {};
+                        if(inflateInit(&zlib_) != Z_OK) {
+                            throw std::range_error("compressed section: zlib initialization failed");
+                        }
+                        is_zlib_initialized_ = true;
+                    }
+
+                    zlib_.next_out = reinterpret_cast<Bytef *>(output);
+                    zlib_.avail_out = static_cast<uInt>(size);
+
+                    // a call may consume input without producing output
+                    int res = Z_OK;
+                    while(res == Z_OK && zlib_.avail_out == size) {
+                        // avail_in is 32 bit, larger sections are passed in parts
+                        if(zlib_.avail_in == 0) {
+                            if(input_offset_ == compressed_.size()) {
+                                break;
+                            }
+                            zlib_.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(compressed_.data() + input_offset_));
+                            zlib_.avail_in = static_cast<uInt>(std::min<size_t>(compressed_.size() - input_offset_, UINT_MAX));
+                            input_offset_ += zlib_.avail_in;
+                        }
+
+                        res = inflate(&zlib_, Z_NO_FLUSH);
+                        if(res != Z_OK && res != Z_STREAM_END && res != Z_BUF_ERROR) {
+                            throw std::range_error("compressed section: invalid zlib data");
+                        }
+                    }
+
+                    return size - zlib_.avail_out;
+                }
+#endif
+#if defined(DWARF_READER_HAS_ZSTD)
+                case SectionCompression::zstd: {
+                    if(zstd_ == nullptr) {
+                        zstd_ = ZSTD_createDStream();
+                        if(zstd_ == nullptr || ZSTD_isError(ZSTD_initDStream(zstd_))) {
+                            throw std::range_error("compressed section: zstd initialization failed");
+                        }
+                    }
+
+                    ZSTD_inBuffer input = {compressed_.data(), compressed_.size(), input_offset_};
+                    ZSTD_outBuffer out = {output, size, 0};
+
+                    // a call may consume input without producing output
+                    size_t consumed = 0;
+                    do {
+                        size_t const position = input.pos;
+                        size_t const res = ZSTD_decompressStream(zstd_, &out, &input);
+                        if(ZSTD_isError(res)) {
+                            throw std::range_error("compressed section: invalid zstd data");
+                        }
+                        consumed = input.pos - position;
+                    } while(out.pos == 0 && consumed > 0 && input.pos < input.size);
+
+                    input_offset_ = input.pos;
+                    return out.pos;
+                }
+#endif
+                default:
+                    throw std::range_error("compressed section: compression not supported by this build");
+            }
+        }
+
+        auto
+        end_decoder() noexcept -> void
+        {
+#if defined(DWARF_READER_HAS_ZLIB)
+            if(is_zlib_initialized_) {
+                inflateEnd(&zlib_);
+                is_zlib_initialized_ = false;
+            }
+#endif
+#if defined(DWARF_READER_HAS_ZSTD)
+            if(zstd_ != nullptr) {
+                ZSTD_freeDStream(zstd_);
+                zstd_ = nullptr;
+            }
+#endif
+        }
+
+        std::span<char const> compressed_;
+        CompressionHeader header_;
+        size_t chunk_size_ = default_chunk_size;
+
+        std::unique_ptr<char[]> buffer_;
+        std::atomic<size_t> available_ = 0;
+        std::mutex mutex_;
+
+        /// @brief the offset of the next compressed byte passed to the decoder
+        size_t input_offset_ = 0;
+#if defined(DWARF_READER_HAS_ZLIB)
+        z_stream zlib_ = {};
+        bool is_zlib_initialized_ = false;
+#endif
+#if defined(DWARF_READER_HAS_ZSTD)
+        ZSTD_DStream * zstd_ = nullptr;
+#endif
+    };
+
+    enum class SectionLoading : uint8_t
+    {
+        sequential,
+        parallel
+    };
+
+    /// @class dwarf::SectionCache
+    ///
+    /// @brief The debug sections of a binary file, compressed sections are decompressed on first access
+    /// @details Reads the .debug_ sections and the GNU .zdebug_ sections written by
+    ///     objcopy --compress-debug-sections=zlib-gnu. Sections of other containers, e.g. ELF
+    ///     sections with the SHF_COMPRESSED flag, are added with add(). A decompressed section is
+    ///     cached until the cache is destroyed. Thread safe.
+    ///
+    class SectionCache final
+    {
+    public:
+        ///
+        /// @brief constructor
+        /// @param data the complete data of a binary file
+        /// @param chunk_size the size decompressed at once
+        ///
+        explicit SectionCache(std::span<char const> const data, size_t const chunk_size = CompressedSection::default_chunk_size)
+            : sections_(get_debug_sections(data)), chunk_size_(chunk_size)
+        {
+            pei::SectionTable const section_table(data);
+
+            size_t const count = section_table.number_of_sections();
+            for(size_t i = 0; i < count; ++i) {
+                pei::SectionHeader const section(data, i);
+                std::string_view const name = section.name();
+                if(!name.starts_with(".zdebug_")) {
+                    continue;
+                }
+
+                std::string_view suffix = name.substr(8);
+                if(suffix.ends_with(".dwo")) {
+                    suffix.remove_suffix(4);
+                }
+
+                size_t const index = find_debug_section(suffix);
+                if(index < debug_section_names.size()) {
+                    add(debug_section_names[index].member, section.data(), read_zdebug_header(section.data()));
+                }
+            }
+        }
+
+        ///
+        /// @brief Adds a section, replaces a section with the same member
+        /// @param member the member of the section in dwarf::DebugSections
+        /// @param data the data of the section including the compression header
+        /// @param header the compression header, SectionCompression::none if the section is not compressed
+        ///
+        auto
+        add(DebugSectionMember const member, std::span<char const> const data, CompressionHeader const & header) -> void
+        {
+            size_t const index = find_debug_section(member);
+            if(index >= debug_section_names.size()) {
+                return;
+            }
+
+            if(header.compression == SectionCompression::none) {
+                sections_.*member = data;
+                compressed_[index].reset();
+            }
+            else {
+                sections_.*member = {};
+                compressed_[index] = std::make_unique<CompressedSection>(data, header, chunk_size_);
+            }
+        }
+
+        [[nodiscard]] auto
+        is_compressed(DebugSectionMember const member) const noexcept -> bool
+        {
+            return compressed(member) != nullptr;
+        }
+
+        ///
+        /// @brief Returns the size of the decompressed section
+        ///
+        [[nodiscard]] auto
+        size(DebugSectionMember const member) const noexcept -> size_t
+        {
+            auto const * const section = compressed(member);
+            return section != nullptr ? section->size() : (sections_.*member).size();
+        }
+
+        ///
+        /// @brief Returns the size of the part of a section which is decompressed
+        ///
+        [[nodiscard]] auto
+        available(DebugSectionMember const member) const noexcept -> size_t
+        {
+            auto const * const section = compressed(member);
+            return section != nullptr ? section->available() : (sections_.*member).size();
+        }
+
+        ///
+        /// @brief Returns a section, decompressed on first access
+        ///
+        [[nodiscard]] auto
+        section(DebugSectionMember const member) -> std::span<char const>
+        {
+            auto * const section = compressed(member);
+            return section != nullptr ? section->data() : sections_.*member;
+        }
+
+        ///
+        /// @brief Returns the first bytes of a section, only these are decompressed
+        /// @param size the number of bytes, limited to the size of the section
+        ///
+        [[nodiscard]] auto
+        prefix(DebugSectionMember const member, size_t const size) -> std::span<char const>
+        {
+            auto * const section = compressed(member);
+            if(section != nullptr) {
+                return section->prefix(size);
+            }
+
+            auto const data = sections_.*member;
+            return data.first(std::min(size, data.size()));
+        }
+
+        ///
+        /// @brief Returns a unit of a section starting with an initial length field, e.g. a line
+        ///     number program of .debug_line, decompressing the section only up to its end
+        /// @param offset the offset of the unit in the section
+        ///
+        [[nodiscard]] auto
+        unit(DebugSectionMember const member, size_t const offset) -> std::span<char const>
+        {
+            auto const header = prefix(member, offset + 12);
+            auto const length_32 = ::details::bit_cast<uint32_t>(header, offset);
+            uint64_t const length = length_32 == 0xffffffff ? ::details::bit_cast<uint64_t>(header, offset + 4) + 12
+                                                            : uint64_t{length_32} + 4;
+
+            auto const data = prefix(member, offset + length);
+            if(data.size() < offset + length) {
+                throw std::range_error("section cache: unit_length out of bounds");
+            }
+
+            return data.subspan(offset);
+        }
+
+        ///
+        /// @brief Returns all sections, the compressed sections are decompressed
+        /// @param loading decompresses the sections one after the other or each in its own thread
+        ///
+        [[nodiscard]] auto
+        sections(SectionLoading const loading = SectionLoading::parallel) -> DebugSections
+        {
+            DebugSections res = sections_;
+
+            if(loading == SectionLoading::parallel) {
+                std::vector<std::pair<DebugSectionMember, std::future<std::span<char const>>>> futures;
+                for(size_t i = 0; i < compressed_.size(); ++i) {
+                    if(compressed_[i] != nullptr) {
+                        futures.emplace_back(debug_section_names[i].member,
+                            std::async(std::launch::async, [section = compressed_[i].get()]() { return section->data(); }));
+                    }
+                }
+                for(auto & [member, future] : futures) {
+                    res.*member = future.get();
+                }
+            }
+            else {
+                for(size_t i = 0; i < compressed_.size(); ++i) {
+                    if(compressed_[i] != nullptr) {
+                        res.*debug_section_names[i].member = compressed_[i]->data();
+                    }
+                }
+            }
+
+            return res;
+        }
+
+    private:
+        [[nodiscard]] auto
+        compressed(DebugSectionMember const member) const noexcept -> CompressedSection *
+        {
+            size_t const index = find_debug_section(member);
+            return index < compressed_.size() ? compressed_[index].get() : nullptr;
+        }
+
+        /// @brief the sections which are not compressed
+        DebugSections sections_ = {};
+        std::array<std::unique_ptr<CompressedSection>, debug_section_names.size()> compressed_;
+        size_t chunk_size_ = CompressedSection::default_chunk_size;
+    };
+}
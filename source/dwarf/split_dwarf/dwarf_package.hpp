@@ -0,0 +1,186 @@
+///
+/// @file:   dwarf_package.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  A split DWARF package (.dwp) file
+///
+
+#pragma once
+
+#include "dwarf/debug_info/unit.hpp"
+#include "dwarf/split_dwarf/unit_index.hpp"
+#include <optional>
+
+namespace dwarf
+{
+    /// @class dwarf::DwarfPackage
+    ///
+    /// @brief The split units of many .dwo files combined into one .dwp package file
+    /// @details The .dwo sections of all units are concatenated, .debug_cu_index and .debug_tu_index
+    ///     map the dwo_id or type signature of a unit to its contributions. A lookup hashes the
+    ///     signature into the index and slices the sections of the unit out of the package,
+    ///     no unit is scanned. The package data must outlive the returned sections and units.
+    ///
+    class DwarfPackage final
+    {
+    public:
+        constexpr DwarfPackage() noexcept = default;
+
+        ///
+        /// @brief constructor
+        /// @param data the complete data of a .dwp file
+        ///
+        explicit constexpr DwarfPackage(std::span<char const> const data) noexcept
+            : sections_(get_debug_sections(data)), cu_index_(sections_.debug_cu_index), tu_index_(sections_.debug_tu_index) {}
+
+        ///
+        /// @brief Returns true if the file has a valid .debug_cu_index section
+        ///
+        [[nodiscard]] constexpr auto
+        is_valid() const noexcept -> bool
+        {
+            return cu_index_.is_valid();
+        }
+
+        ///
+        /// @brief Returns the sections of the complete package
+        ///
+        [[nodiscard]] constexpr auto
+        sections() const noexcept -> DebugSections const &
+        {
+            return sections_;
+        }
+
+        [[nodiscard]] constexpr auto
+        cu_index() const noexcept -> UnitIndex const &
+        {
+            return cu_index_;
+        }
+
+        [[nodiscard]] constexpr auto
+        tu_index() const noexcept -> UnitIndex const &
+        {
+            return tu_index_;
+        }
+
+        ///
+        /// @brief Returns the sections of a split compilation unit
+        /// @param dwo_id the dwo_id of the unit
+        /// @return the contributions of the unit, .debug_str is shared by all units
+        ///
+        [[nodiscard]] constexpr auto
+        find_unit_sections(uint64_t const dwo_id) const noexcept -> std::optional<DebugSections>
+        {
+            return unit_sections(cu_index_, dwo_id);
+        }
+
+        ///
+        /// @brief Returns the sections of a split type unit
+        /// @param signature the type signature of the unit, e.g. of a DW_FORM_ref_sig8 reference
+        ///
+        [[nodiscard]] constexpr auto
+        find_type_unit_sections(uint64_t const signature) const noexcept -> std::optional<DebugSections>
+        {
+            return unit_sections(tu_index_, signature);
+        }
+
+        ///
+        /// @brief Returns the split unit of a skeleton unit
+        /// @param skeleton a skeleton unit of the binary file
+        /// @return the unit, std::nullopt if the package contains no DWARF 5 unit with its dwo_id
+        ///
+        [[nodiscard]] constexpr auto
+        find_split_unit(Unit const & skeleton) const -> std::optional<Unit>
+        {
+            if(skeleton.unit_type() != UnitHeaderUnitType::dw_ut_skeleton) {
+                return std::nullopt;
+            }
+
+            auto const sections = find_unit_sections(skeleton.dwo_id());
+            if(!sections.has_value() || sections->debug_info.empty()) {
+                return std::nullopt;
+            }
+
+            // the contribution to .debug_info.dwo starts with the header of the unit
+            UnitHeader const unit_header(sections->debug_info);
+            if(unit_header.version() < 5 || unit_header.unit_type() != UnitHeaderUnitType::dw_ut_split_compile) {
+                return std::nullopt;
+            }
+
+            Unit unit(*sections, unit_header, skeleton);
+            if(unit.dwo_id() != skeleton.dwo_id()) {
+                return std::nullopt;
+            }
+
+            return unit;
+        }
+
+    private:
+        ///
+        /// @brief Returns the section of a package a column of an index refers to
+        /// @details The GNU version 2 index uses the identifiers of DWARF 4 packages, the sections
+        ///     without a DWARF 5 counterpart are not sliced
+        ///
+        template<typename SECTIONS_T>
+        [[nodiscard]] static constexpr auto
+        target(SECTIONS_T & sections, uint16_t const version, SectionIdentifier const section) noexcept -> decltype(&sections.debug_info)
+        {
+            if(version == 2) {
+                switch(static_cast<uint32_t>(section)) {
+                    case 1: return &sections.debug_info;
+                    case 3: return &sections.debug_abbrev;
+                    case 4: return &sections.debug_line;
+                    case 6: return &sections.debug_str_offsets;
+                    case 8: return &sections.debug_macro;
+                    default: return nullptr;
+                }
+            }
+
+            switch(section) {
+                case SectionIdentifier::dw_sect_info: return &sections.debug_info;
+                case SectionIdentifier::dw_sect_abbrev: return &sections.debug_abbrev;
+                case SectionIdentifier::dw_sect_line: return &sections.debug_line;
+                case SectionIdentifier::dw_sect_loclists: return &sections.debug_loclists;
+                case SectionIdentifier::dw_sect_str_offsets: return &sections.debug_str_offsets;
+                case SectionIdentifier::dw_sect_macro: return &sections.debug_macro;
+                case SectionIdentifier::dw_sect_rnglists: return &sections.debug_rnglists;
+                default: return nullptr;
+            }
+        }
+
+        [[nodiscard]] constexpr auto
+        unit_sections(UnitIndex const & index, uint64_t const signature) const noexcept -> std::optional<DebugSections>
+        {
+            uint32_t const row = index.find(signature);
+            if(row == 0) {
+                return std::nullopt;
+            }
+
+            DebugSections res = {};
+            res.debug_str = sections_.debug_str;
+
+            size_t const count = index.section_count();
+            for(size_t column = 0; column < count; ++column) {
+                auto const section = index.section_identifier(column);
+                auto * const target = DwarfPackage::target(res, index.version(), section);
+                if(target == nullptr) {
+                    continue;
+                }
+
+                auto const * const package_section = DwarfPackage::target(sections_, index.version(), section);
+                auto const contribution = index.contribution(row, column);
+                if(static_cast<uint64_t>(contribution.offset) + contribution.size > package_section->size()) {
+                    return std::nullopt;
+                }
+
+                *target = package_section->subspan(contribution.offset, contribution.size);
+            }
+
+            return res;
+        }
+
+        DebugSections sections_ = {};
+        UnitIndex cu_index_ = {};
+        UnitIndex tu_index_ = {};
+    };
+}
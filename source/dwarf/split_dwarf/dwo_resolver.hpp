@@ -0,0 +1,228 @@
+///
+/// @file:   dwo_resolver.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Resolves skeleton units into the split units of their .dwo files
+///
+
+#pragma once
+
+#include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/debug_info/die.hpp"
+#include "dwarf/mapped_file.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace dwarf
+{
+    /// @class dwarf::DwoFile
+    ///
+    /// @brief A mapped .dwo file and its split unit
+    ///
+    class DwoFile final
+    {
+    public:
+        ///
+        /// @brief constructor
+        /// @param file the mapped .dwo file
+        /// @param skeleton the skeleton unit in the binary file
+        /// @details unit() is valid if the file contains a split unit with the dwo_id of the skeleton
+        ///
+        DwoFile(MappedFile file, Unit const & skeleton)
+            : file_(std::move(file)), sections_(get_debug_sections(file_.data()))
+        {
+            for(UnitHeader const unit_header : DebugInfo(sections_.debug_info)) {
+                if(unit_header.version() < 5 || unit_header.unit_type() != UnitHeaderUnitType::dw_ut_split_compile) {
+                    continue;
+                }
+
+                Unit unit(sections_, unit_header, skeleton);
+                if(unit.dwo_id() == skeleton.dwo_id()) {
+                    unit_ = std::move(unit);
+                    is_valid_ = true;
+                    break;
+                }
+            }
+        }
+
+        DwoFile(DwoFile const &) = delete;
+        auto operator=(DwoFile const &) -> DwoFile & = delete;
+
+        [[nodiscard]] auto
+        is_valid() const noexcept -> bool
+        {
+            return is_valid_;
+        }
+
+        ///
+        /// @brief Returns the split unit matching the skeleton unit
+        ///
+        [[nodiscard]] auto
+        unit() const noexcept -> Unit const &
+        {
+            return unit_;
+        }
+
+        ///
+        /// @brief Returns the .dwo sections of the file
+        ///
+        [[nodiscard]] auto
+        sections() const noexcept -> DebugSections const &
+        {
+            return sections_;
+        }
+
+    private:
+        MappedFile file_;
+        DebugSections sections_ = {};
+        Unit unit_ = {};
+        bool is_valid_ = false;
+    };
+
+    /// @class dwarf::DwoResolverStatistics
+    ///
+    /// @brief Counts the lookups of a dwarf::DwoResolver
+    ///
+    struct DwoResolverStatistics final
+    {
+        /// @brief Lookups answered by an open mapping
+        size_t hits = 0;
+        /// @brief Lookups which mapped a .dwo file
+        size_t misses = 0;
+        /// @brief Mappings closed to stay within the capacity
+        size_t evictions = 0;
+        /// @brief Lookups without a matching .dwo file
+        size_t failures = 0;
+    };
+
+    /// @class dwarf::DwoResolver
+    ///
+    /// @brief Resolves the skeleton units of a binary built with -gsplit-dwarf into the split units
+    ///     of their .dwo files
+    /// @details A .dwo file is mapped on the first lookup of its dwo_id and stays mapped until it is
+    ///     the least recently used of more than capacity() mappings. A warm lookup is one hash table
+    ///     lookup. The returned files stay valid while they are referenced, even if they are evicted.
+    ///     The path of a .dwo file is DW_AT_dwo_name, relative to DW_AT_comp_dir of the skeleton
+    ///     unit, or the file name of DW_AT_dwo_name in one of the search directories.
+    ///     Not thread safe.
+    ///
+    class DwoResolver final
+    {
+    public:
+
+        ///
+        /// @brief constructor
+        /// @param capacity the maximum number of mapped .dwo files
+        /// @param search_directories directories searched if the .dwo file is not at its recorded path
+        ///
+        explicit DwoResolver(size_t const capacity = 64, std::vector<std::filesystem::path> search_directories = {})
+            : capacity_(std::max<size_t>(capacity, 1)), search_directories_(std::move(search_directories)) {}
+
+        ///
+        /// @brief Returns the .dwo file of a skeleton unit
+        /// @param skeleton a skeleton unit of the binary file
+        /// @return the file, nullptr if the unit is no skeleton unit or no .dwo file with its dwo_id is found
+        ///
+        [[nodiscard]] auto
+        resolve(Unit const & skeleton) -> std::shared_ptr<DwoFile const>
+        {
+            if(skeleton.unit_type() != UnitHeaderUnitType::dw_ut_skeleton) {
+                return nullptr;
+            }
+
+            auto const it = index_.find(skeleton.dwo_id());
+            if(it != index_.end()) {
+                ++statistics_.hits;
+                lru_.splice(lru_.begin(), lru_, it->second);
+                return it->second->second;
+            }
+
+            auto file = open(skeleton);
+            if(file == nullptr) {
+                ++statistics_.failures;
+                return nullptr;
+            }
+
+            ++statistics_.misses;
+            lru_.emplace_front(skeleton.dwo_id(), file);
+            index_.emplace(skeleton.dwo_id(), lru_.begin());
+
+            while(lru_.size() > capacity_) {
+                ++statistics_.evictions;
+                index_.erase(lru_.back().first);
+                lru_.pop_back();
+            }
+
+            return file;
+        }
+
+        ///
+        /// @brief Returns the number of mapped .dwo files
+        ///
+        [[nodiscard]] auto
+        size() const noexcept -> size_t
+        {
+            return lru_.size();
+        }
+
+        [[nodiscard]] auto
+        capacity() const noexcept -> size_t
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]] auto
+        statistics() const noexcept -> DwoResolverStatistics const &
+        {
+            return statistics_;
+        }
+
+    private:
+        ///
+        /// @brief Maps the .dwo file of a skeleton unit
+        ///
+        [[nodiscard]] auto
+        open(Unit const & skeleton) const -> std::shared_ptr<DwoFile const>
+        {
+            DIE const die(skeleton, skeleton.first_die_offset());
+            std::filesystem::path const dwo_name(die.attribute(Attribute::dw_at_dwo_name).as_string());
+            std::filesystem::path const comp_dir(die.attribute(Attribute::dw_at_comp_dir).as_string());
+            if(dwo_name.empty()) {
+                return nullptr;
+            }
+
+            std::vector<std::filesystem::path> candidates = {comp_dir / dwo_name};
+            for(auto const & directory : search_directories_) {
+                candidates.push_back(directory / dwo_name);
+                candidates.push_back(directory / dwo_name.filename());
+            }
+
+            for(auto const & candidate : candidates) {
+                MappedFile file(candidate);
+                if(!file.is_open()) {
+                    continue;
+                }
+
+                auto res = std::make_shared<DwoFile const>(std::move(file), skeleton);
+                if(res->is_valid()) {
+                    return res;
+                }
+            }
+
+            return nullptr;
+        }
+
+        using Entry = std::pair<uint64_t, std::shared_ptr<DwoFile const>>;
+
+        size_t capacity_ = 0;
+        std::vector<std::filesystem::path> search_directories_;
+        /// @brief the mapped files, the most recently used first
+        std::list<Entry> lru_;
+        std::unordered_map<uint64_t, std::list<Entry>::iterator> index_;
+        DwoResolverStatistics statistics_;
+    };
+}
@@ -0,0 +1,251 @@
+///
+/// @file:   unit_index.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The .debug_cu_index and .debug_tu_index sections of a split DWARF package
+///
+
+#pragma once
+
+#include "dwarf/dwarf_tags.hpp"
+#include "details/type_list.hpp"
+#include <span>
+#include <cstdint>
+
+namespace dwarf
+{
+    /// @class dwarf::SectionContribution
+    ///
+    /// @brief The part of a section of a package contributed by one unit
+    ///
+    struct SectionContribution final
+    {
+        /// @brief The offset in the section
+        uint32_t offset = 0;
+        /// @brief The size of the contribution
+        uint32_t size = 0;
+    };
+
+    /// @class dwarf::UnitIndex
+    ///
+    /// @brief Maps the dwo_id of a split compilation unit or the signature of a split type unit to the
+    ///     contributions of the unit to the sections of a .dwp package file
+    /// @details The header is followed by a hash table of the signatures, a parallel table of row numbers,
+    ///     the section offset table and the section size table. A row has one column per section of
+    ///     the package, the section of a column is given by the first row of the offset table.
+    ///     Row numbers start at 1, row 0 marks an unused slot of the hash table.
+    ///     Reads version 5 indexes and the GNU version 2 indexes of DWARF 4 packages, which share
+    ///     the layout but use other section identifiers.
+    ///
+    class UnitIndex final
+    {
+    public:
+        struct DataStructure final
+        {
+            ::details::TypeList<0, uint16_t> version;
+            ::details::TypeList<decltype(version)::end, uint16_t> padding;
+            ::details::TypeList<decltype(padding)::end, uint32_t> section_count;
+            ::details::TypeList<decltype(section_count)::end, uint32_t> unit_count;
+            ::details::TypeList<decltype(unit_count)::end, uint32_t> slot_count;
+        };
+
+        static constexpr size_t header_size = decltype(DataStructure::slot_count)::end;
+
+        constexpr UnitIndex() noexcept = default;
+
+        ///
+        /// @brief constructor
+        /// @param data the .debug_cu_index or .debug_tu_index section
+        ///
+        explicit constexpr UnitIndex(std::span<char const> const data) noexcept
+            : data_(data), is_valid_(read_is_valid(data)) {}
+
+        ///
+        /// @brief Returns true if the section holds a complete index
+        ///
+        [[nodiscard]] constexpr auto
+        is_valid() const noexcept -> bool
+        {
+            return is_valid_;
+        }
+
+        [[nodiscard]] constexpr auto
+        version() const noexcept -> uint16_t
+        {
+            return is_valid_ ? decltype(DataStructure::version)::bit_cast(data_, 0) : 0;
+        }
+
+        ///
+        /// @brief Returns the number of columns of the offset and size tables
+        ///
+        [[nodiscard]] constexpr auto
+        section_count() const noexcept -> uint32_t
+        {
+            return is_valid_ ? decltype(DataStructure::section_count)::bit_cast(data_, 0) : 0;
+        }
+
+        ///
+        /// @brief Returns the number of rows of the offset and size tables
+        ///
+        [[nodiscard]] constexpr auto
+        unit_count() const noexcept -> uint32_t
+        {
+            return is_valid_ ? decltype(DataStructure::unit_count)::bit_cast(data_, 0) : 0;
+        }
+
+        ///
+        /// @brief Returns the number of slots of the hash table, a power of two
+        ///
+        [[nodiscard]] constexpr auto
+        slot_count() const noexcept -> uint32_t
+        {
+            return is_valid_ ? decltype(DataStructure::slot_count)::bit_cast(data_, 0) : 0;
+        }
+
+        ///
+        /// @brief Returns the row of a unit
+        /// @param signature the dwo_id of a split compilation unit or the signature of a split type unit
+        /// @return the row starting at 1, 0 if the package contains no such unit
+        ///
+        [[nodiscard]] constexpr auto
+        find(uint64_t const signature) const noexcept -> uint32_t
+        {
+            uint32_t const slots = slot_count();
+            if(slots == 0) {
+                return 0;
+            }
+
+            // double hashing, the step is odd and therefore visits every slot of the power of two table
+            uint64_t const mask = slots - 1;
+            uint64_t slot = signature & mask;
+            uint64_t const step = ((signature >> 32) & mask) | 1;
+
+            for(uint32_t i = 0; i < slots; ++i) {
+                uint32_t const row = row_at(slot);
+                if(row == 0) {
+                    return 0;
+                }
+                if(signature_at(slot) == signature) {
+                    return row <= unit_count() ? row : 0;
+                }
+                slot = (slot + step) & mask;
+            }
+
+            return 0;
+        }
+
+        ///
+        /// @brief Returns the section of a column
+        ///
+        [[nodiscard]] constexpr auto
+        section_identifier(size_t const column) const noexcept -> SectionIdentifier
+        {
+            return static_cast<SectionIdentifier>(read_uint32(offset_table_address() + column * sizeof(uint32_t)));
+        }
+
+        ///
+        /// @brief Returns the column of a section
+        /// @return section_count() if the package has no such section
+        ///
+        [[nodiscard]] constexpr auto
+        column(SectionIdentifier const section) const noexcept -> size_t
+        {
+            size_t const count = section_count();
+            for(size_t i = 0; i < count; ++i) {
+                if(section_identifier(i) == section) {
+                    return i;
+                }
+            }
+
+            return count;
+        }
+
+        ///
+        /// @brief Returns the contribution of a unit to a section
+        /// @param row a row returned by find()
+        /// @param column the column of the section
+        ///
+        [[nodiscard]] constexpr auto
+        contribution(uint32_t const row, size_t const column) const noexcept -> SectionContribution
+        {
+            if(row == 0 || row > unit_count() || column >= section_count()) {
+                return {};
+            }
+
+            size_t const cell = (static_cast<size_t>(row - 1) * section_count() + column) * sizeof(uint32_t);
+            return {read_uint32(offset_rows_address() + cell), read_uint32(size_table_address() + cell)};
+        }
+
+    private:
+        [[nodiscard]] constexpr auto
+        read_uint32(size_t const index) const noexcept -> uint32_t
+        {
+            return ::details::bit_cast<uint32_t>(data_, index);
+        }
+
+        [[nodiscard]] constexpr auto
+        signature_at(size_t const slot) const noexcept -> uint64_t
+        {
+            return ::details::bit_cast<uint64_t>(data_, header_size + slot * sizeof(uint64_t));
+        }
+
+        [[nodiscard]] constexpr auto
+        row_at(size_t const slot) const noexcept -> uint32_t
+        {
+            return read_uint32(header_size + slot_count() * sizeof(uint64_t) + slot * sizeof(uint32_t));
+        }
+
+        [[nodiscard]] constexpr auto
+        offset_table_address() const noexcept -> size_t
+        {
+            return header_size + slot_count() * (sizeof(uint64_t) + sizeof(uint32_t));
+        }
+
+        [[nodiscard]] constexpr auto
+        offset_rows_address() const noexcept -> size_t
+        {
+            return offset_table_address() + section_count() * sizeof(uint32_t);
+        }
+
+        [[nodiscard]] constexpr auto
+        size_table_address() const noexcept -> size_t
+        {
+            return offset_rows_address() + static_cast<size_t>(unit_count()) * section_count() * sizeof(uint32_t);
+        }
+
+        ///
+        /// @brief Checks the header and that the section holds all tables, so the accessors can not
+        ///     read out of bounds
+        ///
+        [[nodiscard]] static constexpr auto
+        read_is_valid(std::span<char const> const data) noexcept -> bool
+        {
+            if(data.size() < header_size) {
+                return false;
+            }
+
+            auto const version = decltype(DataStructure::version)::bit_cast(data, 0);
+            uint64_t const section_count = decltype(DataStructure::section_count)::bit_cast(data, 0);
+            uint64_t const unit_count = decltype(DataStructure::unit_count)::bit_cast(data, 0);
+            uint64_t const slot_count = decltype(DataStructure::slot_count)::bit_cast(data, 0);
+
+            if(version != 2 && version != 5) {
+                return false;
+            }
+            if(slot_count != 0 && (slot_count & (slot_count - 1)) != 0) {
+                return false;
+            }
+            if(section_count > 8 || unit_count > slot_count) {
+                return false;
+            }
+
+            uint64_t const size = header_size + slot_count * (sizeof(uint64_t) + sizeof(uint32_t))
+                + section_count * sizeof(uint32_t) + 2 * unit_count * section_count * sizeof(uint32_t);
+
+            return size <= data.size();
+        }
+
+        std::span<char const> data_ = {};
+        bool is_valid_ = false;
+    };
+}
@@ -0,0 +1,316 @@
+///
+/// @file:   symbolizer.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Maps addresses of binaries to functions, keeping the mapped binaries and their indexes resident
+///
+
+#pragma once
+
+#include "dwarf/debug_info/incremental_index.hpp"
+#include "dwarf/mapped_file.hpp"
+#include "pei/debug_directory.hpp"
+#include "pei/export_directory.hpp"
+#include "pei/symbol_table.hpp"
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace dwarf
+{
+    /// @class dwarf::Symbol
+    ///
+    /// @brief The function containing an address
+    /// @details The names are valid while the dwarf::SymbolizerImage is referenced
+    ///
+    struct Symbol final
+    {
+        /// @brief The first address of the function, 0 if no function contains the address
+        uint64_t low_pc = 0;
+        std::string_view function = {};
+        /// @brief The name of the compilation unit of the function, empty for a symbol of the COFF symbol table
+        ///     or an export
+        std::string_view unit = {};
+    };
+
+    /// @class dwarf::SymbolizerImage
+    ///
+    /// @brief A mapped binary file with a table of the address ranges of its functions
+    /// @details The addresses are the addresses of the image as linked, e.g. relative to the
+    ///     preferred image base of a PE file. Addresses without debug information are looked up
+    ///     in the COFF symbol table and then in the export table, e.g. for a system DLL.
+    ///
+    class SymbolizerImage final
+    {
+    public:
+        ///
+        /// @brief Maps a binary file and builds its index
+        /// @param path the binary file
+        /// @param previous the image of the file before it was rebuilt, the fragments of its
+        ///     unchanged units are reused. Its functions are reused without hashing the units if
+        ///     the build identity of both files is equal, e.g. a file copied over with a new time.
+        ///
+        explicit SymbolizerImage(std::filesystem::path const & path, SymbolizerImage const * const previous = nullptr)
+            : file_(path)
+        {
+            std::error_code error;
+            size_ = std::filesystem::file_size(path, error);
+            last_write_time_ = std::filesystem::last_write_time(path, error);
+            // the headers of a file named by a client are checked before any of them is read
+            is_valid_ = file_.is_open() && pei::SectionTable(file_.data()).is_valid();
+            if(!is_valid_) {
+                return;
+            }
+
+            sections_ = get_debug_sections(file_.data());
+            key_ = pei::DebugDirectory(file_.data()).key();
+            if(previous != nullptr) {
+                index_ = previous->index_;
+            }
+
+            if(previous != nullptr && key_.is_stable() && key_ == previous->key_) {
+                auto const units = index_.units().size();
+                update_ = {units, units, 0};
+                functions_ = previous->functions_;
+                unit_names_ = previous->unit_names_;
+            }
+            else {
+                update_ = index_.update(sections_);
+                build_functions();
+            }
+            symbols_ = pei::SymbolIndex(file_.data());
+            exports_ = pei::ExportIndex(file_.data());
+        }
+
+        SymbolizerImage(SymbolizerImage const &) = delete;
+        auto operator=(SymbolizerImage const &) -> SymbolizerImage & = delete;
+
+        ///
+        /// @brief Returns true if the file is mapped and its headers are valid, see pei::SectionTable::is_valid()
+        ///
+        [[nodiscard]] auto
+        is_open() const noexcept -> bool
+        {
+            return is_valid_;
+        }
+
+        ///
+        /// @brief Returns true if the file on disk is not the mapped one anymore
+        ///
+        [[nodiscard]] auto
+        is_modified(std::filesystem::path const & path) const -> bool
+        {
+            std::error_code error;
+            auto const size = std::filesystem::file_size(path, error);
+            auto const last_write_time = std::filesystem::last_write_time(path, error);
+            return size != size_ || last_write_time != last_write_time_;
+        }
+
+        ///
+        /// @brief Returns the function containing an address
+        ///
+        [[nodiscard]] auto
+        symbolize(uint64_t const pc) const noexcept -> Symbol
+        {
+            StageTimer const timer(ReaderStage::symbolize);
+            auto it = std::ranges::upper_bound(functions_, pc, {}, &Function::low_pc);
+            if(it != functions_.begin() && pc < std::prev(it)->high_pc) {
+                --it;
+                return {it->low_pc, it->name, unit_names_[it->unit]};
+            }
+
+            if(auto const * const symbol = symbols_.find(pc); symbol != nullptr) {
+                return {symbol->address, symbol->name, {}};
+            }
+            if(auto const * const entry = exports_.find(pc); entry != nullptr) {
+                return {entry->address, entry->name, {}};
+            }
+            return {};
+        }
+
+        ///
+        /// @brief Returns the number of functions with an address range
+        ///
+        [[nodiscard]] auto
+        size() const noexcept -> size_t
+        {
+            return functions_.size();
+        }
+
+        ///
+        /// @brief Returns the identity of the build of the file, see pei::DebugDirectory::key()
+        ///
+        [[nodiscard]] auto
+        key() const noexcept -> pei::ImageKey const &
+        {
+            return key_;
+        }
+
+        ///
+        /// @brief Returns the work done to build the index, see dwarf::IncrementalIndex::update()
+        ///
+        [[nodiscard]] auto
+        index_update() const noexcept -> IndexUpdate const &
+        {
+            return update_;
+        }
+
+    private:
+        struct Function final
+        {
+            uint64_t low_pc = 0;
+            uint64_t high_pc = 0;
+            std::string_view name = {};
+            uint32_t unit = 0;
+        };
+
+        ///
+        /// @brief Collects the subprograms of all fragments, the names are owned by the fragments
+        ///
+        auto
+        build_functions() -> void
+        {
+            std::unordered_map<uint64_t, IndexedName const *> names;
+            for(auto const & unit : index_.units()) {
+                auto const & fragment = *unit.fragment;
+                names.clear();
+                std::string_view unit_name = {};
+                for(auto const & entry : fragment.names) {
+                    names.emplace(entry.die_offset, &entry);
+                    if(entry.tag == Tag::dw_tag_compile_unit || entry.tag == Tag::dw_tag_partial_unit) {
+                        unit_name = fragment.name(entry);
+                    }
+                }
+
+                auto const unit_index = static_cast<uint32_t>(unit_names_.size());
+                unit_names_.push_back(unit_name);
+                for(auto const & range : fragment.ranges) {
+                    auto const it = names.find(range.die_offset);
+                    if(it != names.end() && it->second->tag == Tag::dw_tag_subprogram) {
+                        functions_.push_back({range.low_pc, range.high_pc, fragment.name(*it->second), unit_index});
+                    }
+                }
+            }
+
+            std::ranges::sort(functions_, {}, &Function::low_pc);
+        }
+
+        MappedFile file_;
+        bool is_valid_ = false;
+        DebugSections sections_ = {};
+        IncrementalIndex index_;
+        IndexUpdate update_ = {};
+        std::vector<Function> functions_;
+        std::vector<std::string_view> unit_names_;
+        pei::SymbolIndex symbols_;
+        pei::ExportIndex exports_;
+        pei::ImageKey key_ = {};
+        uintmax_t size_ = 0;
+        std::filesystem::file_time_type last_write_time_ = {};
+    };
+
+    /// @class dwarf::SymbolizerStatistics
+    ///
+    /// @brief Counts the image lookups of a dwarf::Symbolizer
+    ///
+    struct SymbolizerStatistics final
+    {
+        /// @brief Lookups answered by a resident image
+        size_t hits = 0;
+        /// @brief Lookups which mapped an image
+        size_t misses = 0;
+        /// @brief Lookups of an image whose file was rebuilt
+        size_t reloads = 0;
+        /// @brief Images released to stay within the capacity
+        size_t evictions = 0;
+        /// @brief Lookups of files which can not be mapped or are not a PE image or COFF object file
+        size_t failures = 0;
+    };
+
+    /// @class dwarf::Symbolizer
+    ///
+    /// @brief Keeps the most recently used binary files mapped and indexed
+    /// @details An image is loaded on the first lookup of its path and stays resident until it is
+    ///     the least recently used of more than capacity() images. A rebuilt file is reloaded,
+    ///     reusing the index fragments of its unchanged units. Not thread safe.
+    ///
+    class Symbolizer final
+    {
+    public:
+        explicit Symbolizer(size_t const capacity = 16)
+            : capacity_(std::max<size_t>(capacity, 1)) {}
+
+        ///
+        /// @brief Returns the image of a binary file
+        /// @return the image, nullptr if the file can not be mapped or its headers are not valid
+        ///
+        [[nodiscard]] auto
+        image(std::filesystem::path const & path) -> std::shared_ptr<SymbolizerImage const>
+        {
+            auto const key = path.lexically_normal().string();
+            std::shared_ptr<SymbolizerImage const> previous;
+
+            auto const it = index_.find(key);
+            if(it != index_.end()) {
+                if(!it->second->second->is_modified(path)) {
+                    ++statistics_.hits;
+                    lru_.splice(lru_.begin(), lru_, it->second);
+                    return it->second->second;
+                }
+
+                ++statistics_.reloads;
+                previous = it->second->second;
+                lru_.erase(it->second);
+                index_.erase(it);
+            }
+
+            auto image = std::make_shared<SymbolizerImage const>(path, previous.get());
+            if(!image->is_open()) {
+                ++statistics_.failures;
+                return nullptr;
+            }
+
+            ++statistics_.misses;
+            lru_.emplace_front(key, image);
+            index_.emplace(key, lru_.begin());
+
+            while(lru_.size() > capacity_) {
+                ++statistics_.evictions;
+                index_.erase(lru_.back().first);
+                lru_.pop_back();
+            }
+
+            return image;
+        }
+
+        ///
+        /// @brief Returns the number of resident images
+        ///
+        [[nodiscard]] auto
+        size() const noexcept -> size_t
+        {
+            return lru_.size();
+        }
+
+        [[nodiscard]] auto
+        capacity() const noexcept -> size_t
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]] auto
+        statistics() const noexcept -> SymbolizerStatistics const &
+        {
+            return statistics_;
+        }
+
+    private:
+        using Entry = std::pair<std::string, std::shared_ptr<SymbolizerImage const>>;
+
+        size_t capacity_ = 0;
+        std::list<Entry> lru_;
+        std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+        SymbolizerStatistics statistics_ = {};
+    };
+}
@@ -0,0 +1,268 @@
+///
+/// @file:   symbolizer_protocol.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The binary messages between a symbolizer client and dwarf::SymbolizerServer
+///
+
+#pragma once
+
+#include "dwarf/symbolizer/symbolizer.hpp"
+#include "details/type_list.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace dwarf
+{
+    /// @brief "DSYM"
+    constexpr uint32_t symbolizer_magic = 0x4d595344;
+    constexpr uint16_t symbolizer_version = 1;
+    /// @brief The maximum number of addresses of one request
+    constexpr uint32_t symbolizer_max_count = 1 << 20;
+
+    enum class SymbolizerStatus : uint16_t
+    {
+        ok = 0,
+        /// @brief The binary file can not be mapped
+        image_not_found = 1,
+        /// @brief The request is malformed or of another version
+        bad_request = 2,
+        /// @brief The server failed to load or index the binary file, e.g. out of memory
+        internal_error = 3,
+    };
+
+    /// @class dwarf::SymbolizerMessageHeader
+    ///
+    /// @brief The header of a request and of a response
+    /// @details A request is followed by the path of the binary file and count addresses of
+    ///     8 bytes. A response is followed by count results. The integers are in the byte order
+    ///     of the host, client and server run on the same host.
+    ///
+    struct SymbolizerMessageHeader final
+    {
+        ::details::TypeList<0, uint32_t> magic;
+        ::details::TypeList<decltype(magic)::end, uint16_t> version;
+        /// @brief The size of the path of a request, the dwarf::SymbolizerStatus of a response
+        ::details::TypeList<decltype(version)::end, uint16_t> argument;
+        /// @brief The number of addresses or results
+        ::details::TypeList<decltype(argument)::end, uint32_t> count;
+        /// @brief The size of the message after the header
+        ::details::TypeList<decltype(count)::end, uint32_t> size;
+
+        static constexpr size_t end = decltype(size)::end;
+    };
+
+    /// @class dwarf::SymbolizerResultHeader
+    ///
+    /// @brief A result of a response, followed by the name of the function and of the unit
+    ///
+    struct SymbolizerResultHeader final
+    {
+        ::details::TypeList<0, uint64_t> low_pc;
+        ::details::TypeList<decltype(low_pc)::end, uint16_t> function_size;
+        ::details::TypeList<decltype(function_size)::end, uint16_t> unit_size;
+
+        static constexpr size_t end = decltype(unit_size)::end;
+    };
+
+    /// @class dwarf::SymbolizerResult
+    ///
+    /// @brief A result of a response as read by the client
+    ///
+    struct SymbolizerResult final
+    {
+        /// @brief The first address of the function, 0 if no function contains the address
+        uint64_t low_pc = 0;
+        std::string function;
+        std::string unit;
+
+        [[nodiscard]] auto
+        operator==(SymbolizerResult const & other) const noexcept -> bool = default;
+    };
+
+    /// @class dwarf::SymbolizerRequest
+    ///
+    struct SymbolizerRequest final
+    {
+        std::string path;
+        std::vector<uint64_t> pcs;
+    };
+
+    /// @class dwarf::SymbolizerResponse
+    ///
+    struct SymbolizerResponse final
+    {
+        SymbolizerStatus status = SymbolizerStatus::ok;
+        std::vector<SymbolizerResult> results;
+    };
+
+    namespace details
+    {
+        template<typename T>
+        auto
+        append(std::vector<char> & bytes, T const value) -> void
+        {
+            auto const * const p = reinterpret_cast<char const *>(&value);
+            bytes.insert(bytes.end(), p, p + sizeof(T));
+        }
+
+        inline auto
+        append_header(std::vector<char> & bytes, uint16_t const argument, uint32_t const count) -> void
+        {
+            append(bytes, symbolizer_magic);
+            append(bytes, symbolizer_version);
+            append(bytes, argument);
+            append(bytes, count);
+            append(bytes, uint32_t{0});
+        }
+
+        inline auto
+        finish_message(std::vector<char> & bytes) -> void
+        {
+            auto const size = static_cast<uint32_t>(bytes.size() - SymbolizerMessageHeader::end);
+            std::copy_n(reinterpret_cast<char const *>(&size), sizeof(size), bytes.data() + decltype(SymbolizerMessageHeader::size)::begin);
+        }
+    }
+
+    ///
+    /// @brief Reads and validates the header of a message
+    ///
+    [[nodiscard]] inline auto
+    read_symbolizer_header(std::span<char const> const data) -> std::tuple<uint16_t, uint32_t, uint32_t>
+    {
+        if(data.size() < SymbolizerMessageHeader::end
+            || decltype(SymbolizerMessageHeader::magic)::bit_cast(data, 0) != symbolizer_magic
+            || decltype(SymbolizerMessageHeader::version)::bit_cast(data, 0) != symbolizer_version) {
+            throw std::range_error("symbolizer: invalid message header");
+        }
+
+        return {decltype(SymbolizerMessageHeader::argument)::bit_cast(data, 0),
+                decltype(SymbolizerMessageHeader::count)::bit_cast(data, 0),
+                decltype(SymbolizerMessageHeader::size)::bit_cast(data, 0)};
+    }
+
+    ///
+    /// @brief Encodes a request to symbolize addresses of a binary file
+    ///
+    [[nodiscard]] inline auto
+    encode_symbolizer_request(std::string_view const path, std::span<uint64_t const> const pcs) -> std::vector<char>
+    {
+        if(path.size() > UINT16_MAX || pcs.size() > symbolizer_max_count) {
+            throw std::range_error("symbolizer: request too large");
+        }
+
+        std::vector<char> res;
+        res.reserve(SymbolizerMessageHeader::end + path.size() + pcs.size() * sizeof(uint64_t));
+        details::append_header(res, static_cast<uint16_t>(path.size()), static_cast<uint32_t>(pcs.size()));
+        res.insert(res.end(), path.begin(), path.end());
+        for(auto const pc : pcs) {
+            details::append(res, pc);
+        }
+        details::finish_message(res);
+
+        return res;
+    }
+
+    ///
+    /// @brief Decodes a request
+    /// @param data the complete message including the header
+    ///
+    [[nodiscard]] inline auto
+    decode_symbolizer_request(std::span<char const> const data) -> SymbolizerRequest
+    {
+        auto const [path_size, count, size] = read_symbolizer_header(data);
+        size_t const index = SymbolizerMessageHeader::end;
+        if(count > symbolizer_max_count || size != path_size + size_t{count} * sizeof(uint64_t) || data.size() != index + size) {
+            throw std::range_error("symbolizer: invalid request size");
+        }
+
+        SymbolizerRequest res;
+        res.path.assign(data.data() + index, path_size);
+        res.pcs.resize(count);
+        for(size_t i = 0; i < count; ++i) {
+            res.pcs[i] = ::details::bit_cast<uint64_t>(data, index + path_size + i * sizeof(uint64_t));
+        }
+
+        return res;
+    }
+
+    ///
+    /// @brief Encodes the response of a request
+    /// @param image the image of the requested binary file, nullptr if it can not be mapped
+    /// @param pcs the requested addresses
+    ///
+    [[nodiscard]] inline auto
+    encode_symbolizer_response(SymbolizerImage const * const image, std::span<uint64_t const> const pcs) -> std::vector<char>
+    {
+        std::vector<char> res;
+        if(image == nullptr) {
+            details::append_header(res, static_cast<uint16_t>(SymbolizerStatus::image_not_found), 0);
+            details::finish_message(res);
+            return res;
+        }
+
+        details::append_header(res, static_cast<uint16_t>(SymbolizerStatus::ok), static_cast<uint32_t>(pcs.size()));
+        for(auto const pc : pcs) {
+            auto const symbol = image->symbolize(pc);
+            auto const function = symbol.function.substr(0, UINT16_MAX);
+            auto const unit = symbol.unit.substr(0, UINT16_MAX);
+            details::append(res, symbol.low_pc);
+            details::append(res, static_cast<uint16_t>(function.size()));
+            details::append(res, static_cast<uint16_t>(unit.size()));
+            res.insert(res.end(), function.begin(), function.end());
+            res.insert(res.end(), unit.begin(), unit.end());
+        }
+        details::finish_message(res);
+
+        return res;
+    }
+
+    ///
+    /// @brief Encodes the response to a malformed request
+    ///
+    [[nodiscard]] inline auto
+    encode_symbolizer_error(SymbolizerStatus const status) -> std::vector<char>
+    {
+        std::vector<char> res;
+        details::append_header(res, static_cast<uint16_t>(status), 0);
+        details::finish_message(res);
+        return res;
+    }
+
+    ///
+    /// @brief Decodes a response
+    /// @param data the complete message including the header
+    ///
+    [[nodiscard]] inline auto
+    decode_symbolizer_response(std::span<char const> const data) -> SymbolizerResponse
+    {
+        auto const [status, count, size] = read_symbolizer_header(data);
+        if(data.size() != SymbolizerMessageHeader::end + size) {
+            throw std::range_error("symbolizer: invalid response size");
+        }
+
+        SymbolizerResponse res;
+        res.status = static_cast<SymbolizerStatus>(status);
+        res.results.reserve(count);
+
+        size_t index = SymbolizerMessageHeader::end;
+        for(size_t i = 0; i < count; ++i) {
+            SymbolizerResult result;
+            result.low_pc = decltype(SymbolizerResultHeader::low_pc)::bit_cast(data, index);
+            size_t const function_size = decltype(SymbolizerResultHeader::function_size)::bit_cast(data, index);
+            size_t const unit_size = decltype(SymbolizerResultHeader::unit_size)::bit_cast(data, index);
+            index += SymbolizerResultHeader::end;
+            if(index + function_size + unit_size > data.size()) {
+                throw std::range_error("symbolizer: result out of bounds");
+            }
+
+            result.function.assign(data.data() + index, function_size);
+            result.unit.assign(data.data() + index + function_size, unit_size);
+            index += function_size + unit_size;
+            res.results.push_back(std::move(result));
+        }
+
+        return res;
+    }
+}
@@ -0,0 +1,447 @@
+///
+/// @file:   symbolizer_server.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  A symbolizer service on a Unix domain socket and its client
+///
+
+#pragma once
+
+#include "dwarf/symbolizer/symbolizer_protocol.hpp"
+
+#if !defined(_WIN32)
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace dwarf
+{
+    namespace details
+    {
+        ///
+        /// @brief Writes all bytes to a socket
+        /// @return false if the connection is closed
+        ///
+        inline auto
+        send_all(int const fd, std::span<char const> const data) noexcept -> bool
+        {
+            size_t index = 0;
+            while(index < data.size()) {
+                auto const count = ::send(fd, data.data() + index, data.size() - index, MSG_NOSIGNAL);
+                if(count < 0 && errno == EINTR) {
+                    continue;
+                }
+                if(count <= 0) {
+                    return false;
+                }
+                index += static_cast<size_t>(count);
+            }
+            return true;
+        }
+
+        ///
+        /// @brief Reads exactly data.size() bytes from a socket
+        /// @return false if the connection is closed before
+        ///
+        inline auto
+        receive_all(int const fd, std::span<char> const data) noexcept -> bool
+        {
+            size_t index = 0;
+            while(index < data.size()) {
+                auto const count = ::recv(fd, data.data() + index, data.size() - index, 0);
+                if(count < 0 && errno == EINTR) {
+                    continue;
+                }
+                if(count <= 0) {
+                    return false;
+                }
+                index += static_cast<size_t>(count);
+            }
+            return true;
+        }
+
+        ///
+        /// @brief Reads a complete message, the header and the data announced by the header
+        /// @return false if the connection is closed or the header is invalid
+        ///
+        inline auto
+        receive_message(int const fd, std::vector<char> & message, size_t const max_size) -> bool
+        {
+            message.resize(SymbolizerMessageHeader::end);
+            if(!receive_all(fd, message)) {
+                return false;
+            }
+
+            size_t const size = decltype(SymbolizerMessageHeader::size)::bit_cast(message, 0);
+            if(decltype(SymbolizerMessageHeader::magic)::bit_cast(message, 0) != symbolizer_magic || size > max_size) {
+                return false;
+            }
+
+            message.resize(SymbolizerMessageHeader::end + size);
+            return receive_all(fd, std::span<char>(message).subspan(SymbolizerMessageHeader::end));
+        }
+
+        inline auto
+        make_socket_address(std::filesystem::path const & path) -> sockaddr_un
+        {
+            sockaddr_un res = {};
+            res.sun_family = AF_UNIX;
+            auto const & native = path.native();
+            if(native.size() >= sizeof(res.sun_path)) {
+                throw std::range_error("symbolizer: socket path too long");
+            }
+            std::copy(native.begin(), native.end(), res.sun_path);
+            return res;
+        }
+    }
+
+    /// @class dwarf::SymbolizerServer
+    ///
+    /// @brief Answers the requests of symbolizer clients on a Unix domain socket from a
+    ///     dwarf::Symbolizer, so the binaries stay mapped and indexed between the requests
+    /// @details Each connection may send any number of requests, every request is answered
+    ///     before the next one is read. The connections are served by the thread calling run()
+    ///     without blocking: each connection buffers its partial request and its unsent response,
+    ///     so a client that stalls in the middle of a message or does not read its response
+    ///     delays no other client. A connection that makes no progress within the timeout is
+    ///     dropped.
+    ///
+    class SymbolizerServer final
+    {
+    public:
+        static constexpr std::chrono::milliseconds default_timeout = std::chrono::seconds(10);
+
+        ///
+        /// @brief Creates the socket, a stale socket file at the path is replaced
+        /// @param socket_path the path of the socket
+        /// @param capacity the maximum number of resident images
+        /// @param timeout the time a connection may stall with a partial request or an unsent response
+        ///
+        explicit SymbolizerServer(std::filesystem::path socket_path, size_t const capacity = 16,
+            std::chrono::milliseconds const timeout = default_timeout)
+            : socket_path_(std::move(socket_path)), symbolizer_(capacity), timeout_(timeout)
+        {
+            auto const address = details::make_socket_address(socket_path_);
+            ::unlink(socket_path_.c_str());
+
+            listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+            if(listen_fd_ < 0 || ::pipe(stop_fds_) != 0
+                || ::bind(listen_fd_, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0
+                || ::listen(listen_fd_, SOMAXCONN) != 0) {
+                close();
+                throw std::range_error("symbolizer: can not listen on " + socket_path_.string());
+            }
+        }
+
+        SymbolizerServer(SymbolizerServer const &) = delete;
+        auto operator=(SymbolizerServer const &) -> SymbolizerServer & = delete;
+
+        ~SymbolizerServer()
+        {
+            close();
+            ::unlink(socket_path_.c_str());
+        }
+
+        ///
+        /// @brief Serves the clients until stop() is called
+        ///
+        auto
+        run() -> void
+        {
+            std::vector<pollfd> fds;
+            while(true) {
+                fds = {{stop_fds_[0], POLLIN, 0}, {listen_fd_, POLLIN, 0}};
+                for(auto const & connection : connections_) {
+                    fds.push_back({connection.fd, static_cast<short>(connection.output.empty() ? POLLIN : POLLOUT), 0});
+                }
+
+                if(::poll(fds.data(), fds.size(), poll_timeout()) < 0) {
+                    if(errno == EINTR) {
+                        continue;
+                    }
+                    break;
+                }
+
+                if(fds[0].revents != 0) {
+                    break;
+                }
+
+                auto const now = Clock::now();
+                for(size_t i = connections_.size(); i-- > 0;) {
+                    auto & connection = connections_[i];
+                    auto const revents = fds[i + 2].revents;
+
+                    bool is_open = true;
+                    if((revents & (POLLERR | POLLNVAL)) != 0) {
+                        is_open = false;
+                    }
+                    else if((revents & POLLOUT) != 0) {
+                        is_open = flush(connection, now);
+                    }
+                    else if((revents & (POLLIN | POLLHUP)) != 0) {
+                        is_open = receive(connection, now);
+                    }
+                    else if(is_pending(connection) && now - connection.last_activity > timeout_) {
+                        is_open = false;
+                    }
+
+                    if(!is_open) {
+                        ::close(connection.fd);
+                        connections_.erase(connections_.begin() + static_cast<std::ptrdiff_t>(i));
+                    }
+                }
+
+                if(fds[1].revents != 0) {
+                    int fd = -1;
+                    while((fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK)) >= 0) {
+                        connections_.push_back({fd, {}, {}, 0, now});
+                    }
+                }
+            }
+
+            for(auto const & connection : connections_) {
+                ::close(connection.fd);
+            }
+            connections_.clear();
+        }
+
+        ///
+        /// @brief Makes run() return, may be called from any thread or a signal handler
+        ///
+        auto
+        stop() noexcept -> void
+        {
+            char const c = 0;
+            static_cast<void>(::write(stop_fds_[1], &c, 1));
+        }
+
+        ///
+        /// @brief Returns the symbolizer, must not be used while run() is executed
+        ///
+        [[nodiscard]] auto
+        symbolizer() noexcept -> Symbolizer &
+        {
+            return symbolizer_;
+        }
+
+        [[nodiscard]] auto
+        socket_path() const noexcept -> std::filesystem::path const &
+        {
+            return socket_path_;
+        }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        /// @brief The size of the largest valid request after the header
+        static constexpr size_t max_request_size = UINT16_MAX + size_t{symbolizer_max_count} * sizeof(uint64_t);
+        static constexpr size_t receive_size = 64 * 1024;
+
+        struct Connection final
+        {
+            int fd = -1;
+            /// @brief The received bytes of the requests not answered yet
+            std::vector<char> input;
+            /// @brief The response of the current request
+            std::vector<char> output;
+            /// @brief The number of bytes of the response sent so far
+            size_t output_offset = 0;
+            Clock::time_point last_activity = {};
+        };
+
+        ///
+        /// @brief Returns true if the connection is in the middle of a request or of a response
+        ///
+        [[nodiscard]] static auto
+        is_pending(Connection const & connection) noexcept -> bool
+        {
+            return !connection.input.empty() || !connection.output.empty();
+        }
+
+        ///
+        /// @brief Returns the time until the first pending connection times out, -1 if there is none
+        ///
+        [[nodiscard]] auto
+        poll_timeout() const -> int
+        {
+            auto const now = Clock::now();
+            auto res = std::chrono::milliseconds::max();
+            for(auto const & connection : connections_) {
+                if(is_pending(connection)) {
+                    auto const remaining = std::chrono::ceil<std::chrono::milliseconds>(connection.last_activity + timeout_ - now);
+                    res = std::min(res, std::max(remaining, std::chrono::milliseconds(0)) + std::chrono::milliseconds(1));
+                }
+            }
+
+            return res == std::chrono::milliseconds::max() ? -1 : static_cast<int>(std::min<int64_t>(res.count(), INT32_MAX));
+        }
+
+        ///
+        /// @brief Reads the available bytes of a connection and answers the complete requests
+        /// @return false if the connection is closed or sent an invalid message
+        ///
+        auto
+        receive(Connection & connection, Clock::time_point const now) -> bool
+        {
+            size_t const size = connection.input.size();
+            connection.input.resize(size + receive_size);
+            auto const count = ::recv(connection.fd, connection.input.data() + size, receive_size, 0);
+            connection.input.resize(size + static_cast<size_t>(std::max<ssize_t>(count, 0)));
+
+            if(count < 0) {
+                return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+            }
+            if(count == 0) {
+                return false;
+            }
+
+            connection.last_activity = now;
+            return flush(connection, now);
+        }
+
+        ///
+        /// @brief Sends as much of the pending response as the socket accepts, then answers the
+        ///     next buffered request
+        /// @return false if the connection is closed or sent an invalid message
+        ///
+        auto
+        flush(Connection & connection, Clock::time_point const now) -> bool
+        {
+            while(true) {
+                while(connection.output_offset < connection.output.size()) {
+                    auto const count = ::send(connection.fd, connection.output.data() + connection.output_offset,
+                        connection.output.size() - connection.output_offset, MSG_NOSIGNAL);
+                    if(count < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if(count < 0) {
+                        return errno == EAGAIN || errno == EWOULDBLOCK;
+                    }
+                    connection.output_offset += static_cast<size_t>(count);
+                    connection.last_activity = now;
+                }
+                connection.output.clear();
+                connection.output_offset = 0;
+
+                auto const & input = connection.input;
+                if(input.size() < SymbolizerMessageHeader::end) {
+                    return true;
+                }
+
+                size_t const size = decltype(SymbolizerMessageHeader::size)::bit_cast(input, 0);
+                if(decltype(SymbolizerMessageHeader::magic)::bit_cast(input, 0) != symbolizer_magic || size > max_request_size) {
+                    return false;
+                }
+
+                size_t const message_size = SymbolizerMessageHeader::end + size;
+                if(input.size() < message_size) {
+                    return true;
+                }
+
+                connection.output = respond(std::span<char const>(input).first(message_size));
+                connection.input.erase(connection.input.begin(), connection.input.begin() + static_cast<std::ptrdiff_t>(message_size));
+            }
+        }
+
+        ///
+        /// @brief Answers a complete request
+        /// @details An error while loading or indexing the binary is answered, it must not end the service
+        ///
+        auto
+        respond(std::span<char const> const message) -> std::vector<char>
+        {
+            try {
+                auto const request = decode_symbolizer_request(message);
+                auto const image = symbolizer_.image(request.path);
+                return encode_symbolizer_response(image.get(), request.pcs);
+            }
+            catch(std::range_error const &) {
+                return encode_symbolizer_error(SymbolizerStatus::bad_request);
+            }
+            catch(std::exception const &) {
+                return encode_symbolizer_error(SymbolizerStatus::internal_error);
+            }
+        }
+
+        auto
+        close() noexcept -> void
+        {
+            for(int * const fd : {&listen_fd_, &stop_fds_[0], &stop_fds_[1]}) {
+                if(*fd >= 0) {
+                    ::close(*fd);
+                    *fd = -1;
+                }
+            }
+        }
+
+        std::filesystem::path socket_path_;
+        Symbolizer symbolizer_;
+        std::chrono::milliseconds timeout_ = default_timeout;
+        std::vector<Connection> connections_;
+        int listen_fd_ = -1;
+        int stop_fds_[2] = {-1, -1};
+    };
+
+    /// @class dwarf::SymbolizerClient
+    ///
+    /// @brief A connection to a dwarf::SymbolizerServer
+    ///
+    class SymbolizerClient final
+    {
+    public:
+        ///
+        /// @brief Connects to the server
+        /// @param socket_path the path of the socket of the server
+        ///
+        explicit SymbolizerClient(std::filesystem::path const & socket_path)
+        {
+            auto const address = details::make_socket_address(socket_path);
+            fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if(fd_ < 0 || ::connect(fd_, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0) {
+                if(fd_ >= 0) {
+                    ::close(fd_);
+                }
+                throw std::range_error("symbolizer: can not connect to " + socket_path.string());
+            }
+        }
+
+        SymbolizerClient(SymbolizerClient const &) = delete;
+        auto operator=(SymbolizerClient const &) -> SymbolizerClient & = delete;
+
+        ~SymbolizerClient()
+        {
+            ::close(fd_);
+        }
+
+        ///
+        /// @brief Symbolizes a batch of addresses of a binary file
+        /// @param path the binary file, as seen by the server
+        /// @param pcs the addresses
+        ///
+        [[nodiscard]] auto
+        symbolize(std::string_view const path, std::span<uint64_t const> const pcs) -> SymbolizerResponse
+        {
+            if(!details::send_all(fd_, encode_symbolizer_request(path, pcs))) {
+                throw std::range_error("symbolizer: connection closed");
+            }
+
+            std::vector<char> message;
+            if(!details::receive_message(fd_, message, UINT32_MAX)) {
+                throw std::range_error("symbolizer: connection closed");
+            }
+
+            return decode_symbolizer_response(message);
+        }
+
+    private:
+        int fd_ = -1;
+    };
+}
+
+#endif
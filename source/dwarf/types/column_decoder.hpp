@@ -0,0 +1,160 @@
+///
+/// @file:   column_decoder.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Decodes one member of many instances of a type at once
+///
+
+#pragma once
+
+#include "dwarf/types/type_layout.hpp"
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace dwarf
+{
+    namespace details
+    {
+        ///
+        /// @brief Converts the extracted bits of a leaf to a value of type T
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        convert_leaf_value(LayoutLeaf const & leaf, uint64_t const bits) noexcept -> T
+        {
+            if(leaf.encoding == BaseTypeAttributeEncoding::dw_ate_float_) {
+                if(leaf.byte_size == sizeof(float)) {
+                    return static_cast<T>(std::bit_cast<float>(static_cast<uint32_t>(bits)));
+                }
+                if(leaf.byte_size == sizeof(double)) {
+                    return static_cast<T>(std::bit_cast<double>(bits));
+                }
+            }
+
+            if(leaf.is_signed()) {
+                return static_cast<T>(static_cast<int64_t>(bits));
+            }
+
+            return static_cast<T>(bits);
+        }
+
+#if defined(__AVX2__)
+        ///
+        /// @brief Decodes a column with AVX2 gathers, 8 elements at a time for 32 bit values
+        ///     and 4 elements at a time for 64 bit values
+        /// @return the number of elements decoded, the rest must be decoded element by element
+        ///
+        template<typename T>
+        [[nodiscard]] inline auto
+        decode_column_avx2(std::span<char const> const elements, size_t const stride, LayoutLeaf const & leaf,
+            std::span<T> const column) noexcept -> size_t
+        {
+            bool const is_float_leaf = leaf.encoding == BaseTypeAttributeEncoding::dw_ate_float_;
+            bool const is_raw_copy = std::is_floating_point_v<T> && is_float_leaf && leaf.byte_size == sizeof(T);
+            bool const is_integer = std::is_integral_v<T> && !is_float_leaf && leaf.byte_size <= sizeof(T);
+
+            if((!is_raw_copy && !is_integer) || leaf.byte_size == 0 || leaf.offset + leaf.byte_size > stride
+                || elements.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+                return 0;
+            }
+
+            uint32_t const bits = leaf.bit_size > 0 ? leaf.bit_size : static_cast<uint32_t>(leaf.byte_size * 8);
+            auto const * const base = elements.data();
+            size_t i = 0;
+
+            if constexpr (sizeof(T) == sizeof(uint32_t))
+            {
+                __m256i index = _mm256_add_epi32(
+                    _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int32_t>(stride)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)),
+                    _mm256_set1_epi32(static_cast<int32_t>(leaf.offset)));
+                __m256i const step = _mm256_set1_epi32(static_cast<int32_t>(8 * stride));
+                __m128i const shift = _mm_cvtsi32_si128(static_cast<int32_t>(leaf.bit_offset));
+                __m256i const mask = _mm256_set1_epi32(bits < 32 ? static_cast<int32_t>((uint32_t(1) << bits) - 1) : -1);
+                __m256i const sign = _mm256_set1_epi32(static_cast<int32_t>(uint32_t(1) << (bits - 1)));
+                bool const is_masked = !is_raw_copy && bits < 32;
+                bool const is_sign_extended = is_masked && leaf.is_signed();
+
+                for(; i + 8 <= column.size() && leaf.offset + (i + 7) * stride + sizeof(uint32_t) <= elements.size(); i += 8) {
+                    __m256i value = _mm256_i32gather_epi32(reinterpret_cast<int const *>(base), index, 1);
+                    if(is_masked) {
+                        value = _mm256_and_si256(_mm256_srl_epi32(value, shift), mask);
+                    }
+                    if(is_sign_extended) {
+                        value = _mm256_sub_epi32(_mm256_xor_si256(value, sign), sign);
+                    }
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(column.data() + i), value);
+                    index = _mm256_add_epi32(index, step);
+                }
+            }
+            else if constexpr (sizeof(T) == sizeof(uint64_t))
+            {
+                __m128i index = _mm_add_epi32(
+                    _mm_mullo_epi32(_mm_set1_epi32(static_cast<int32_t>(stride)), _mm_setr_epi32(0, 1, 2, 3)),
+                    _mm_set1_epi32(static_cast<int32_t>(leaf.offset)));
+                __m128i const step = _mm_set1_epi32(static_cast<int32_t>(4 * stride));
+                __m128i const shift = _mm_cvtsi32_si128(static_cast<int32_t>(leaf.bit_offset));
+                __m256i const mask = _mm256_set1_epi64x(bits < 64 ? static_cast<int64_t>((uint64_t(1) << bits) - 1) : -1);
+                __m256i const sign = _mm256_set1_epi64x(static_cast<int64_t>(uint64_t(1) << (bits - 1)));
+                bool const is_masked = !is_raw_copy && bits < 64;
+                bool const is_sign_extended = is_masked && leaf.is_signed();
+
+                for(; i + 4 <= column.size() && leaf.offset + (i + 3) * stride + sizeof(uint64_t) <= elements.size(); i += 4) {
+                    __m256i value = _mm256_i32gather_epi64(reinterpret_cast<long long const *>(base), index, 1);
+                    if(is_masked) {
+                        value = _mm256_and_si256(_mm256_srl_epi64(value, shift), mask);
+                    }
+                    if(is_sign_extended) {
+                        value = _mm256_sub_epi64(_mm256_xor_si256(value, sign), sign);
+                    }
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(column.data() + i), value);
+                    index = _mm_add_epi32(index, step);
+                }
+            }
+
+            return i;
+        }
+#endif
+    }
+
+    ///
+    /// @brief Decodes one leaf of many consecutive instances of a type into a column of values
+    /// @details Uses AVX2 gathers if the code is compiled for AVX2 and the column holds
+    ///     32 or 64 bit values. Other columns and the remaining elements are decoded one by one.
+    /// @param elements the memory of the instances, e.g. an array of structures in a memory dump
+    /// @param stride the distance of two instances in bytes, usually the size of the type
+    /// @param leaf the leaf of the layout of the type to decode
+    /// @param column receives the decoded values
+    /// @return the number of decoded values, the smaller of the number of instances and the size of the column
+    ///
+    template<typename T>
+    constexpr auto
+    decode_column(std::span<char const> const elements, size_t const stride, LayoutLeaf const & leaf, std::span<T> const column) noexcept -> size_t
+    {
+        static_assert(std::is_arithmetic_v<T>, "a column holds integral or floating point values");
+
+        if(stride == 0) {
+            return 0;
+        }
+
+        size_t const count = std::min(column.size(), elements.size() / stride);
+        size_t i = 0;
+
+#if defined(__AVX2__)
+        if(!std::is_constant_evaluated()) {
+            i = details::decode_column_avx2(elements, stride, leaf, column.first(count));
+        }
+#endif
+
+        for(; i < count; ++i) {
+            uint64_t const bits = leaf.extract(elements.subspan(i * stride, stride));
+            column[i] = details::convert_leaf_value<T>(leaf, bits);
+        }
+
+        return count;
+    }
+}
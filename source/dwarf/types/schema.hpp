@@ -0,0 +1,205 @@
+///
+/// @file:   schema.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Extracts struct layouts, enumerators and symbol addresses at compile time
+///
+
+#pragma once
+
+#include "dwarf/types/type_layout.hpp"
+#include <array>
+
+namespace dwarf
+{
+    /// @class dwarf::StaticLayoutLeaf
+    ///
+    /// @brief A leaf of a type layout which can be stored in a constexpr variable
+    ///
+    struct StaticLayoutLeaf final
+    {
+        /// @brief The maximum number of characters of a path, longer paths are truncated
+        static constexpr size_t max_path_size = 64;
+
+        std::array<char, max_path_size> path_data = {};
+        size_t path_size = 0;
+        uint64_t offset = 0;
+        uint64_t count = 1;
+        uint64_t stride = 0;
+        uint64_t byte_size = 0;
+        uint32_t bit_offset = 0;
+        uint32_t bit_size = 0;
+        BaseTypeAttributeEncoding encoding = {};
+
+        ///
+        /// @brief The path of the scalar within the type, e.g. base.values[4].x
+        ///
+        [[nodiscard]] constexpr auto
+        path() const noexcept -> std::string_view
+        {
+            return std::string_view(path_data.data(), path_size);
+        }
+    };
+
+    /// @class dwarf::Enumerator
+    ///
+    /// @brief A named value of an enumeration
+    ///
+    struct Enumerator final
+    {
+        /// @brief The name of the enumerator, points into the binary file
+        std::string_view name = {};
+        int64_t value = 0;
+    };
+
+    ///
+    /// @brief Returns the number of leaves of the layout of a type
+    /// @param data the binary file
+    /// @param qualified_name the name of the type, e.g. std::size_t
+    ///
+    [[nodiscard]] constexpr auto
+    static_layout_size(std::span<char const> const data, std::string_view const qualified_name) -> size_t
+    {
+        TypeGraph const type_graph(get_debug_sections(data));
+        TypeLayouts type_layouts(type_graph);
+        return type_layouts.layout(qualified_name).size();
+    }
+
+    ///
+    /// @brief Returns the flattened layout of a type, intended for constexpr variables
+    /// @tparam N the number of leaves, see dwarf::static_layout_size()
+    /// @param data the binary file
+    /// @param qualified_name the name of the type, e.g. std::size_t
+    ///
+    template<size_t N>
+    [[nodiscard]] constexpr auto
+    static_layout(std::span<char const> const data, std::string_view const qualified_name) -> std::array<StaticLayoutLeaf, N>
+    {
+        TypeGraph const type_graph(get_debug_sections(data));
+        TypeLayouts type_layouts(type_graph);
+        auto const layout = type_layouts.layout(qualified_name);
+
+        std::array<StaticLayoutLeaf, N> res = {};
+        for(size_t i = 0; i < N && i < layout.size(); ++i) {
+            auto const & leaf = layout[i];
+            res[i].path_size = std::min(leaf.path.size(), StaticLayoutLeaf::max_path_size);
+            std::copy_n(leaf.path.begin(), res[i].path_size, res[i].path_data.begin());
+            res[i].offset = leaf.offset;
+            res[i].count = leaf.count;
+            res[i].stride = leaf.stride;
+            res[i].byte_size = leaf.byte_size;
+            res[i].bit_offset = leaf.bit_offset;
+            res[i].bit_size = leaf.bit_size;
+            res[i].encoding = leaf.encoding;
+        }
+
+        return res;
+    }
+
+    ///
+    /// @brief Returns the number of enumerators of an enumeration
+    /// @param data the binary file
+    /// @param qualified_name the name of the enumeration
+    ///
+    [[nodiscard]] constexpr auto
+    enumerator_count(std::span<char const> const data, std::string_view const qualified_name) -> size_t
+    {
+        TypeGraph const type_graph(get_debug_sections(data));
+        TypeId const id = type_graph.find(qualified_name);
+        return id != invalid_type_id ? type_graph.members(id).size() : 0;
+    }
+
+    ///
+    /// @brief Returns the enumerators of an enumeration, intended for constexpr variables
+    /// @tparam N the number of enumerators, see dwarf::enumerator_count()
+    /// @param data the binary file
+    /// @param qualified_name the name of the enumeration
+    ///
+    template<size_t N>
+    [[nodiscard]] constexpr auto
+    enumerators(std::span<char const> const data, std::string_view const qualified_name) -> std::array<Enumerator, N>
+    {
+        TypeGraph const type_graph(get_debug_sections(data));
+        TypeId const id = type_graph.find(qualified_name);
+
+        std::array<Enumerator, N> res = {};
+        if(id == invalid_type_id) {
+            return res;
+        }
+
+        auto const members = type_graph.members(id);
+        for(size_t i = 0; i < N && i < members.size(); ++i) {
+            res[i].name = members[i].name;
+            res[i].value = members[i].value;
+        }
+
+        return res;
+    }
+
+    ///
+    /// @brief Returns the address of a variable or function
+    /// @details Variables must be located with DW_OP_addr or DW_OP_addrx, functions are located by DW_AT_low_pc
+    /// @param data the binary file
+    /// @param name the name or the linkage name of the variable or function
+    /// @return the address, 0 if the symbol is not found
+    ///
+    [[nodiscard]] constexpr auto
+    symbol_address(std::span<char const> const data, std::string_view const name) -> uint64_t
+    {
+        DebugSections const sections = get_debug_sections(data);
+
+        for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+            Unit const unit(sections, unit_header);
+            DieCursor cursor(unit);
+
+            while(cursor.next()) {
+                Tag const tag = cursor.die().tag();
+                if(tag != Tag::dw_tag_variable && tag != Tag::dw_tag_subprogram) {
+                    continue;
+                }
+
+                bool is_match = false;
+                uint64_t address = 0;
+
+                cursor.read_attributes([&](AttributeSpecification const & specification, AttributeValue const & value)
+                {
+                    switch (specification.attribute)
+                    {
+                    case Attribute::dw_at_name:
+                    case Attribute::dw_at_linkage_name:
+                        is_match = is_match || value.as_string() == name;
+                        break;
+                    case Attribute::dw_at_low_pc:
+                        address = value.as_address();
+                        break;
+                    case Attribute::dw_at_location:
+                    {
+                        auto const block = value.as_block();
+                        if(block.empty()) {
+                            break;
+                        }
+
+                        auto const operation = static_cast<Operation>(std::bit_cast<uint8_t>(block[0]));
+                        if(operation == Operation::dw_op_addr && block.size() > unit.address_size()) {
+                            address = read_unsigned(block, 1, unit.address_size());
+                        }
+                        else if(operation == Operation::dw_op_addrx) {
+                            auto const index = ::details::uleb128<uint64_t>(block, 1).val;
+                            address = AttributeValue(unit, FormValue{Form::dw_form_addrx, index, {}}).as_address();
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                    }
+                });
+
+                if(is_match && address != 0) {
+                    return address;
+                }
+            }
+        }
+
+        return 0;
+    }
+}
@@ -0,0 +1,944 @@
+///
+/// @file:   type_graph.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The types of all units with each distinct type stored once
+///
+
+#pragma once
+
+#include "dwarf/debug_info/die_cursor.hpp"
+#include "dwarf/debug_info/debug_info.hpp"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dwarf
+{
+    /// @brief The index of a type in the dwarf::TypeGraph
+    using TypeId = uint32_t;
+
+    /// @brief Marks a missing type, e.g. the return type of a void function
+    constexpr TypeId invalid_type_id = std::numeric_limits<TypeId>::max();
+
+    /// @class dwarf::TypeNode
+    ///
+    /// @brief A type, a namespace or a scope local to a function
+    ///
+    struct TypeNode final
+    {
+        /// @brief The tag of the debugging information entry describing the type
+        Tag tag = {};
+        /// @brief The encoding of a base type
+        BaseTypeAttributeEncoding encoding = {};
+        /// @brief True if the type is only declared and not defined
+        bool is_declaration = false;
+        /// @brief The name of the type without its scope, points into the debug sections
+        std::string_view name = {};
+        /// @brief The namespace, class or function the type is declared in
+        TypeId scope = invalid_type_id;
+        /// @brief The referenced type of pointers, modifiers, typedefs and arrays,
+        ///     the return type of functions and the underlying type of enumerations
+        TypeId type = invalid_type_id;
+        /// @brief The size of the type in bytes
+        uint64_t byte_size = 0;
+        /// @brief The index of the first member in the list of all members
+        uint32_t first_member = 0;
+        /// @brief The number of members
+        uint32_t member_count = 0;
+        /// @brief Is not 0 for types which are only visible inside their unit, like types in anonymous namespaces
+        uint64_t local_key = 0;
+    };
+
+    /// @class dwarf::TypeMember
+    ///
+    /// @brief A data member, base class, enumerator, array dimension or function parameter
+    ///
+    struct TypeMember final
+    {
+        /// @brief DW_TAG_member, DW_TAG_inheritance, DW_TAG_enumerator, DW_TAG_subrange_type or DW_TAG_formal_parameter
+        Tag tag = {};
+        /// @brief The name of data members and enumerators
+        std::string_view name = {};
+        /// @brief The type of data members, base classes and parameters
+        TypeId type = invalid_type_id;
+        /// @brief The byte offset of data members and base classes, the value of enumerators
+        ///     or the number of elements of an array dimension
+        int64_t value = 0;
+        /// @brief The number of bits of a bit field
+        uint32_t bit_size = 0;
+        /// @brief The offset in bits of a bit field from the beginning of the containing entity
+        uint32_t bit_offset = 0;
+    };
+
+    /// @class dwarf::TypeGraphStatistics
+    ///
+    /// @brief Compares the memory usage of the type graph with separate type trees for each unit
+    ///
+    struct TypeGraphStatistics final
+    {
+        /// @brief The number of units added to the graph
+        size_t units = 0;
+        /// @brief The number of type entries in all units
+        size_t type_entries = 0;
+        /// @brief The number of member entries in all units
+        size_t member_entries = 0;
+        /// @brief The number of distinct types in the graph
+        size_t types = 0;
+        /// @brief The number of distinct members in the graph
+        size_t members = 0;
+        /// @brief The memory used by separate type trees for each unit with the same node layout
+        size_t per_unit_bytes = 0;
+        /// @brief The memory used by the type graph
+        size_t bytes = 0;
+    };
+
+    /// @class dwarf::TypeGraph
+    ///
+    /// @brief The types of all units with each distinct type stored once
+    /// @details Each unit describes all types it uses, so types declared in common headers are
+    ///     repeated in every unit. The type graph canonicalizes the types of all units by structural
+    ///     hashing, so that each distinct type is stored once.
+    ///     Classes, structures, unions and enumerations are identified by their name, scope, size
+    ///     and the names and offsets of their members first, so that recursive types are
+    ///     canonicalized before their members are resolved. A definition whose member types
+    ///     differ from the matching type becomes a new type, references to itself from its
+    ///     members keep pointing to the matching type. Declarations match any definition of
+    ///     the same name. All other types are identified by their attributes and the canonical
+    ///     types they reference.
+    ///     Names point into the debug sections, which must outlive the graph.
+    ///
+    class TypeGraph final
+    {
+    public:
+        constexpr TypeGraph() noexcept = default;
+
+        ///
+        /// @brief Extracts the types of all units of the debug sections
+        /// @param sections the debug sections of the binary file
+        ///
+        explicit constexpr TypeGraph(DebugSections const & sections)
+        {
+            for(UnitHeader const unit_header : DebugInfo(sections.debug_info)) {
+                Unit const unit(sections, unit_header);
+                add_unit(unit);
+            }
+        }
+
+        ///
+        /// @brief Extracts the types of a unit and merges them into the graph
+        /// @param unit the unit
+        ///
+        constexpr auto
+        add_unit(Unit const & unit) -> void;
+
+        [[nodiscard]] constexpr auto
+        node(TypeId const id) const noexcept -> TypeNode const &
+        {
+            return nodes_[id];
+        }
+
+        [[nodiscard]] constexpr auto
+        members(TypeId const id) const noexcept -> std::span<TypeMember const>
+        {
+            auto const & type = nodes_[id];
+            return std::span<TypeMember const>(members_).subspan(type.first_member, type.member_count);
+        }
+
+        ///
+        /// @brief Returns the number of distinct types
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_t
+        {
+            return nodes_.size();
+        }
+
+        ///
+        /// @brief Returns the canonical type of a debugging information entry
+        /// @param offset the offset of the entry in the .debug_info section
+        ///
+        [[nodiscard]] constexpr auto
+        type_of(size_t const offset) const noexcept -> TypeId;
+
+        ///
+        /// @brief Finds a named type, namespaces and classes are separated by ::
+        /// @details Returns the first definition added if units define different types of the same name
+        /// @param qualified_name the name of the type, e.g. std::size_t
+        ///
+        [[nodiscard]] constexpr auto
+        find(std::string_view const qualified_name) const noexcept -> TypeId;
+
+        ///
+        /// @brief Returns the name of a type including its namespaces and classes
+        ///
+        [[nodiscard]] constexpr auto
+        qualified_name(TypeId const id) const -> std::string;
+
+        [[nodiscard]] constexpr auto
+        statistics() const noexcept -> TypeGraphStatistics;
+
+    private:
+        /// @brief A type entry of the unit which is currently added
+        struct Entry final
+        {
+            size_t offset = 0;
+            size_t type_offset = 0;
+            Tag tag = {};
+            BaseTypeAttributeEncoding encoding = {};
+            bool is_declaration = false;
+            bool is_scope_local = false;
+            std::string_view name = {};
+            uint64_t byte_size = 0;
+            int64_t value = 0;
+            uint64_t lower_bound = 0;
+            uint64_t upper_bound = 0;
+            uint32_t bit_size = 0;
+            uint32_t bit_offset = 0;
+            uint32_t legacy_bit_offset = 0;
+            bool has_upper_bound = false;
+            bool has_bit_offset = false;
+            bool has_legacy_bit_offset = false;
+            uint32_t parent = no_entry;
+            uint32_t first_child = no_entry;
+            uint32_t next_sibling = no_entry;
+        };
+
+        static constexpr uint32_t no_entry = std::numeric_limits<uint32_t>::max();
+        static constexpr TypeId unresolved = invalid_type_id - 1;
+
+        [[nodiscard]] static constexpr auto
+        is_type(Tag const tag) noexcept -> bool;
+
+        [[nodiscard]] static constexpr auto
+        is_member(Tag const tag) noexcept -> bool;
+
+        [[nodiscard]] static constexpr auto
+        is_nominal(TypeNode const & type) noexcept -> bool;
+
+        constexpr auto
+        read_entry(DieCursor & cursor, Entry & entry) const -> void;
+
+        constexpr auto
+        resolve(uint32_t const index) -> TypeId;
+
+        constexpr auto
+        resolve_offset(size_t const offset) -> TypeId;
+
+        constexpr auto
+        resolve_members(uint32_t const index, bool const resolve_types) -> std::vector<TypeMember>;
+
+        [[nodiscard]] constexpr auto
+        hash(TypeNode const & type, std::span<TypeMember const> const members) const noexcept -> uint64_t;
+
+        [[nodiscard]] constexpr auto
+        equal(TypeNode const & type, std::span<TypeMember const> const members, TypeId const id) const noexcept -> bool;
+
+        [[nodiscard]] constexpr auto
+        lookup(TypeNode const & type, std::span<TypeMember const> const members, uint64_t const hash_value) const noexcept -> TypeId;
+
+        [[nodiscard]] constexpr auto
+        lookup_definition(TypeNode const & type, std::span<TypeMember const> const members, uint64_t const hash_value,
+            bool const compare_types) const noexcept -> TypeId;
+
+        constexpr auto
+        insert(TypeNode const & type, std::span<TypeMember const> const members, uint64_t const hash_value) -> TypeId;
+
+        constexpr auto
+        grow() -> void;
+
+        std::vector<TypeNode> nodes_ = {};
+        std::vector<TypeMember> members_ = {};
+        std::vector<uint64_t> hashes_ = {};
+        /// @brief Open addressing hash table of type ids, 0 is an empty slot, otherwise id + 1
+        std::vector<TypeId> slots_ = {};
+        /// @brief Sorted offsets of all type entries with their canonical type
+        std::vector<std::pair<size_t, TypeId>> offsets_ = {};
+
+        size_t units_ = 0;
+        size_t type_entries_ = 0;
+        size_t member_entries_ = 0;
+
+        /// @brief State of the unit which is currently added
+        Unit const * unit_ = nullptr;
+        std::vector<Entry> entries_ = {};
+        std::vector<TypeId> ids_ = {};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Implementation
+
+    namespace details
+    {
+        /// @brief FNV-1a hash
+        [[nodiscard]] constexpr auto
+        hash_combine(uint64_t const seed, uint64_t const value) noexcept -> uint64_t
+        {
+            uint64_t res = seed;
+            for(size_t i = 0; i < sizeof(value); ++i) {
+                res ^= (value >> (i * 8)) & 0xff;
+                res *= 0x100000001b3;
+            }
+            return res;
+        }
+
+        [[nodiscard]] constexpr auto
+        hash_combine(uint64_t const seed, std::string_view const value) noexcept -> uint64_t
+        {
+            uint64_t res = seed;
+            for(char const c : value) {
+                res ^= static_cast<uint8_t>(c);
+                res *= 0x100000001b3;
+            }
+            return hash_combine(res, value.size());
+        }
+
+        constexpr uint64_t hash_seed = 0xcbf29ce484222325;
+    }
+
+    constexpr auto
+    TypeGraph::is_type(Tag const tag) noexcept -> bool
+    {
+        switch (tag)
+        {
+        case Tag::dw_tag_base_type:
+        case Tag::dw_tag_unspecified_type:
+        case Tag::dw_tag_pointer_type:
+        case Tag::dw_tag_reference_type:
+        case Tag::dw_tag_rvalue_reference_type:
+        case Tag::dw_tag_ptr_to_member_type:
+        case Tag::dw_tag_const_type:
+        case Tag::dw_tag_volatile_type:
+        case Tag::dw_tag_restrict_type:
+        case Tag::dw_tag_atomic_type:
+        case Tag::dw_tag_typedef_:
+        case Tag::dw_tag_structure_type:
+        case Tag::dw_tag_class_type:
+        case Tag::dw_tag_union_type:
+        case Tag::dw_tag_enumeration_type:
+        case Tag::dw_tag_array_type:
+        case Tag::dw_tag_subroutine_type:
+        case Tag::dw_tag_namespace_:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    constexpr auto
+    TypeGraph::is_member(Tag const tag) noexcept -> bool
+    {
+        switch (tag)
+        {
+        case Tag::dw_tag_member:
+        case Tag::dw_tag_inheritance:
+        case Tag::dw_tag_enumerator:
+        case Tag::dw_tag_subrange_type:
+        case Tag::dw_tag_formal_parameter:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    constexpr auto
+    TypeGraph::is_nominal(TypeNode const & type) noexcept -> bool
+    {
+        switch (type.tag)
+        {
+        case Tag::dw_tag_structure_type:
+        case Tag::dw_tag_class_type:
+        case Tag::dw_tag_union_type:
+        case Tag::dw_tag_enumeration_type:
+        case Tag::dw_tag_namespace_:
+            return !type.name.empty();
+        default:
+            return false;
+        }
+    }
+
+    constexpr auto
+    TypeGraph::add_unit(Unit const & unit) -> void
+    {
+        StageTimer const timer(ReaderStage::type_graph);
+        unit_ = &unit;
+        entries_.clear();
+        ids_.clear();
+
+        // Collect the type and member entries of the unit
+        DieCursor cursor(unit);
+        std::vector<uint32_t> parents = {};         // the recorded entry at each depth
+        std::vector<uint32_t> last_children = {};   // the last recorded child of the entry at each depth
+        std::vector<bool> locals = {};              // true if the entry at each depth is local to a function
+
+        while(cursor.next()) {
+            size_t const depth = cursor.depth();
+            Tag const tag = cursor.die().tag();
+
+            parents.resize(depth + 1);
+            last_children.resize(depth + 1);
+            locals.resize(depth + 1);
+
+            uint32_t const parent = depth > 0 ? parents[depth - 1] : no_entry;
+            bool const is_local = depth > 0 && locals[depth - 1];
+
+            parents[depth] = no_entry;
+            last_children[depth] = no_entry;
+            locals[depth] = is_local || (depth > 0 && !is_type(tag) && !is_member(tag));
+
+            bool const is_recorded = is_type(tag) || (is_member(tag) && parent != no_entry);
+            if(!is_recorded) {
+                continue;
+            }
+
+            Entry entry = {};
+            entry.offset = cursor.die().offset();
+            entry.tag = tag;
+            entry.parent = parent;
+            entry.is_scope_local = is_local;
+            read_entry(cursor, entry);
+
+            auto const index = static_cast<uint32_t>(entries_.size());
+            if(parent != no_entry) {
+                if(last_children[depth - 1] == no_entry) {
+                    entries_[parent].first_child = index;
+                }
+                else {
+                    entries_[last_children[depth - 1]].next_sibling = index;
+                }
+                last_children[depth - 1] = index;
+            }
+
+            entries_.push_back(entry);
+            parents[depth] = index;
+
+            if(is_member(tag)) {
+                ++member_entries_;
+            }
+            else {
+                ++type_entries_;
+            }
+        }
+
+        // Canonicalize the types
+        size_t const first_offset = offsets_.size();
+        ids_.resize(entries_.size(), unresolved);
+        for(uint32_t i = 0; i < entries_.size(); ++i) {
+            if(is_type(entries_[i].tag)) {
+                offsets_.push_back({entries_[i].offset, resolve(i)});
+            }
+        }
+
+        if(first_offset > 0 && first_offset < offsets_.size() && offsets_[first_offset].first <= offsets_[first_offset - 1].first)
+        {   // the unit is not behind the units added before, merge its sorted offsets and keep the first added ones
+            std::vector<std::pair<size_t, TypeId>> merged = {};
+            merged.reserve(offsets_.size());
+            auto const offsets = std::span(offsets_);
+            std::ranges::merge(offsets.first(first_offset), offsets.subspan(first_offset), std::back_inserter(merged), 
+                {}, &std::pair<size_t, TypeId>::first, &std::pair<size_t, TypeId>::first);
+
+            auto const duplicates = std::ranges::unique(merged, {}, &std::pair<size_t, TypeId>::first);
+            merged.erase(duplicates.begin(), duplicates.end());
+            offsets_ = std::move(merged);
+        }
+
+        ++units_;
+        unit_ = nullptr;
+        entries_.clear();
+        ids_.clear();
+    }
+
+    constexpr auto
+    TypeGraph::read_entry(DieCursor & cursor, Entry & entry) const -> void
+    {
+        cursor.read_attributes([&](AttributeSpecification const & specification, AttributeValue const & value)
+        {
+            switch (specification.attribute)
+            {
+            case Attribute::dw_at_name:
+                entry.name = value.as_string();
+                break;
+            case Attribute::dw_at_type:
+                entry.type_offset = value.is_reference() ? value.as_reference() : 0;
+                break;
+            case Attribute::dw_at_byte_size:
+                entry.byte_size = value.as_unsigned();
+                break;
+            case Attribute::dw_at_encoding:
+                entry.encoding = static_cast<BaseTypeAttributeEncoding>(value.as_unsigned());
+                break;
+            case Attribute::dw_at_declaration:
+                entry.is_declaration = value.as_unsigned() != 0;
+                break;
+            case Attribute::dw_at_data_member_location:
+                if(value.form() == Form::dw_form_exprloc || !value.as_block().empty())
+                {   // a location description, usually DW_OP_plus_uconst
+                    auto const block = value.as_block();
+                    if(block.size() > 1 && std::bit_cast<uint8_t>(block[0]) == static_cast<uint8_t>(Operation::dw_op_plus_uconst)) {
+                        entry.value = static_cast<int64_t>(::details::uleb128<uint64_t>(block, 1).val);
+                    }
+                }
+                else {
+                    entry.value = value.as_signed();
+                }
+                break;
+            case Attribute::dw_at_const_value:
+            case Attribute::dw_at_count:
+                entry.value = value.as_signed();
+                break;
+            case Attribute::dw_at_lower_bound:
+                entry.lower_bound = value.as_unsigned();
+                break;
+            case Attribute::dw_at_upper_bound:
+                entry.upper_bound = value.as_unsigned();
+                entry.has_upper_bound = true;
+                break;
+            case Attribute::dw_at_bit_size:
+                entry.bit_size = static_cast<uint32_t>(value.as_unsigned());
+                break;
+            case Attribute::dw_at_data_bit_offset:
+                entry.bit_offset = static_cast<uint32_t>(value.as_unsigned());
+                entry.has_bit_offset = true;
+                break;
+            case Attribute::dw_at_reserved7:     // DW_AT_bit_offset of DWARF Version 2 and 3
+                entry.legacy_bit_offset = static_cast<uint32_t>(value.as_unsigned());
+                entry.has_legacy_bit_offset = true;
+                break;
+            default:
+                break;
+            }
+        });
+
+        if(entry.has_upper_bound) {
+            entry.value = static_cast<int64_t>(entry.upper_bound - entry.lower_bound + 1);
+        }
+
+        if(entry.bit_size > 0 && !entry.has_bit_offset) {
+            if(entry.has_legacy_bit_offset) 
+            {   // the legacy bit offset counts from the most significant bit of the storage unit
+                uint64_t const storage_bits = entry.byte_size * 8;
+                entry.bit_offset = static_cast<uint32_t>(entry.value * 8 + storage_bits - entry.legacy_bit_offset - entry.bit_size);
+            }
+            else {
+                entry.bit_offset = static_cast<uint32_t>(entry.value * 8);
+            }
+        }
+    }
+
+    constexpr auto
+    TypeGraph::resolve_offset(size_t const offset) -> TypeId
+    {
+        if(offset == 0) {
+            return invalid_type_id;
+        }
+
+        // the entries are sorted by their offset
+        size_t first = 0;
+        size_t last = entries_.size();
+        while(first < last) {
+            size_t const middle = first + (last - first) / 2;
+            if(entries_[middle].offset < offset) {
+                first = middle + 1;
+            }
+            else {
+                last = middle;
+            }
+        }
+
+        if(first < entries_.size() && entries_[first].offset == offset && is_type(entries_[first].tag)) {
+            return resolve(static_cast<uint32_t>(first));
+        }
+
+        // references into other units are looked up in the units added before
+        return type_of(offset);
+    }
+
+    constexpr auto
+    TypeGraph::resolve(uint32_t const index) -> TypeId
+    {
+        if(ids_[index] != unresolved) {
+            return ids_[index];
+        }
+        ids_[index] = invalid_type_id;  // breaks cycles which do not pass a class, structure or union
+
+        Entry const & entry = entries_[index];
+
+        TypeNode type = {};
+        type.tag = entry.tag;
+        type.name = entry.name;
+        type.encoding = entry.encoding;
+        type.is_declaration = entry.is_declaration;
+        type.byte_size = entry.byte_size;
+
+        if(entry.parent != no_entry) {
+            type.scope = resolve(entry.parent);
+        }
+
+        if(entry.is_scope_local || (entry.tag == Tag::dw_tag_namespace_ && entry.name.empty()))
+        {   // only visible inside of its unit
+            type.local_key = unit_->offset() + 1;
+        }
+
+        if(is_nominal(type) || entry.tag == Tag::dw_tag_structure_type || entry.tag == Tag::dw_tag_class_type 
+            || entry.tag == Tag::dw_tag_union_type)
+        {   // identified by the layout of its members before their types are resolved
+            std::vector<TypeMember> members = {};
+            if(entry.tag != Tag::dw_tag_namespace_) {
+                members = resolve_members(index, false);
+            }
+
+            uint64_t const hash_value = hash(type, members);
+
+            if(entry.tag == Tag::dw_tag_namespace_ || type.is_declaration) {
+                TypeId id = lookup(type, members, hash_value);
+                if(id == invalid_type_id) {
+                    id = insert(type, {}, hash_value);
+                }
+
+                ids_[index] = id;
+                return id;
+            }
+
+            TypeId const match = lookup_definition(type, members, hash_value, false);
+            if(match == invalid_type_id) 
+            {   // a new definition, or the definition of a declared type
+                TypeId id = lookup(type, members, hash_value);
+                if(id == invalid_type_id) {
+                    id = insert(type, {}, hash_value);
+                }
+
+                ids_[index] = id;
+
+                if(entry.type_offset != 0) {
+                    auto const underlying_type = resolve_offset(entry.type_offset);
+                    nodes_[id].type = underlying_type;
+                }
+
+                members = resolve_members(index, true);
+                nodes_[id].is_declaration = false;
+                nodes_[id].byte_size = type.byte_size;
+                nodes_[id].first_member = static_cast<uint32_t>(members_.size());
+                nodes_[id].member_count = static_cast<uint32_t>(members.size());
+                members_.insert(members_.end(), members.begin(), members.end());
+
+                return id;
+            }
+
+            // references to the type from its members point to the matching definition
+            ids_[index] = match;
+            type.type = resolve_offset(entry.type_offset);
+            members = resolve_members(index, true);
+
+            TypeId id = lookup_definition(type, members, hash_value, true);
+            if(id == invalid_type_id) {
+                id = insert(type, members, hash_value);
+            }
+
+            ids_[index] = id;
+            return id;
+        }
+
+        // identified by its attributes and the canonical types it references
+        type.type = resolve_offset(entry.type_offset);
+        auto const members = resolve_members(index, true);
+
+        uint64_t const hash_value = hash(type, members);
+        TypeId id = lookup(type, members, hash_value);
+        if(id == invalid_type_id) {
+            id = insert(type, members, hash_value);
+        }
+
+        ids_[index] = id;
+        return id;
+    }
+
+    constexpr auto
+    TypeGraph::resolve_members(uint32_t const index, bool const resolve_types) -> std::vector<TypeMember>
+    {
+        std::vector<TypeMember> res = {};
+
+        for(uint32_t child = entries_[index].first_child; child != no_entry; child = entries_[child].next_sibling) {
+            Entry const & entry = entries_[child];
+            if(!is_member(entry.tag) || entry.is_declaration) 
+            {   // nested types and static data members are not part of the layout
+                continue;
+            }
+
+            TypeMember member = {};
+            member.tag = entry.tag;
+            member.name = entry.name;
+            member.value = entry.value;
+            member.bit_size = entry.bit_size;
+            member.bit_offset = entry.bit_offset;
+            if(resolve_types) {
+                member.type = resolve_offset(entry.type_offset);
+            }
+
+            res.push_back(member);
+        }
+
+        return res;
+    }
+
+    constexpr auto
+    TypeGraph::hash(TypeNode const & type, std::span<TypeMember const> const members) const noexcept -> uint64_t
+    {
+        uint64_t res = details::hash_seed;
+        res = details::hash_combine(res, type.name);
+        res = details::hash_combine(res, type.scope);
+        res = details::hash_combine(res, type.local_key);
+
+        if(!type.name.empty())
+        {   // named types can be found by their name and scope
+            return res;
+        }
+
+        res = details::hash_combine(res, static_cast<uint64_t>(type.tag));
+        res = details::hash_combine(res, type.byte_size);
+        res = details::hash_combine(res, type.type);
+
+        for(auto const & member : members) {
+            res = details::hash_combine(res, member.name);
+            res = details::hash_combine(res, member.type);
+            res = details::hash_combine(res, static_cast<uint64_t>(member.value));
+        }
+
+        return res;
+    }
+
+    constexpr auto
+    TypeGraph::equal(TypeNode const & type, std::span<TypeMember const> const members, TypeId const id) const noexcept -> bool
+    {
+        TypeNode const & other = nodes_[id];
+
+        if(type.tag != other.tag || type.name != other.name || type.scope != other.scope || type.local_key != other.local_key) {
+            return false;
+        }
+
+        if(type.tag == Tag::dw_tag_namespace_ || (is_nominal(type) && (type.is_declaration || other.is_declaration))) 
+        {   // a declaration matches any definition of the same name
+            return true;
+        }
+
+        // the member types of aggregates and enumerations are compared after they are resolved
+        bool const is_aggregate = is_nominal(type) || type.tag == Tag::dw_tag_structure_type 
+                               || type.tag == Tag::dw_tag_class_type || type.tag == Tag::dw_tag_union_type;
+
+        if(type.byte_size != other.byte_size || type.encoding != other.encoding || type.is_declaration != other.is_declaration) {
+            return false;
+        }
+
+        if(!is_aggregate && type.type != other.type) {
+            return false;
+        }
+
+        auto const other_members = this->members(id);
+        if(members.size() != other_members.size()) {
+            return false;
+        }
+
+        for(size_t i = 0; i < members.size(); ++i) {
+            auto const & a = members[i];
+            auto const & b = other_members[i];
+
+            if(a.tag != b.tag || a.name != b.name || a.value != b.value || a.bit_size != b.bit_size || a.bit_offset != b.bit_offset) {
+                return false;
+            }
+
+            if(!is_aggregate && a.type != b.type) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr auto
+    TypeGraph::lookup(TypeNode const & type, std::span<TypeMember const> const members, uint64_t const hash_value) const noexcept -> TypeId
+    {
+        if(slots_.empty()) {
+            return invalid_type_id;
+        }
+
+        size_t const mask = slots_.size() - 1;
+        for(size_t i = hash_value & mask; slots_[i] != 0; i = (i + 1) & mask) {
+            TypeId const id = slots_[i] - 1;
+            if(hashes_[id] == hash_value && equal(type, members, id)) {
+                return id;
+            }
+        }
+
+        return invalid_type_id;
+    }
+
+    constexpr auto
+    TypeGraph::lookup_definition(TypeNode const & type, std::span<TypeMember const> const members, uint64_t const hash_value,
+        bool const compare_types) const noexcept -> TypeId
+    {
+        if(slots_.empty()) {
+            return invalid_type_id;
+        }
+
+        size_t const mask = slots_.size() - 1;
+        for(size_t i = hash_value & mask; slots_[i] != 0; i = (i + 1) & mask) {
+            TypeId const id = slots_[i] - 1;
+            if(hashes_[id] != hash_value || nodes_[id].is_declaration || !equal(type, members, id)) {
+                continue;
+            }
+
+            if(!compare_types) {
+                return id;
+            }
+
+            auto const other_members = this->members(id);
+            bool const is_same = type.type == nodes_[id].type && std::ranges::equal(members, other_members, {}, 
+                &TypeMember::type, &TypeMember::type);
+            if(is_same) {
+                return id;
+            }
+        }
+
+        return invalid_type_id;
+    }
+
+    constexpr auto
+    TypeGraph::insert(TypeNode const & type, std::span<TypeMember const> const members, uint64_t const hash_value) -> TypeId
+    {
+        if((nodes_.size() + 1) * 2 > slots_.size()) {
+            grow();
+        }
+
+        auto const id = static_cast<TypeId>(nodes_.size());
+
+        TypeNode node = type;
+        node.first_member = static_cast<uint32_t>(members_.size());
+        node.member_count = static_cast<uint32_t>(members.size());
+        members_.insert(members_.end(), members.begin(), members.end());
+        nodes_.push_back(node);
+        hashes_.push_back(hash_value);
+
+        size_t const mask = slots_.size() - 1;
+        size_t i = hash_value & mask;
+        while(slots_[i] != 0) {
+            i = (i + 1) & mask;
+        }
+        slots_[i] = id + 1;
+
+        return id;
+    }
+
+    constexpr auto
+    TypeGraph::grow() -> void
+    {
+        size_t const size = slots_.empty() ? 64 : slots_.size() * 2;
+        slots_.assign(size, 0);
+
+        size_t const mask = size - 1;
+        for(TypeId id = 0; id < nodes_.size(); ++id) {
+            size_t i = hashes_[id] & mask;
+            while(slots_[i] != 0) {
+                i = (i + 1) & mask;
+            }
+            slots_[i] = id + 1;
+        }
+    }
+
+    constexpr auto
+    TypeGraph::type_of(size_t const offset) const noexcept -> TypeId
+    {
+        size_t first = 0;
+        size_t last = offsets_.size();
+        while(first < last) {
+            size_t const middle = first + (last - first) / 2;
+            if(offsets_[middle].first < offset) {
+                first = middle + 1;
+            }
+            else {
+                last = middle;
+            }
+        }
+
+        if(first < offsets_.size() && offsets_[first].first == offset) {
+            return offsets_[first].second;
+        }
+
+        return invalid_type_id;
+    }
+
+    constexpr auto
+    TypeGraph::find(std::string_view const qualified_name) const noexcept -> TypeId
+    {
+        TypeId scope = invalid_type_id;
+        std::string_view rest = qualified_name;
+
+        while(!rest.empty()) {
+            size_t const separator = rest.find("::");
+            std::string_view const name = rest.substr(0, separator);
+            rest = separator == std::string_view::npos ? std::string_view() : rest.substr(separator + 2);
+
+            TypeNode key = {};
+            key.name = name;
+            key.scope = scope;
+            uint64_t const hash_value = hash(key, {});
+
+            if(slots_.empty()) {
+                return invalid_type_id;
+            }
+
+            // prefer definitions over declarations
+            TypeId found = invalid_type_id;
+            size_t const mask = slots_.size() - 1;
+            for(size_t i = hash_value & mask; slots_[i] != 0; i = (i + 1) & mask) {
+                TypeId const id = slots_[i] - 1;
+                auto const & type = nodes_[id];
+                if(hashes_[id] == hash_value && type.name == name && type.scope == scope && type.local_key == 0) {
+                    if(found == invalid_type_id || nodes_[found].is_declaration) {
+                        found = id;
+                    }
+                }
+            }
+
+            if(found == invalid_type_id) {
+                return invalid_type_id;
+            }
+
+            scope = found;
+        }
+
+        return scope;
+    }
+
+    constexpr auto
+    TypeGraph::qualified_name(TypeId const id) const -> std::string
+    {
+        if(id >= nodes_.size()) {
+            return std::string();
+        }
+
+        auto const & type = nodes_[id];
+        if(type.scope == invalid_type_id) {
+            return std::string(type.name);
+        }
+
+        return qualified_name(type.scope) + "::" + std::string(type.name);
+    }
+
+    constexpr auto
+    TypeGraph::statistics() const noexcept -> TypeGraphStatistics
+    {
+        TypeGraphStatistics res = {};
+        res.units = units_;
+        res.type_entries = type_entries_;
+        res.member_entries = member_entries_;
+        res.types = nodes_.size();
+        res.members = members_.size();
+        res.per_unit_bytes = type_entries_ * sizeof(TypeNode) + member_entries_ * sizeof(TypeMember);
+        res.bytes = nodes_.size() * (sizeof(TypeNode) + sizeof(uint64_t)) + members_.size() * sizeof(TypeMember)
+                  + slots_.size() * sizeof(TypeId);
+
+        return res;
+    }
+}
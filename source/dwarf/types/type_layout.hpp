@@ -0,0 +1,470 @@
+///
+/// @file:   type_layout.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  The flattened memory layout of a type
+///
+
+#pragma once
+
+#include "dwarf/types/type_graph.hpp"
+#include <limits>
+#include <string>
+
+namespace dwarf
+{
+    namespace details
+    {
+        [[nodiscard]] constexpr auto
+        to_decimal_string(uint64_t value) -> std::string
+        {
+            std::string res = {};
+            do {
+                res.insert(res.begin(), static_cast<char>('0' + value % 10));
+                value /= 10;
+            } while(value != 0);
+            return res;
+        }
+    }
+
+    /// @class dwarf::LayoutLeaf
+    ///
+    /// @brief A scalar in the memory layout of a type, e.g. a base type, an enumeration or a pointer
+    /// @details The scalars of an array are one leaf, repeated count times at a distance of stride bytes
+    ///
+    struct LayoutLeaf final
+    {
+        /// @brief The path of the scalar within the type, arrays with their number of elements,
+        ///     e.g. base.values[4].x, see element_path() for the path of one element
+        std::string path = {};
+        /// @brief The offset of the first byte of the scalar in the first element from the beginning of the type
+        uint64_t offset = 0;
+        /// @brief The number of elements of the arrays containing the scalar, 1 if it is not in an array
+        uint64_t count = 1;
+        /// @brief The distance of two elements in bytes
+        uint64_t stride = 0;
+        /// @brief The number of arrays at the end of the path the elements are counted over
+        uint32_t dimensions = 0;
+        /// @brief The number of bytes which must be read to extract the scalar
+        uint64_t byte_size = 0;
+        /// @brief The offset of the least significant bit of a bit field in the bytes read
+        uint32_t bit_offset = 0;
+        /// @brief The number of bits of a bit field, 0 if the scalar is not a bit field
+        uint32_t bit_size = 0;
+        /// @brief How the value of the scalar is interpreted
+        BaseTypeAttributeEncoding encoding = {};
+        /// @brief The type of the scalar
+        TypeId type = invalid_type_id;
+
+        [[nodiscard]] constexpr auto
+        is_signed() const noexcept -> bool
+        {
+            return encoding == BaseTypeAttributeEncoding::dw_ate_signed_
+                || encoding == BaseTypeAttributeEncoding::dw_ate_signed_char
+                || encoding == BaseTypeAttributeEncoding::dw_ate_signed_fixed;
+        }
+
+        ///
+        /// @brief Returns the path of one element, e.g. base.values[2].x
+        /// @param index the index of the element, counted in row major order over all dimensions
+        ///
+        [[nodiscard]] constexpr auto
+        element_path(uint64_t index) const -> std::string
+        {
+            std::string res = path;
+            size_t end = res.size();
+            for(uint32_t i = 0; i < dimensions; ++i) {
+                size_t const open = res.rfind('[', end);
+                size_t const close = res.find(']', open);
+                if(open == std::string::npos || close == std::string::npos) [[unlikely]] {
+                    break;
+                }
+
+                uint64_t extent = 0;
+                for(size_t j = open + 1; j < close; ++j) {
+                    extent = extent * 10 + static_cast<uint64_t>(res[j] - '0');
+                }
+                extent = std::max<uint64_t>(extent, 1);
+
+                res.replace(open + 1, close - open - 1, details::to_decimal_string(index % extent));
+                index /= extent;
+                if(open == 0) {
+                    break;
+                }
+                end = open - 1;
+            }
+
+            return res;
+        }
+
+        ///
+        /// @brief Extracts the raw bits of the scalar from an instance of the type in little endian byte order
+        /// @param object the memory of the instance of the type
+        /// @param index the element of the arrays containing the scalar
+        /// @return the bits of the scalar, signed scalars are sign extended
+        ///
+        [[nodiscard]] constexpr auto
+        extract(std::span<char const> const object, uint64_t const index = 0) const noexcept -> uint64_t
+        {
+            if(index >= count || byte_size > sizeof(uint64_t)) [[unlikely]] {
+                return 0;
+            }
+
+            uint64_t const first = offset + index * stride;
+            if(first > object.size() || byte_size > object.size() - first) [[unlikely]] {
+                return 0;
+            }
+
+            uint64_t res = 0;
+            for(size_t i = 0; i < byte_size; ++i) {
+                res |= static_cast<uint64_t>(std::bit_cast<uint8_t>(object[first + i])) << (i * 8);
+            }
+
+            uint32_t const bits = bit_size > 0 ? bit_size : static_cast<uint32_t>(byte_size * 8);
+            res >>= bit_offset;
+            if(bits < 64) {
+                res &= (uint64_t(1) << bits) - 1;
+                if(is_signed() && (res >> (bits - 1)) != 0) {
+                    res |= ~((uint64_t(1) << bits) - 1);
+                }
+            }
+
+            return res;
+        }
+    };
+
+    /// @class dwarf::TypeLayouts
+    ///
+    /// @brief Computes the flattened memory layouts of the types of a type graph
+    /// @details A layout lists every scalar of a type with its path, offset, size and encoding.
+    ///     Data members, base classes and bit fields are flattened, the scalars of an array are one
+    ///     leaf with a count and a stride. An array of elements whose own arrays are not contiguous
+    ///     in the element gets one leaf per element for them. Arrays with more elements than fit
+    ///     into 64 bits have no leaves. Typedefs and qualifiers are looked through.
+    ///     Unions list all alternatives at the same offset.
+    ///     Each layout is computed once and the layouts of members are reused, so that
+    ///     decoding many instances of a type is a loop over a contiguous list of leaves.
+    ///
+    class TypeLayouts final
+    {
+    public:
+
+        ///
+        /// @brief constructor
+        /// @param type_graph the types, must outlive the layouts
+        ///
+        explicit constexpr TypeLayouts(TypeGraph const & type_graph) noexcept
+            : type_graph_(&type_graph) {}
+
+        ///
+        /// @brief Returns the flattened layout of a type
+        /// @details The leaves are valid until the layout of another type is computed
+        /// @param id the type
+        ///
+        [[nodiscard]] constexpr auto
+        layout(TypeId const id) -> std::span<LayoutLeaf const>
+        {
+            if(id >= type_graph_->size()) {
+                return {};
+            }
+
+            auto const range = compute(id);
+            return std::span<LayoutLeaf const>(leaves_).subspan(range.first, range.count);
+        }
+
+        ///
+        /// @brief Returns the flattened layout of a named type
+        /// @param qualified_name the name of the type, e.g. std::size_t
+        ///
+        [[nodiscard]] constexpr auto
+        layout(std::string_view const qualified_name) -> std::span<LayoutLeaf const>
+        {
+            return layout(type_graph_->find(qualified_name));
+        }
+
+        ///
+        /// @brief Returns the size of a type in bytes, typedefs and qualifiers are looked through
+        ///
+        [[nodiscard]] constexpr auto
+        byte_size(TypeId const id) const noexcept -> uint64_t;
+
+    private:
+        struct Range final
+        {
+            uint32_t first = 0;
+            uint32_t count = 0;
+            bool is_computed = false;
+            bool is_in_progress = false;
+        };
+
+        constexpr auto
+        compute(TypeId const id) -> Range;
+
+        constexpr auto
+        append(std::vector<LayoutLeaf> & leaves, TypeId const id, std::string const & path, uint64_t const offset) -> void;
+
+        [[nodiscard]] constexpr auto
+        strip(TypeId id) const noexcept -> TypeId;
+
+        [[nodiscard]] constexpr auto
+        encoding(TypeId const id) const noexcept -> BaseTypeAttributeEncoding;
+
+        TypeGraph const * type_graph_ = nullptr;
+        std::vector<Range> ranges_ = {};
+        std::vector<LayoutLeaf> leaves_ = {};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Implementation
+
+    constexpr auto
+    TypeLayouts::strip(TypeId id) const noexcept -> TypeId
+    {
+        while(id < type_graph_->size()) {
+            switch (type_graph_->node(id).tag)
+            {
+            case Tag::dw_tag_typedef_:
+            case Tag::dw_tag_const_type:
+            case Tag::dw_tag_volatile_type:
+            case Tag::dw_tag_restrict_type:
+            case Tag::dw_tag_atomic_type:
+                id = type_graph_->node(id).type;
+                break;
+            default:
+                return id;
+            }
+        }
+
+        return invalid_type_id;
+    }
+
+    constexpr auto
+    TypeLayouts::encoding(TypeId const id) const noexcept -> BaseTypeAttributeEncoding
+    {
+        TypeId const type = strip(id);
+        if(type == invalid_type_id) {
+            return BaseTypeAttributeEncoding::dw_ate_unsigned_;
+        }
+
+        auto const & node = type_graph_->node(type);
+        switch (node.tag)
+        {
+        case Tag::dw_tag_base_type:
+            return node.encoding;
+        case Tag::dw_tag_enumeration_type:
+            return node.type != invalid_type_id ? encoding(node.type) : BaseTypeAttributeEncoding::dw_ate_unsigned_;
+        case Tag::dw_tag_pointer_type:
+        case Tag::dw_tag_reference_type:
+        case Tag::dw_tag_rvalue_reference_type:
+        case Tag::dw_tag_ptr_to_member_type:
+            return BaseTypeAttributeEncoding::dw_ate_address;
+        default:
+            return BaseTypeAttributeEncoding::dw_ate_unsigned_;
+        }
+    }
+
+    constexpr auto
+    TypeLayouts::byte_size(TypeId const id) const noexcept -> uint64_t
+    {
+        TypeId const type = strip(id);
+        if(type == invalid_type_id) {
+            return 0;
+        }
+
+        auto const & node = type_graph_->node(type);
+        if(node.byte_size != 0 || node.tag != Tag::dw_tag_array_type) {
+            return node.byte_size;
+        }
+
+        uint64_t res = byte_size(node.type);
+        for(auto const & dimension : type_graph_->members(type)) {
+            auto const extent = static_cast<uint64_t>(std::max<int64_t>(dimension.value, 0));
+            if(extent != 0 && res > std::numeric_limits<uint64_t>::max() / extent) [[unlikely]] {
+                return 0;
+            }
+            res *= extent;
+        }
+
+        return res;
+    }
+
+    constexpr auto
+    TypeLayouts::compute(TypeId const id) -> Range
+    {
+        if(ranges_.size() < type_graph_->size()) {
+            ranges_.resize(type_graph_->size());
+        }
+
+        if(ranges_[id].is_computed || ranges_[id].is_in_progress)
+        {   // a type containing itself can only be incomplete
+            return ranges_[id];
+        }
+
+        ranges_[id].is_in_progress = true;
+
+        std::vector<LayoutLeaf> leaves = {};
+        append(leaves, id, std::string(), 0);
+
+        Range & range = ranges_[id];
+        range.first = static_cast<uint32_t>(leaves_.size());
+        range.count = static_cast<uint32_t>(leaves.size());
+        range.is_computed = true;
+        range.is_in_progress = false;
+
+        leaves_.insert(leaves_.end(), std::make_move_iterator(leaves.begin()), std::make_move_iterator(leaves.end()));
+        return range;
+    }
+
+    constexpr auto
+    TypeLayouts::append(std::vector<LayoutLeaf> & leaves, TypeId const id, std::string const & path, uint64_t const offset) -> void
+    {
+        TypeId const type = strip(id);
+        if(type == invalid_type_id) {
+            return;
+        }
+
+        auto const & node = type_graph_->node(type);
+
+        switch (node.tag)
+        {
+        case Tag::dw_tag_base_type:
+        case Tag::dw_tag_enumeration_type:
+        case Tag::dw_tag_pointer_type:
+        case Tag::dw_tag_reference_type:
+        case Tag::dw_tag_rvalue_reference_type:
+        case Tag::dw_tag_ptr_to_member_type:
+        {
+            LayoutLeaf leaf = {};
+            leaf.path = path;
+            leaf.offset = offset;
+            leaf.byte_size = node.byte_size;
+            leaf.type = type;
+            leaf.encoding = encoding(type);
+
+            if(leaf.byte_size == 0 && leaf.encoding == BaseTypeAttributeEncoding::dw_ate_address) {
+                leaf.byte_size = sizeof(uint64_t);
+            }
+
+            leaves.push_back(std::move(leaf));
+            return;
+        }
+        case Tag::dw_tag_structure_type:
+        case Tag::dw_tag_class_type:
+        case Tag::dw_tag_union_type:
+        {   // the layouts of the members are computed once and copied
+            for(auto const & member : type_graph_->members(type)) {
+                bool const is_base_class = member.tag == Tag::dw_tag_inheritance;
+                if(member.tag != Tag::dw_tag_member && !is_base_class) {
+                    continue;
+                }
+
+                std::string member_path = path;
+                std::string_view const name = is_base_class ? type_graph_->node(strip(member.type)).name : member.name;
+                if(!name.empty()) {
+                    if(!member_path.empty()) {
+                        member_path += '.';
+                    }
+                    member_path += name;
+                }
+
+                if(member.bit_size > 0) {
+                    LayoutLeaf leaf = {};
+                    leaf.path = std::move(member_path);
+                    leaf.offset = offset + member.bit_offset / 8;
+                    leaf.bit_offset = member.bit_offset % 8;
+                    leaf.bit_size = member.bit_size;
+                    leaf.byte_size = (leaf.bit_offset + leaf.bit_size + 7) / 8;
+                    leaf.type = strip(member.type);
+
+                    leaf.encoding = encoding(leaf.type);
+
+                    leaves.push_back(std::move(leaf));
+                    continue;
+                }
+
+                TypeId const member_type = strip(member.type);
+                if(member_type == invalid_type_id) {
+                    continue;
+                }
+
+                auto const range = compute(member_type);
+                for(uint32_t i = 0; i < range.count; ++i) {
+                    LayoutLeaf leaf = leaves_[range.first + i];
+                    leaf.offset += offset + static_cast<uint64_t>(member.value);
+                    if(!member_path.empty() && !leaf.path.empty() && leaf.path.front() != '[') {
+                        leaf.path = member_path + '.' + leaf.path;
+                    }
+                    else {
+                        leaf.path = member_path + leaf.path;
+                    }
+                    leaves.push_back(std::move(leaf));
+                }
+            }
+            return;
+        }
+        case Tag::dw_tag_array_type:
+        {   // the elements of all dimensions in row major order
+            auto const dimensions = type_graph_->members(type);
+            TypeId const element_type = strip(node.type);
+            uint64_t const element_size = byte_size(element_type);
+            if(dimensions.empty() || element_type == invalid_type_id) {
+                return;
+            }
+
+            uint64_t count = 1;
+            std::string extents = {};
+            for(auto const & dimension : dimensions) {
+                auto const extent = static_cast<uint64_t>(std::max<int64_t>(dimension.value, 0));
+                if(extent != 0 && count > std::numeric_limits<uint64_t>::max() / extent) [[unlikely]] 
+                {   // more elements than can be counted
+                    return;
+                }
+                count *= extent;
+                extents += '[' + details::to_decimal_string(extent) + ']';
+            }
+
+            if(count == 0 || (element_size != 0 && count > std::numeric_limits<uint64_t>::max() / element_size)) {
+                return;
+            }
+
+            auto const join = [](std::string const & array_path, std::string const & element_path) {
+                if(!element_path.empty() && element_path.front() != '[') {
+                    return array_path + '.' + element_path;
+                }
+                return array_path + element_path;
+            };
+
+            auto const range = compute(element_type);
+            for(uint32_t i = 0; i < range.count; ++i) {
+                LayoutLeaf leaf = leaves_[range.first + i];
+                bool const is_contiguous = leaf.count == 1 || leaf.count * leaf.stride == element_size;
+                if(is_contiguous && leaf.count <= std::numeric_limits<uint64_t>::max() / count) 
+                {   // the elements of the array and of the arrays in an element are one sequence
+                    leaf.path = join(path + extents, leaf.path);
+                    leaf.offset += offset;
+                    leaf.stride = leaf.count == 1 ? element_size : leaf.stride;
+                    leaf.count *= count;
+                    leaf.dimensions += static_cast<uint32_t>(dimensions.size());
+                    leaves.push_back(std::move(leaf));
+                    continue;
+                }
+
+                // the arrays of an element are repeated for each element
+                for(uint64_t index = 0; index < count; ++index) {
+                    LayoutLeaf element_leaf = leaf;
+                    LayoutLeaf position = {};
+                    position.path = path + extents;
+                    position.count = count;
+                    position.dimensions = static_cast<uint32_t>(dimensions.size());
+                    element_leaf.path = join(position.element_path(index), leaf.path);
+                    element_leaf.offset += offset + index * element_size;
+                    leaves.push_back(std::move(element_leaf));
+                }
+            }
+            return;
+        }
+        default:
+            return;
+        }
+    }
+}
@@ -2,80 +2,155 @@
 // @file:   main.cpp
 // @author: GrandChris
 // @date:   2021-11-12
-// @brief:  Program entry point
+// @brief:  Program entry point of dwarf_dump, which prints the debug information of a binary
+//          file in the layout of objdump
 //
+// Usage: dwarf_dump [-h] [--dwarf=info,abbrev] [--threads=N] [--stats] <file>
+//
+//   -h, --section-headers  print the section table like objdump -h
+//   --dwarf=info           print the units and entries of .debug_info (the default)
+//   --dwarf=abbrev         print the abbreviation tables of .debug_abbrev
+//   --threads=N            format the units with N threads, the default is the number of cores
+//   --stats                print the counters of the reader to stderr, needs DWARF_READER_STATISTICS
+//
+
+#include "dwarf/dump/dwarf_dump.hpp"
+#include "dwarf/mapped_file.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string_view>
+#include <thread>
+
+
+namespace
+{
+    struct Options final
+    {
+        std::string_view file_name = {};
+        bool is_sections = false;
+        bool is_info = false;
+        bool is_abbrev = false;
+        size_t threads = 0;
+        bool is_stats = false;
+    };
+
+    [[nodiscard]] auto
+    parse_options(int const argc, char const * const * const argv, Options & options) -> bool
+    {
+        for(int i = 1; i < argc; ++i) {
+            std::string_view const argument(argv[i]);
+
+            if(argument == "-h" || argument == "--section-headers") {
+                options.is_sections = true;
+            }
+            else if(argument.starts_with("--dwarf=")) {
+                std::string_view list = argument.substr(8);
+                while(!list.empty()) {
+                    auto const end = std::min(list.find(','), list.size());
+                    auto const name = list.substr(0, end);
+                    if(name == "info") {
+                        options.is_info = true;
+                    }
+                    else if(name == "abbrev") {
+                        options.is_abbrev = true;
+                    }
+                    else {
+                        return false;
+                    }
+                    list.remove_prefix(std::min(end + 1, list.size()));
+                }
+            }
+            else if(argument.starts_with("--threads=")) {
+                options.threads = std::strtoul(argv[i] + 10, nullptr, 10);
+            }
+            else if(argument == "--stats") {
+                options.is_stats = true;
+            }
+            else if(argument.starts_with('-') || !options.file_name.empty()) {
+                return false;
+            }
+            else {
+                options.file_name = argument;
+            }
+        }
+
+        if(!options.is_sections && !options.is_info && !options.is_abbrev) {
+            options.is_info = true;
+        }
+        if(options.threads == 0) {
+            options.threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        return !options.file_name.empty();
+    }
+
+    auto
+    print_statistics(dwarf::ReaderStatistics const & statistics) -> void
+    {
+        if(!dwarf::has_reader_statistics) {
+            std::fprintf(stderr, "statistics: not compiled in, configure with -DDWARF_READER_STATISTICS=ON\n");
+            return;
+        }
+
+        std::fprintf(stderr, "statistics:\n");
+        for(size_t i = 0; i < statistics.counters.size(); ++i) {
+            std::fprintf(stderr, "  %-20.*s %" PRIu64 "\n", static_cast<int>(dwarf::reader_counter_names[i].size()),
+                dwarf::reader_counter_names[i].data(), statistics.counters[i]);
+        }
+        std::fprintf(stderr, "  %-20s %.2f\n", "leb128_average_length", statistics.leb128_average_length());
+
+        for(size_t i = 0; i < statistics.stage_calls.size(); ++i) {
+            auto const stage = static_cast<dwarf::ReaderStage>(i);
+            std::fprintf(stderr, "  %-20.*s %.6f s in %" PRIu64 " calls\n", static_cast<int>(dwarf::reader_stage_names[i].size()),
+                dwarf::reader_stage_names[i].data(), statistics.stage_seconds(stage), statistics.stage_calls[i]);
+        }
+    }
+}
 
-// #include "sml/sml.h"
-// #include "sml/transition.h"
-
-#include <iostream>
-// #include "pei/dwarf_reader_exe.h"
-
-
-using namespace std;
-
-
-// auto
-// print_pei()
-// {
-//     constexpr std::span<uint8_t const> data(dwarf_reader_exe);
-//     constexpr pei::PeiFile file = pei::get_pei_file(data);
-
-//     cout << file.dos_header.lfanew << endl;
-
-//     cout << "### File Header" << endl;
-//     cout << "machine: " << file.file_header.machine << endl;
-//     cout << "number_of_sections: " << file.file_header.number_of_sections << endl;
-//     cout << "time_date_stamp: " << file.file_header.time_date_stamp << endl;
-//     cout << "pointer_to_symbol_table: " << file.file_header.pointer_to_symbol_table << endl;
-//     cout << "number_of_symbols: " << file.file_header.number_of_symbols << endl;
-//     cout << "size_of_optional_header: " << file.file_header.size_of_optional_header << endl;
-//     cout << "characteristics: " << file.file_header.characteristics << endl;
-//     cout << endl;
-
-//     cout << "### Optional Header" << endl;
-//     cout << "magic: " << file.optional_header.magic << endl;
-//     cout << "major_linker_version: " << static_cast<uint32_t>(file.optional_header.major_linker_version) << endl;
-//     cout << "minor_linker_version: " << file.optional_header.minor_linker_version << endl;
-//     cout << "size_of_code: " << file.optional_header.size_of_code << endl;
-//     cout << "size_of_initialized_data: " << file.optional_header.size_of_initialized_data << endl;
-//     cout << "size_of_uninitialized_data: " << file.optional_header.size_of_uninitialized_data << endl;
-//     cout << "address_of_entry_point: " << file.optional_header.address_of_entry_point << endl;
-//     cout << "base_of_code: " << file.optional_header.base_of_code << endl;
-//     cout << "base_of_data: " << file.optional_header.base_of_data << endl;
-//     cout << endl;
-
-//     cout << "image_base: " << file.optional_header.image_base << endl;
-//     cout << "section_alignment: " << file.optional_header.section_alignment << endl;
-//     cout << "file_alignment: " << file.optional_header.file_alignment << endl;
-//     cout << "major_operating_system_version: " << file.optional_header.major_operating_system_version << endl;
-//     cout << "minor_operating_system_version: " << file.optional_header.minor_operating_system_version << endl;
-//     cout << "major_image_version: " << file.optional_header.major_image_version << endl;
-//     cout << "minor_image_version: " << file.optional_header.minor_image_version << endl;
-//     cout << "major_subsystem_version: " << file.optional_header.major_subsystem_version << endl;
-//     cout << "minor_subsystem_version: " << file.optional_header.minor_subsystem_version << endl;
-//     cout << "reserved1: " << file.optional_header.reserved1 << endl;
-//     cout << "size_of_image: " << file.optional_header.size_of_image << endl;
-//     cout << "size_of_headers: " << file.optional_header.size_of_headers << endl;
-//     cout << "check_sum: " << file.optional_header.check_sum << endl;
-//     cout << "subsystem: " << file.optional_header.subsystem << endl;
-//     cout << "dll_characteristics: " << file.optional_header.dll_characteristics << endl;
-//     cout << "size_of_stack_reserve: " << file.optional_header.size_of_stack_reserve << endl;
-//     cout << "size_of_stack_commit: " << file.optional_header.size_of_stack_commit << endl;
-//     cout << "size_of_heap_reserve: " << file.optional_header.size_of_heap_reserve << endl;
-//     cout << "size_of_heap_commit: " << file.optional_header.size_of_heap_commit << endl;
-//     cout << "loader_flags: " << file.optional_header.loader_flags << endl;
-//     cout << "number_of_rva_and_sizes: " << file.optional_header.number_of_rva_and_sizes << endl;
-//     cout << endl;
-// }
 
 auto
-main() -> int 
+main(int argc, char * argv[]) -> int
 {
-    cout << "Hello World!" << endl;
+    Options options;
+    if(!parse_options(argc, argv, options)) {
+        std::fprintf(stderr, "usage: %s [-h] [--dwarf=info,abbrev] [--threads=N] [--stats] <file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    dwarf::MappedFile const file(options.file_name);
+    if(!file.is_open()) {
+        std::fprintf(stderr, "%s: '%.*s': No such file\n", argv[0], static_cast<int>(options.file_name.size()), options.file_name.data());
+        return EXIT_FAILURE;
+    }
 
-    // print_pei();
+    try {
+        auto const data = file.data();
+        auto const sections = dwarf::get_debug_sections(data);
+        dwarf::BufferedWriter writer(stdout);
 
-    return 0;
-} 
+        dwarf::dump_file_header(writer, options.file_name, data);
+        if(options.is_sections) {
+            dwarf::dump_sections(writer, data);
+        }
+        if(options.is_info) {
+            dwarf::dump_debug_info(writer, sections, options.threads);
+        }
+        if(options.is_abbrev) {
+            dwarf::dump_abbrev(writer, sections.debug_abbrev);
+        }
+        if(options.is_stats) {
+            writer.flush();
+            print_statistics(dwarf::reader_statistics());
+        }
+    }
+    catch(std::exception const & e) {
+        std::fflush(stdout);
+        std::fprintf(stderr, "%s: %s\n", argv[0], e.what());
+        return EXIT_FAILURE;
+    }
 
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,275 @@
+///
+/// @file:   debug_directory.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Portable Executable File Formant, the debug directory and the identity of a build
+/// @details: https://docs.microsoft.com/en-us/windows/win32/debug/pe-format#debug-directory-image-only
+///
+
+#pragma once
+
+#include "section_ranges.hpp"
+#include <array>
+
+namespace pei
+{
+    /// @brief The type of the debug information an entry of the debug directory refers to
+    enum class DebugType : uint32_t
+    {
+        unknown = 0,
+        coff = 1,
+        /// @brief The location of a PDB file, also written by GNU ld with --build-id
+        codeview = 2,
+        fpo = 3,
+        misc = 4,
+        exception = 5,
+        fixup = 6,
+        omap_to_src = 7,
+        omap_from_src = 8,
+        borland = 9,
+        clsid = 11,
+        vc_feature = 12,
+        pogo = 13,
+        iltcg = 14,
+        mpx = 15,
+        /// @brief A deterministic build, the time stamps of the image are a hash of its contents
+        repro = 16,
+        ex_dllcharacteristics = 20
+    };
+
+    /// @class pei::DebugEntry
+    ///
+    /// @brief An entry of the debug directory
+    /// @details The data points into the data of the image
+    ///
+    struct DebugEntry final
+    {
+        uint32_t characteristics = 0;
+        uint32_t time_date_stamp = 0;
+        uint16_t major_version = 0;
+        uint16_t minor_version = 0;
+        DebugType type = DebugType::unknown;
+        /// @brief The debug data, empty if it is not in the file
+        std::span<char const> data = {};
+    };
+
+    /// @class pei::CodeView
+    ///
+    /// @brief A CodeView RSDS record, which identifies the PDB file or the build of an image
+    /// @details The PDB file of an image matches if its GUID and age are equal.
+    ///
+    struct CodeView final
+    {
+        std::array<uint8_t, 16> guid = {};
+        uint32_t age = 0;
+        /// @brief Empty if the linker wrote no PDB file, e.g. GNU ld with --build-id
+        std::string_view pdb_path = {};
+    };
+
+    /// @brief The information an image key is derived from, from the most to the least reliable
+    enum class ImageKeySource : uint8_t
+    {
+        none,
+        codeview,
+        repro,
+        /// @brief The time stamp, the size of the image and the checksum, as a symbol server does
+        header
+    };
+
+    /// @class pei::ImageKey
+    ///
+    /// @brief A 128 bit identity of the build of an image, to validate a cached index of the image
+    ///     without hashing the whole file
+    /// @details Only a key from a CodeView record or a repro entry identifies the contents, the time stamp
+    ///     of the header is the same for a file rebuilt within a second or by a deterministic linker.
+    ///
+    struct ImageKey final
+    {
+        uint64_t high = 0;
+        uint64_t low = 0;
+        ImageKeySource source = ImageKeySource::none;
+
+        [[nodiscard]] constexpr auto
+        is_valid() const noexcept -> bool
+        {
+            return source != ImageKeySource::none;
+        }
+
+        ///
+        /// @brief Returns true if the key changes with the contents of the image
+        ///
+        [[nodiscard]] constexpr auto
+        is_stable() const noexcept -> bool
+        {
+            return source == ImageKeySource::codeview || source == ImageKeySource::repro;
+        }
+
+        [[nodiscard]] constexpr auto
+        operator==(ImageKey const &) const noexcept -> bool = default;
+    };
+
+    /// @class pei::DebugDirectory
+    ///
+    /// @brief The entries of the debug directory, each referring to debug information of a type
+    /// @details The debug data is read at its file offset, which is also valid for data that is not
+    ///     mapped into memory, otherwise at its RVA. An image whose optional header is not inside the
+    ///     data has no entries.
+    ///
+    class DebugDirectory final
+    {
+    public:
+        struct DataStructure final
+        {
+            /// @brief Reserved, must be zero.
+            uint32_t characteristics;
+            /// @brief The time and date that the debug data was created.
+            uint32_t time_date_stamp;
+            uint16_t major_version;
+            uint16_t minor_version;
+            /// @brief The format of debugging information.
+            uint32_t type;
+            /// @brief The size of the debug data, not including the debug directory itself.
+            uint32_t size_of_data;
+            /// @brief The address of the debug data when loaded, relative to the image base.
+            uint32_t address_of_raw_data;
+            /// @brief The file pointer to the debug data.
+            uint32_t pointer_to_raw_data;
+        };
+        static_assert(std::is_standard_layout_v<DataStructure>);
+
+        ///
+        /// @brief constructor
+        /// @param data the complete data of a binary .exe or .dll file
+        ///
+        constexpr explicit DebugDirectory(std::span<char const> const data)
+            : data_(data),
+              ranges_(data),
+              directory_(OptionalHeader(data).data_directory(DirectoryEntry::debug)),
+              table_(directory_.virtual_address != 0 ? ranges_.data(directory_.virtual_address, directory_.size)
+                  : std::span<char const>())
+        {
+        }
+
+        ///
+        /// @brief Returns the number of entries
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_t
+        {
+            return table_.size() / sizeof(DataStructure);
+        }
+
+        ///
+        /// @brief Returns an entry
+        /// @param index less than size()
+        ///
+        [[nodiscard]] constexpr auto
+        entry(size_t const index) const noexcept -> DebugEntry
+        {
+            if(index >= size()) {
+                return {};
+            }
+
+            size_t const base = index * sizeof(DataStructure);
+            DebugEntry res = {};
+            res.characteristics = details::bit_cast<uint32_t>(table_, base + offsetof(DataStructure, characteristics));
+            res.time_date_stamp = details::bit_cast<uint32_t>(table_, base + offsetof(DataStructure, time_date_stamp));
+            res.major_version = details::bit_cast<uint16_t>(table_, base + offsetof(DataStructure, major_version));
+            res.minor_version = details::bit_cast<uint16_t>(table_, base + offsetof(DataStructure, minor_version));
+            res.type = static_cast<DebugType>(details::bit_cast<uint32_t>(table_, base + offsetof(DataStructure, type)));
+
+            auto const size_of_data = details::bit_cast<uint32_t>(table_, base + offsetof(DataStructure, size_of_data));
+            auto const pointer = details::bit_cast<uint32_t>(table_, base + offsetof(DataStructure, pointer_to_raw_data));
+            if(pointer != 0 && pointer < data_.size() && size_of_data <= data_.size() - pointer) {
+                res.data = data_.subspan(pointer, size_of_data);
+            }
+            else {
+                auto const rva = details::bit_cast<uint32_t>(table_, base + offsetof(DataStructure, address_of_raw_data));
+                auto const data = rva != 0 ? ranges_.data(rva, size_of_data) : std::span<char const>();
+                res.data = data.size() == size_of_data ? data : std::span<char const>();
+            }
+            return res;
+        }
+
+        ///
+        /// @brief Returns the first CodeView RSDS record
+        /// @return std::nullopt if the image has no such record
+        ///
+        [[nodiscard]] constexpr auto
+        codeview() const noexcept -> std::optional<CodeView>
+        {
+            // signature, GUID, age
+            size_t const header_size = 4 + 16 + 4;
+            for(size_t i = 0; i < size(); ++i) {
+                auto const record = entry(i);
+                if(record.type != DebugType::codeview || record.data.size() < header_size
+                    || std::string_view(record.data.data(), 4) != "RSDS") {
+                    continue;
+                }
+
+                CodeView res = {};
+                for(size_t j = 0; j < res.guid.size(); ++j) {
+                    res.guid[j] = details::bit_cast<uint8_t>(record.data, 4 + j);
+                }
+                res.age = details::bit_cast<uint32_t>(record.data, 20);
+
+                auto const path = record.data.subspan(header_size);
+                size_t length = 0;
+                while(length < path.size() && path[length] != '\0') {
+                    ++length;
+                }
+                res.pdb_path = std::string_view(path.data(), length);
+                return res;
+            }
+            return std::nullopt;
+        }
+
+        ///
+        /// @brief Returns the key of the build of the image
+        /// @details The GUID of a CodeView record with its age mixed into the low half, the first 16
+        ///     bytes of the hash of a repro entry, or the time stamp, size of the image and checksum of
+        ///     the headers.
+        /// @return a key of the source ImageKeySource::none if the headers are not inside the data,
+        ///     e.g. of a truncated file
+        ///
+        [[nodiscard]] constexpr auto
+        key() const noexcept -> ImageKey
+        {
+            if(auto const record = codeview(); record.has_value()) {
+                ImageKey res = {};
+                for(size_t i = 0; i < 8; ++i) {
+                    res.high |= uint64_t{record->guid[i]} << (8 * i);
+                    res.low |= uint64_t{record->guid[8 + i]} << (8 * i);
+                }
+                res.low ^= (uint64_t{record->age} + 1) * 0x9e3779b97f4a7c15;
+                res.source = ImageKeySource::codeview;
+                return res;
+            }
+
+            for(size_t i = 0; i < size(); ++i) {
+                // the length of the hash, the hash
+                auto const record = entry(i);
+                if(record.type == DebugType::repro && record.data.size() >= 4 + 16
+                    && details::bit_cast<uint32_t>(record.data, 0) >= 16) {
+                    return {details::bit_cast<uint64_t>(record.data, 4), details::bit_cast<uint64_t>(record.data, 12),
+                        ImageKeySource::repro};
+                }
+            }
+
+            OptionalHeader const optional_header(data_);
+            if(!optional_header.is_complete() || optional_header.size() == 0) {
+                return {};
+            }
+            return {uint64_t{FileHeader(data_).time_date_stamp()} << 32 | optional_header.size_of_image(),
+                optional_header.check_sum(), ImageKeySource::header};
+        }
+
+    private:
+        /// @brief the binary data of a .exe file
+        std::span<char const> data_;
+        SectionRanges ranges_;
+        OptionalHeader::DataDirectory directory_;
+        /// @brief the entries of the debug directory
+        std::span<char const> table_;
+    };
+}
@@ -12,6 +12,7 @@
 
 #include "details/bit_cast.hpp"
 #include <span>
+#include <string_view>
 #include <bit>
 #include <cstdint>
 #include <cassert>
@@ -76,8 +77,25 @@ namespace pei
         ///
         constexpr DosHeader(std::span<char const> const data) noexcept : data_(data) {} 
 
+        /// @brief The magic number of an image file, "MZ"
+        static constexpr uint16_t image_magic = 0x5a4d;
+
+        /// 
+        /// @brief Returns true for an image file, an object file has no MS-DOS stub
+        ///
+        [[nodiscard]] constexpr auto
+        is_image() const noexcept -> bool 
+        {
+            if(data_.size() < sizeof(DataStructure)) {
+                return false;
+            }
+
+            return details::bit_cast<decltype(DataStructure::magic)>(data_, offsetof(DataStructure, magic)) == image_magic;
+        }
+
         /// 
         /// @brief Returns the address of the new .exe header
+        /// @details An object file, e.g. a split DWARF .dwo file, starts with the COFF file header
         /// @return the address of the new .exe header
         ///
         [[nodiscard]] constexpr auto
@@ -85,12 +103,36 @@ namespace pei
         {
             size_t const nt_signature_size = 4;
 
+            if(!is_image()) {
+                return 0;
+            }
+
             auto const offset = offsetof(DataStructure, lfanew);
             auto const lfanew = details::bit_cast<decltype(DataStructure::lfanew)>(data_, offset);
 
             return lfanew + nt_signature_size;
         }
 
+        /// 
+        /// @brief Returns true if the address of the new .exe header points to the signature "PE\0\0" inside the data
+        ///
+        [[nodiscard]] constexpr auto
+        has_image_signature() const noexcept -> bool 
+        {
+            if(!is_image()) {
+                return false;
+            }
+
+            size_t const lfanew = details::bit_cast<decltype(DataStructure::lfanew)>(data_, offsetof(DataStructure, lfanew));
+            if(lfanew + image_signature.size() > data_.size()) {
+                return false;
+            }
+            return std::string_view(data_.data() + lfanew, image_signature.size()) == image_signature;
+        }
+
+        /// @brief The signature of an image file in front of the COFF file header
+        static constexpr std::string_view image_signature = {"PE\0\0", 4};
+
     private:
         /// @brief the binary data of a .exe file
         std::span<char const> const data_;
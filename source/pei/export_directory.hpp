@@ -0,0 +1,360 @@
+///
+/// @file:   export_directory.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Portable Executable File Formant, the export table of a DLL
+/// @details: https://docs.microsoft.com/en-us/windows/win32/debug/pe-format#the-edata-section-image-only
+///
+
+#pragma once
+
+#include "section_ranges.hpp"
+#include <unordered_map>
+
+namespace pei
+{
+    /// @class pei::Export
+    ///
+    /// @brief A function or variable exported by an image
+    /// @details The names point into the data of the image
+    ///
+    struct Export final
+    {
+        /// @brief The address in the image as linked, with the preferred image base, 0 for a forwarder
+        uint64_t address = 0;
+        uint32_t rva = 0;
+        uint32_t ordinal = 0;
+        /// @brief Empty for an export by ordinal only
+        std::string_view name = {};
+        /// @brief The export of another DLL this export refers to, e.g. NTDLL.RtlAllocateHeap
+        std::string_view forwarder = {};
+    };
+
+    /// @class pei::ExportDirectory
+    ///
+    /// @brief The export directory table and the tables it refers to
+    /// @details The export address table holds the RVAs of the exports, indexed by ordinal minus the ordinal
+    ///     base. The name pointer table is sorted by name and the ordinal table holds the index into the
+    ///     export address table for each name. An RVA within the export directory is a forwarder string.
+    ///
+    class ExportDirectory final
+    {
+    public:
+        struct DataStructure final
+        {
+            /// @brief Reserved, must be 0.
+            uint32_t export_flags;
+            uint32_t time_date_stamp;
+            uint16_t major_version;
+            uint16_t minor_version;
+            /// @brief The address of the ASCII string that contains the name of the DLL.
+            uint32_t name_rva;
+            /// @brief The starting ordinal number for exports in this image, usually 1.
+            uint32_t ordinal_base;
+            /// @brief The number of entries in the export address table.
+            uint32_t address_table_entries;
+            /// @brief The number of entries in the name pointer table and the ordinal table.
+            uint32_t number_of_name_pointers;
+            uint32_t export_address_table_rva;
+            uint32_t name_pointer_rva;
+            uint32_t ordinal_table_rva;
+        };
+        static_assert(std::is_standard_layout_v<DataStructure>);
+
+        ///
+        /// @brief constructor
+        /// @param data the complete data of a binary .exe or .dll file
+        ///
+        constexpr explicit ExportDirectory(std::span<char const> const data)
+            : ranges_(data),
+              directory_(OptionalHeader(data).data_directory(DirectoryEntry::export_table)),
+              table_(directory_.size >= sizeof(DataStructure) ? ranges_.data(directory_.virtual_address, sizeof(DataStructure))
+                  : std::span<char const>())
+        {
+            if(table_.size() != sizeof(DataStructure)) {
+                table_ = std::span<char const>();
+            }
+        }
+
+        ///
+        /// @brief Returns true if the image has an export table
+        ///
+        [[nodiscard]] constexpr auto
+        is_valid() const noexcept -> bool
+        {
+            return !table_.empty();
+        }
+
+        ///
+        /// @brief Returns the name of the DLL
+        ///
+        [[nodiscard]] constexpr auto
+        name() const noexcept -> std::string_view
+        {
+            return ranges_.string(read<uint32_t>(offsetof(DataStructure, name_rva)));
+        }
+
+        [[nodiscard]] constexpr auto
+        ordinal_base() const noexcept -> uint32_t
+        {
+            return read<uint32_t>(offsetof(DataStructure, ordinal_base));
+        }
+
+        ///
+        /// @brief Returns the number of entries of the export address table, including unused ordinals
+        ///
+        [[nodiscard]] constexpr auto
+        number_of_functions() const noexcept -> uint32_t
+        {
+            return std::min<uint32_t>(read<uint32_t>(offsetof(DataStructure, address_table_entries)),
+                static_cast<uint32_t>(table_data(offsetof(DataStructure, export_address_table_rva)).size() / sizeof(uint32_t)));
+        }
+
+        [[nodiscard]] constexpr auto
+        number_of_names() const noexcept -> uint32_t
+        {
+            auto const names = table_data(offsetof(DataStructure, name_pointer_rva)).size() / sizeof(uint32_t);
+            auto const ordinals = table_data(offsetof(DataStructure, ordinal_table_rva)).size() / sizeof(uint16_t);
+            return std::min<uint32_t>(read<uint32_t>(offsetof(DataStructure, number_of_name_pointers)),
+                static_cast<uint32_t>(std::min(names, ordinals)));
+        }
+
+        ///
+        /// @brief Returns the export at an index of the export address table, without its name
+        /// @param index the ordinal minus the ordinal base, less than number_of_functions()
+        /// @return an export with an RVA of 0 for an unused ordinal
+        ///
+        [[nodiscard]] constexpr auto
+        function(uint32_t const index) const noexcept -> Export
+        {
+            auto const addresses = table_data(offsetof(DataStructure, export_address_table_rva));
+            if(index >= number_of_functions()) {
+                return {};
+            }
+
+            Export res = {};
+            res.rva = details::bit_cast<uint32_t>(addresses, index * sizeof(uint32_t));
+            res.ordinal = ordinal_base() + index;
+            if(res.rva - directory_.virtual_address < directory_.size) {
+                res.forwarder = ranges_.string(res.rva);
+            }
+            return res;
+        }
+
+        ///
+        /// @brief Returns an entry of the name pointer table, sorted by name
+        /// @param index less than number_of_names()
+        ///
+        [[nodiscard]] constexpr auto
+        name(uint32_t const index) const noexcept -> std::string_view
+        {
+            if(index >= number_of_names()) {
+                return std::string_view();
+            }
+
+            auto const names = table_data(offsetof(DataStructure, name_pointer_rva));
+            return ranges_.string(details::bit_cast<uint32_t>(names, index * sizeof(uint32_t)));
+        }
+
+        ///
+        /// @brief Returns the index into the export address table of the export with the name at an index
+        ///     of the name pointer table
+        ///
+        [[nodiscard]] constexpr auto
+        name_ordinal(uint32_t const index) const noexcept -> uint16_t
+        {
+            if(index >= number_of_names()) {
+                return 0;
+            }
+
+            auto const ordinals = table_data(offsetof(DataStructure, ordinal_table_rva));
+            return details::bit_cast<uint16_t>(ordinals, index * sizeof(uint16_t));
+        }
+
+        ///
+        /// @brief Returns the translation of the relative virtual addresses of the image
+        ///
+        [[nodiscard]] constexpr auto
+        ranges() const noexcept -> SectionRanges const &
+        {
+            return ranges_;
+        }
+
+    private:
+        SectionRanges ranges_;
+        OptionalHeader::DataDirectory directory_;
+        /// @brief the export directory table
+        std::span<char const> table_;
+
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        read(size_t const offset) const noexcept -> T
+        {
+            if(!is_valid()) {
+                return T();
+            }
+            return details::bit_cast<T>(table_, offset);
+        }
+
+        ///
+        /// @brief Returns the data of a table at the RVA stored at an offset in the export directory table
+        ///
+        [[nodiscard]] constexpr auto
+        table_data(size_t const offset) const noexcept -> std::span<char const>
+        {
+            auto const rva = read<uint32_t>(offset);
+            return rva == 0 ? std::span<char const>() : ranges_.data(rva);
+        }
+    };
+
+    /// @class pei::ExportIndex
+    ///
+    /// @brief The exports of an image, hashed by name and sorted by address
+    /// @details Finds the export containing an address of a DLL without debug information, e.g. a system
+    ///     DLL, in O(log n). An export ends at the next export or at the end of its section.
+    ///
+    class ExportIndex final
+    {
+    public:
+        ExportIndex() = default;
+
+        ///
+        /// @brief Builds the index of the exports of an image
+        /// @param data the complete data of a binary .exe or .dll file
+        ///
+        explicit ExportIndex(std::span<char const> const data)
+        {
+            ExportDirectory const directory(data);
+            if(!directory.is_valid()) {
+                return;
+            }
+
+            name_ = directory.name();
+            ordinal_base_ = directory.ordinal_base();
+            uint64_t const image_base = OptionalHeader(data).image_base();
+
+            auto const count = directory.number_of_functions();
+            exports_.reserve(count);
+            for(uint32_t i = 0; i < count; ++i) {
+                auto entry = directory.function(i);
+                if(entry.rva != 0 && entry.forwarder.empty()) {
+                    entry.address = image_base + entry.rva;
+                }
+                exports_.push_back(entry);
+            }
+
+            auto const names = directory.number_of_names();
+            by_name_.reserve(names);
+            for(uint32_t i = 0; i < names; ++i) {
+                auto const index = directory.name_ordinal(i);
+                if(index < exports_.size()) {
+                    exports_[index].name = directory.name(i);
+                    by_name_.emplace(exports_[index].name, index);
+                }
+            }
+
+            for(uint32_t i = 0; i < exports_.size(); ++i) {
+                if(exports_[i].address != 0) {
+                    by_address_.push_back({exports_[i].address, 0, i});
+                }
+            }
+            std::ranges::sort(by_address_, {}, &AddressRange::address);
+
+            // an export ends at the next export or at the end of its section
+            auto const & ranges = directory.ranges();
+            for(size_t i = 0; i < by_address_.size(); ++i) {
+                auto & range = by_address_[i];
+                auto const * const section = ranges.find(exports_[range.index].rva);
+                range.end = section != nullptr ? image_base + section->virtual_address + section->virtual_size : range.address;
+                if(i + 1 < by_address_.size()) {
+                    range.end = std::min(range.end, std::max(range.address, by_address_[i + 1].address));
+                }
+            }
+        }
+
+        ///
+        /// @brief Returns the name of the DLL as stored in its export table
+        ///
+        [[nodiscard]] auto
+        name() const noexcept -> std::string_view
+        {
+            return name_;
+        }
+
+        ///
+        /// @brief Returns the export with a name in O(1)
+        /// @return nullptr if there is no such export
+        ///
+        [[nodiscard]] auto
+        find(std::string_view const name) const noexcept -> Export const *
+        {
+            auto const it = by_name_.find(name);
+            return it != by_name_.end() ? &exports_[it->second] : nullptr;
+        }
+
+        ///
+        /// @brief Returns the export with an ordinal in O(1)
+        /// @return nullptr if the ordinal is not used
+        ///
+        [[nodiscard]] auto
+        find_ordinal(uint32_t const ordinal) const noexcept -> Export const *
+        {
+            auto const index = ordinal - ordinal_base_;
+            if(ordinal < ordinal_base_ || index >= exports_.size() || exports_[index].rva == 0) {
+                return nullptr;
+            }
+            return &exports_[index];
+        }
+
+        ///
+        /// @brief Returns the export containing an address in O(log n)
+        /// @param address an address of the image as linked, with the preferred image base
+        /// @return nullptr if no export contains the address
+        ///
+        [[nodiscard]] auto
+        find(uint64_t const address) const noexcept -> Export const *
+        {
+            auto it = std::ranges::upper_bound(by_address_, address, {}, &AddressRange::address);
+            if(it == by_address_.begin()) {
+                return nullptr;
+            }
+
+            --it;
+            if(address >= it->end) {
+                return nullptr;
+            }
+            return &exports_[it->index];
+        }
+
+        ///
+        /// @brief Returns the exports indexed by ordinal minus the ordinal base
+        ///
+        [[nodiscard]] auto
+        exports() const noexcept -> std::span<Export const>
+        {
+            return exports_;
+        }
+
+        [[nodiscard]] auto
+        size() const noexcept -> size_t
+        {
+            return exports_.size();
+        }
+
+    private:
+        struct AddressRange final
+        {
+            uint64_t address = 0;
+            uint64_t end = 0;
+            /// @brief the index of the export in exports_
+            uint32_t index = 0;
+        };
+
+        std::string_view name_ = {};
+        uint32_t ordinal_base_ = 0;
+        std::vector<Export> exports_;
+        std::unordered_map<std::string_view, uint32_t> by_name_;
+        /// @brief the exports with an address, sorted by address
+        std::vector<AddressRange> by_address_;
+    };
+}
@@ -18,7 +18,8 @@ namespace pei
     /// @brief COFF file header
     /// @details At the beginning of an object file, or immediately after the signature of an image file,
     ///     is a standard COFF file header in the following format. Note that the Windows loader limits 
-    ///     the number of sections to 96.
+    ///     the number of sections to 96. The fields of a header which is not inside the data, e.g. of a
+    ///     truncated file, are read as 0.
     ///
     class FileHeader final
     {
@@ -56,6 +57,17 @@ namespace pei
         ///
         constexpr FileHeader(std::span<char const> const data) noexcept : data_(data) {} 
 
+        /// 
+        /// @brief The number that identifies the type of target machine, e.g. 0x8664 for x64 and 0x14c for
+        ///     Intel 386. 
+        /// @return the machine type
+        ///
+        [[nodiscard]] constexpr auto
+        machine() const noexcept -> decltype(DataStructure::machine)
+        {
+            return read<decltype(DataStructure::machine)>(offsetof(DataStructure, machine));
+        }
+
         /// 
         /// @brief Returns the number of sections. This indicates the size of the section table, which immediately
         ///     follows the headers.
@@ -64,10 +76,18 @@ namespace pei
         [[nodiscard]] constexpr auto
         number_of_sections() const noexcept -> decltype(DataStructure::number_of_sections)
         {
-            auto const index = base_index() + offsetof(DataStructure, number_of_sections);
-            auto const res = details::bit_cast<decltype(DataStructure::number_of_sections)>(data_, index);
+            return read<decltype(DataStructure::number_of_sections)>(offsetof(DataStructure, number_of_sections));
+        }
 
-            return res;
+        /// 
+        /// @brief The low 32 bits of the number of seconds since 00:00 January 1, 1970, that indicates when the
+        ///     file was created. Reproducible builds store a hash of the image instead.
+        /// @return the time stamp of the file
+        ///
+        [[nodiscard]] constexpr auto
+        time_date_stamp() const noexcept -> decltype(DataStructure::time_date_stamp)
+        {
+            return read<decltype(DataStructure::time_date_stamp)>(offsetof(DataStructure, time_date_stamp));
         }
 
         /// 
@@ -78,10 +98,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         pointer_to_symbol_table() const noexcept -> decltype(DataStructure::pointer_to_symbol_table)
         {
-            auto const index = base_index() + offsetof(DataStructure, pointer_to_symbol_table);
-            auto const res = details::bit_cast<decltype(DataStructure::pointer_to_symbol_table)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::pointer_to_symbol_table)>(offsetof(DataStructure, pointer_to_symbol_table));
         }
 
         /// 
@@ -93,10 +110,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         number_of_symbols() const noexcept -> decltype(DataStructure::number_of_symbols)
         {
-            auto const index = base_index() + offsetof(DataStructure, number_of_symbols);
-            auto const res = details::bit_cast<decltype(DataStructure::number_of_symbols)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::number_of_symbols)>(offsetof(DataStructure, number_of_symbols));
         }
 
         /// 
@@ -108,10 +122,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         size_of_optional_header() const noexcept -> decltype(DataStructure::size_of_optional_header)
         {
-            auto const index = base_index() + offsetof(DataStructure, size_of_optional_header);
-            auto const res = details::bit_cast<decltype(DataStructure::size_of_optional_header)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::size_of_optional_header)>(offsetof(DataStructure, size_of_optional_header));
         }
 
         /// 
@@ -144,8 +155,27 @@ namespace pei
             return sizeof(DataStructure);
         }
 
+        /// 
+        /// @brief Returns true if the FileHeader is inside the data
+        ///
+        [[nodiscard]] constexpr auto
+        is_complete() const noexcept -> bool
+        {
+            return size_t{base_index()} + sizeof(DataStructure) <= data_.size();
+        }
+
     private:
         /// @brief the binary data of a .exe file
         std::span<char const> const data_;
+
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        read(size_t const offset) const noexcept -> T
+        {
+            if(!is_complete()) {
+                return T();
+            }
+            return details::bit_cast<T>(data_, base_index() + offset);
+        }
     };
 }
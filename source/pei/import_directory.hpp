@@ -0,0 +1,239 @@
+///
+/// @file:   import_directory.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Portable Executable File Formant, the import tables of an image
+/// @details: https://docs.microsoft.com/en-us/windows/win32/debug/pe-format#the-idata-section
+///
+
+#pragma once
+
+#include "section_ranges.hpp"
+#include <unordered_map>
+
+namespace pei
+{
+    /// @class pei::Import
+    ///
+    /// @brief A function or variable imported from a DLL
+    /// @details The names point into the data of the image
+    ///
+    struct Import final
+    {
+        std::string_view dll = {};
+        /// @brief Empty for an import by ordinal
+        std::string_view name = {};
+        /// @brief The index into the export name pointer table of the DLL to try first
+        uint16_t hint = 0;
+        /// @brief The ordinal of an import by ordinal, 0 for an import by name
+        uint32_t ordinal = 0;
+        /// @brief The address of the slot of the import address table the loader writes the address
+        ///     of the import to, with the preferred image base
+        uint64_t address = 0;
+    };
+
+    /// @class pei::ImportDirectory
+    ///
+    /// @brief The import directory table with one entry for each imported DLL, terminated by an empty entry
+    /// @details Each entry refers to an import lookup table with an entry for each import, either an
+    ///     ordinal or the RVA of a hint and a name, and to the import address table of the DLL.
+    ///
+    class ImportDirectory final
+    {
+    public:
+        struct DataStructure final
+        {
+            /// @brief The RVA of the import lookup table.
+            uint32_t import_lookup_table_rva;
+            /// @brief 0 until the image is bound.
+            uint32_t time_date_stamp;
+            uint32_t forwarder_chain;
+            /// @brief The address of an ASCII string that contains the name of the DLL.
+            uint32_t name_rva;
+            /// @brief The RVA of the import address table, identical to the import lookup table until the
+            ///     image is bound.
+            uint32_t import_address_table_rva;
+        };
+        static_assert(std::is_standard_layout_v<DataStructure>);
+
+        ///
+        /// @brief constructor
+        /// @param data the complete data of a binary .exe or .dll file
+        ///
+        constexpr explicit ImportDirectory(std::span<char const> const data)
+            : ranges_(data),
+              table_(ranges_.data(OptionalHeader(data).data_directory(DirectoryEntry::import_table).virtual_address)),
+              image_base_(OptionalHeader(data).image_base()),
+              is_pe32_plus_(OptionalHeader(data).is_pe32_plus())
+        {
+            if(OptionalHeader(data).data_directory(DirectoryEntry::import_table).virtual_address == 0) {
+                table_ = std::span<char const>();
+            }
+        }
+
+        ///
+        /// @brief Returns the number of imported DLLs
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_t
+        {
+            size_t res = 0;
+            while((res + 1) * sizeof(DataStructure) <= table_.size()
+                && (read(res, offsetof(DataStructure, name_rva)) != 0 || read(res, offsetof(DataStructure, import_address_table_rva)) != 0)) {
+                ++res;
+            }
+            return res;
+        }
+
+        ///
+        /// @brief Returns the name of an imported DLL
+        /// @param index less than size()
+        ///
+        [[nodiscard]] constexpr auto
+        dll_name(size_t const index) const noexcept -> std::string_view
+        {
+            return ranges_.string(read(index, offsetof(DataStructure, name_rva)));
+        }
+
+        ///
+        /// @brief Calls a function for each import of a DLL
+        /// @param index less than size()
+        /// @param func called with a pei::Import
+        ///
+        template<typename FUNC_T>
+        constexpr auto
+        for_each_import(size_t const index, FUNC_T && func) const -> void
+        {
+            auto const address_table = read(index, offsetof(DataStructure, import_address_table_rva));
+            auto lookup_table = read(index, offsetof(DataStructure, import_lookup_table_rva));
+            if(lookup_table == 0) {
+                // old linkers leave the lookup table out, the address table is identical until the image is bound
+                lookup_table = address_table;
+            }
+
+            auto const dll = dll_name(index);
+            auto const entries = ranges_.data(lookup_table);
+            size_t const entry_size = is_pe32_plus_ ? sizeof(uint64_t) : sizeof(uint32_t);
+            uint64_t const ordinal_flag = is_pe32_plus_ ? uint64_t{1} << 63 : uint64_t{1} << 31;
+
+            for(size_t offset = 0; offset + entry_size <= entries.size(); offset += entry_size) {
+                uint64_t const entry = is_pe32_plus_ ? details::bit_cast<uint64_t>(entries, offset) : details::bit_cast<uint32_t>(entries, offset);
+                if(entry == 0) {
+                    break;
+                }
+
+                Import import = {};
+                import.dll = dll;
+                import.address = image_base_ + address_table + offset;
+                if((entry & ordinal_flag) != 0) {
+                    import.ordinal = static_cast<uint16_t>(entry);
+                }
+                else {
+                    // hint, name
+                    auto const rva = static_cast<uint32_t>(entry & 0x7fffffff);
+                    auto const hint = ranges_.data(rva, sizeof(uint16_t));
+                    import.hint = hint.size() == sizeof(uint16_t) ? details::bit_cast<uint16_t>(hint, 0) : 0;
+                    import.name = ranges_.string(rva + sizeof(uint16_t));
+                }
+                func(import);
+            }
+        }
+
+    private:
+        SectionRanges ranges_;
+        /// @brief the import directory table
+        std::span<char const> table_;
+        uint64_t image_base_;
+        bool is_pe32_plus_;
+
+        [[nodiscard]] constexpr auto
+        read(size_t const index, size_t const offset) const noexcept -> uint32_t
+        {
+            size_t const position = index * sizeof(DataStructure) + offset;
+            if(position + sizeof(uint32_t) > table_.size()) {
+                return 0;
+            }
+            return details::bit_cast<uint32_t>(table_, position);
+        }
+    };
+
+    /// @class pei::ImportIndex
+    ///
+    /// @brief The imports of an image, hashed by the address of their slot in the import address table
+    ///     and by name
+    /// @details Resolves an indirect call through the import address table, call [rip + offset], to the
+    ///     imported function in O(1).
+    ///
+    class ImportIndex final
+    {
+    public:
+        ImportIndex() = default;
+
+        ///
+        /// @brief Builds the index of the imports of an image
+        /// @param data the complete data of a binary .exe or .dll file
+        ///
+        explicit ImportIndex(std::span<char const> const data)
+        {
+            ImportDirectory const directory(data);
+            size_t const count = directory.size();
+            for(size_t i = 0; i < count; ++i) {
+                directory.for_each_import(i, [this](Import const & import) {
+                    imports_.push_back(import);
+                });
+            }
+
+            by_address_.reserve(imports_.size());
+            by_name_.reserve(imports_.size());
+            for(uint32_t i = 0; i < imports_.size(); ++i) {
+                by_address_.emplace(imports_[i].address, i);
+                if(!imports_[i].name.empty()) {
+                    by_name_.emplace(imports_[i].name, i);
+                }
+            }
+        }
+
+        ///
+        /// @brief Returns the import whose address is written to a slot of the import address table
+        /// @param address the address of the slot, with the preferred image base
+        /// @return nullptr if the address is not a slot of the import address table
+        ///
+        [[nodiscard]] auto
+        find(uint64_t const address) const noexcept -> Import const *
+        {
+            auto const it = by_address_.find(address);
+            return it != by_address_.end() ? &imports_[it->second] : nullptr;
+        }
+
+        ///
+        /// @brief Returns the import with a name, the first one if several DLLs export the name
+        /// @return nullptr if there is no such import
+        ///
+        [[nodiscard]] auto
+        find(std::string_view const name) const noexcept -> Import const *
+        {
+            auto const it = by_name_.find(name);
+            return it != by_name_.end() ? &imports_[it->second] : nullptr;
+        }
+
+        ///
+        /// @brief Returns the imports in the order of the import tables
+        ///
+        [[nodiscard]] auto
+        imports() const noexcept -> std::span<Import const>
+        {
+            return imports_;
+        }
+
+        [[nodiscard]] auto
+        size() const noexcept -> size_t
+        {
+            return imports_.size();
+        }
+
+    private:
+        std::vector<Import> imports_;
+        std::unordered_map<uint64_t, uint32_t> by_address_;
+        std::unordered_map<std::string_view, uint32_t> by_name_;
+    };
+}
@@ -13,6 +13,27 @@
 
 namespace pei 
 {   
+    /// @brief The entries of the data directories of the optional header
+    enum class DirectoryEntry : uint8_t
+    {
+        export_table,
+        import_table,
+        resource_table,
+        exception_table,
+        certificate_table,
+        base_relocation_table,
+        debug,
+        architecture,
+        global_ptr,
+        tls_table,
+        load_config_table,
+        bound_import,
+        import_address_table,
+        delay_import_descriptor,
+        clr_runtime_header,
+        reserved
+    };
+
     /// @class pei::OptionalHeader
     ///
     /// @brief Optional Header (Image Only)
@@ -24,7 +45,8 @@ namespace pei
     /// @note Note that the size of the optional header is not fixed. The SizeOfOptionalHeader field 
     ///     in the COFF header must be used to validate that a probe into the file for a particular 
     ///     data directory does not go beyond SizeOfOptionalHeader. For more information, see COFF 
-    ///     File Header (Object and Image).
+    ///     File Header (Object and Image). The fields of a header which is not inside the data, e.g. of
+    ///     a truncated file, are read as 0.
     ///
     class OptionalHeader final
     {
@@ -160,10 +182,98 @@ namespace pei
         [[nodiscard]] constexpr auto
         magic() const noexcept -> decltype(DataStructure::magic)
         {
-            auto const index = base_index() + offsetof(DataStructure, magic);
-            auto const res = details::bit_cast<decltype(DataStructure::magic)>(data_, index);
+            return read<decltype(DataStructure::magic)>(offsetof(DataStructure, magic));
+        }
+
+        /// 
+        /// @brief The preferred address of the first byte of image when loaded into memory. The field is
+        ///     8 bytes wide in a PE32+ image and follows directly after base_of_code, which has no
+        ///     base_of_data field.
+        /// @return the image base, 0 for an object file without an optional header
+        ///
+        [[nodiscard]] constexpr auto
+        image_base() const noexcept -> uint64_t
+        {
+            if(size() == 0) {
+                return 0;
+            }
+
+            if(magic() == 0x20b) {
+                return read<uint64_t>(offsetof(DataStructure, base_of_data));
+            }
+
+            return read<decltype(DataStructure::image_base)>(offsetof(DataStructure, image_base));
+        }
+
+        /// 
+        /// @brief The size of the image as loaded in memory, a multiple of the section alignment. The field
+        ///     is at the same offset in a PE32 and a PE32+ image.
+        /// @return 0 for an object file without an optional header
+        ///
+        [[nodiscard]] constexpr auto
+        size_of_image() const noexcept -> decltype(DataStructure::size_of_image)
+        {
+            if(size() == 0) {
+                return 0;
+            }
+
+            return read<decltype(DataStructure::size_of_image)>(offsetof(DataStructure, size_of_image));
+        }
+
+        /// 
+        /// @brief The image file checksum, 0 for most images but drivers and system DLLs
+        /// @return 0 for an object file without an optional header
+        ///
+        [[nodiscard]] constexpr auto
+        check_sum() const noexcept -> decltype(DataStructure::check_sum)
+        {
+            if(size() == 0) {
+                return 0;
+            }
 
-            return res;
+            return read<decltype(DataStructure::check_sum)>(offsetof(DataStructure, check_sum));
+        }
+
+        /// 
+        /// @brief Returns true for a PE32+ image, whose image base and stack and heap sizes are 8 bytes wide
+        ///
+        [[nodiscard]] constexpr auto
+        is_pe32_plus() const noexcept -> bool
+        {
+            return size() != 0 && magic() == 0x20b;
+        }
+
+        /// 
+        /// @brief The number of data-directory entries in the remainder of the optional header. 
+        /// @return 0 for an object file without an optional header
+        ///
+        [[nodiscard]] constexpr auto
+        number_of_rva_and_sizes() const noexcept -> decltype(DataStructure::number_of_rva_and_sizes)
+        {
+            if(size() == 0) {
+                return 0;
+            }
+
+            return read<decltype(DataStructure::number_of_rva_and_sizes)>(offsetof(DataStructure, number_of_rva_and_sizes) + pe32_plus_offset());
+        }
+
+        /// 
+        /// @brief Returns the address and size of a table of the image, e.g. the export table
+        /// @return an empty directory if the optional header has no such entry
+        ///
+        [[nodiscard]] constexpr auto
+        data_directory(DirectoryEntry const entry) const noexcept -> DataDirectory
+        {
+            auto const number = static_cast<uint32_t>(entry);
+            size_t const offset = offsetof(DataStructure, data_directory) + pe32_plus_offset() + number * sizeof(DataDirectory);
+            if(number >= number_of_rva_and_sizes() || offset + sizeof(DataDirectory) > size()) {
+                return DataDirectory{0, 0};
+            }
+
+            return DataDirectory{
+                read<decltype(DataDirectory::virtual_address)>(offset + offsetof(DataDirectory, virtual_address)),
+                read<decltype(DataDirectory::size)>(offset + offsetof(DataDirectory, size))
+            };
         }
 
         /// 
@@ -186,8 +296,41 @@ namespace pei
             return file_header.size_of_optional_header();
         }
 
+        /// 
+        /// @brief Returns true if the FileHeader and the OptionalHeader of the size given in it are inside the data
+        ///
+        [[nodiscard]] constexpr auto
+        is_complete() const noexcept -> bool
+        {
+            FileHeader const file_header(data_);
+            return file_header.is_complete() && size_t{base_index()} + size() <= data_.size();
+        }
+
     private:
         /// @brief the binary data of a .exe file
         std::span<char const> const data_;
+
+        /// 
+        /// @brief Reads a field, 0 if it is behind the size of the header or the header is not inside the data
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        read(size_t const offset) const noexcept -> T
+        {
+            if(offset + sizeof(T) > size() || !is_complete()) {
+                return T();
+            }
+            return details::bit_cast<T>(data_, base_index() + offset);
+        }
+
+        /// 
+        /// @brief The fields behind the stack and heap sizes are 16 bytes further in a PE32+ image, its
+        ///     8 bytes image base takes the place of base_of_data
+        ///
+        [[nodiscard]] constexpr auto
+        pe32_plus_offset() const noexcept -> size_t
+        {
+            return is_pe32_plus() ? 4 * sizeof(uint32_t) : 0;
+        }
     };
 }
\ No newline at end of file
@@ -13,3 +13,8 @@
 #include "optional_header.hpp"
 #include "section_header.hpp"
 #include "section_table.hpp"
+#include "symbol_table.hpp"
+#include "section_ranges.hpp"
+#include "export_directory.hpp"
+#include "import_directory.hpp"
+#include "debug_directory.hpp"
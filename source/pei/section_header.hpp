@@ -49,6 +49,7 @@ namespace pei
     ///     because the file header does not contain a direct pointer to the section table. Instead, the 
     ///     location of the section table is determined by calculating the location of the first byte 
     ///     after the headers. Make sure to use the size of the optional header as specified in the file header.
+    ///     The fields of a header which is not inside the data, e.g. of a truncated file, are read as 0.
     ///
     class SectionHeader final
     {
@@ -105,7 +106,8 @@ namespace pei
         /// @brief constructor
         /// @param data the complete data of a binary .exe file
         ///
-        constexpr SectionHeader(std::span<char const> const data, size_t const index) noexcept : data_(data), index_(index) {} 
+        constexpr SectionHeader(std::span<char const> const data, size_t const index) noexcept 
+            : data_(data), index_(index), base_index_(read_base_index(data, index)) {} 
 
         //  
         /// @brief Returns the name of the section
@@ -119,7 +121,12 @@ namespace pei
                 return std::string_view();
             }
 
-            std::string_view const name(&data_[index]);
+            // If the name is exactly 8 characters long, there is no terminating null
+            size_t size = 0;
+            while(size < sizeof(DataStructure::name) && data_[index + size] != '\0') {
+                ++size;
+            }
+            std::string_view const name(&data_[index], size);
 
             if(name.starts_with('/'))
             {   // name is located in the string table
@@ -129,14 +136,20 @@ namespace pei
                     return name;
                 }
 
-                if(name.size() < 3) {
+                if(name.size() < 2) {
                     return name;
                 }
 
-                size_t const index = svtol(name.substr(1));
-                // size_t const index = std::atol(name.substr(1).data());
-                std::string_view const longer_name(&data_[string_table_address + index]);
-                return longer_name;
+                size_t const begin = size_t{string_table_address} + svtol(name.substr(1));
+                if(begin >= data_.size()) {
+                    return name;
+                }
+
+                size_t size = 0;
+                while(begin + size < data_.size() && data_[begin + size] != '\0') {
+                    ++size;
+                }
+                return std::string_view(&data_[begin], size);
             }
 
             return name;
@@ -150,10 +163,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         virtual_size() const noexcept -> decltype(DataStructure::virtual_size)
         {
-            auto const index = base_index() + offsetof(DataStructure, virtual_size);
-            auto const res = details::bit_cast<decltype(DataStructure::virtual_size)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::virtual_size)>(offsetof(DataStructure, virtual_size));
         }
 
         /// 
@@ -165,10 +175,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         virtual_address() const noexcept -> decltype(DataStructure::virtual_address)
         {
-            auto const index = base_index() + offsetof(DataStructure, virtual_address);
-            auto const res = details::bit_cast<decltype(DataStructure::virtual_address)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::virtual_address)>(offsetof(DataStructure, virtual_address));
         }
 
         /// 
@@ -182,10 +189,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         size_of_raw_data() const noexcept -> decltype(DataStructure::size_of_raw_data)
         {
-            auto const index = base_index() + offsetof(DataStructure, size_of_raw_data);
-            auto const res = details::bit_cast<decltype(DataStructure::size_of_raw_data)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::size_of_raw_data)>(offsetof(DataStructure, size_of_raw_data));
         }
 
         /// 
@@ -197,10 +201,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         pointer_to_raw_data() const noexcept -> decltype(DataStructure::pointer_to_raw_data)
         {
-            auto const index = base_index() + offsetof(DataStructure, pointer_to_raw_data);
-            auto const res = details::bit_cast<decltype(DataStructure::pointer_to_raw_data)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::pointer_to_raw_data)>(offsetof(DataStructure, pointer_to_raw_data));
         }
 
         /// 
@@ -210,10 +211,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         pointer_to_relocations() const noexcept -> decltype(DataStructure::pointer_to_relocations)
         {
-            auto const index = base_index() + offsetof(DataStructure, pointer_to_relocations);
-            auto const res = details::bit_cast<decltype(DataStructure::pointer_to_relocations)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::pointer_to_relocations)>(offsetof(DataStructure, pointer_to_relocations));
         }
 
         /// 
@@ -224,10 +222,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         pointer_to_linenumbers() const noexcept -> decltype(DataStructure::pointer_to_linenumbers)
         {
-            auto const index = base_index() + offsetof(DataStructure, pointer_to_linenumbers);
-            auto const res = details::bit_cast<decltype(DataStructure::pointer_to_linenumbers)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::pointer_to_linenumbers)>(offsetof(DataStructure, pointer_to_linenumbers));
         }
 
         /// 
@@ -236,10 +231,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         number_of_relocations() const noexcept -> decltype(DataStructure::number_of_relocations)
         {
-            auto const index = base_index() + offsetof(DataStructure, number_of_relocations);
-            auto const res = details::bit_cast<decltype(DataStructure::number_of_relocations)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::number_of_relocations)>(offsetof(DataStructure, number_of_relocations));
         }
 
         /// 
@@ -249,10 +241,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         number_of_linenumbers() const noexcept -> decltype(DataStructure::number_of_linenumbers)
         {
-            auto const index = base_index() + offsetof(DataStructure, number_of_linenumbers);
-            auto const res = details::bit_cast<decltype(DataStructure::number_of_linenumbers)>(data_, index);
-
-            return res;
+            return read<decltype(DataStructure::number_of_linenumbers)>(offsetof(DataStructure, number_of_linenumbers));
         }
 
         /// 
@@ -260,12 +249,30 @@ namespace pei
         ///     see Section Flags.
         ///
         [[nodiscard]] constexpr auto
-        characteristics() const noexcept -> decltype(DataStructure::virtual_address)
+        characteristics() const noexcept -> decltype(DataStructure::characteristics)
         {
-            auto const index = base_index() + offsetof(DataStructure, virtual_address);
-            auto const res = details::bit_cast<decltype(DataStructure::virtual_address)>(data_, index);
+            return read<decltype(DataStructure::characteristics)>(offsetof(DataStructure, characteristics));
+        }
 
-            return res;
+        /// 
+        /// @brief Returns the initialized data of the section. The zero padding up to the FileAlignment
+        ///     is not part of the returned data.
+        ///
+        [[nodiscard]] constexpr auto
+        data() const noexcept -> std::span<char const>
+        {
+            size_t const begin = pointer_to_raw_data();
+            size_t size = size_of_raw_data();
+
+            if(virtual_size() != 0 && virtual_size() < size) {
+                size = virtual_size();
+            }
+
+            if(begin >= data_.size()) {
+                return std::span<char const>();
+            }
+
+            return data_.subspan(begin, std::min(size, data_.size() - begin));
         }
 
         /// 
@@ -274,8 +281,7 @@ namespace pei
         [[nodiscard]] constexpr auto
         base_index() const noexcept -> uint32_t 
         {   
-            OptionalHeader const optional_header(data_);
-            return optional_header.base_index() + optional_header.size() + index_ * size();
+            return base_index_;
         }
 
         /// 
@@ -292,9 +298,31 @@ namespace pei
         std::span<char const> const data_;
         /// @brief the index of this section in the section table
         size_t const index_;
+        /// @brief the address of the start of the SectionHeader, read once instead of on each access
+        uint32_t const base_index_;
+
+        /// 
+        /// @brief Reads a field, 0 if the header is not inside the data
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        read(size_t const offset) const noexcept -> T
+        {
+            if(size_t{base_index_} + sizeof(DataStructure) > data_.size()) {
+                return T();
+            }
+            return details::bit_cast<T>(data_, base_index_ + offset);
+        }
+
+        [[nodiscard]] static constexpr auto
+        read_base_index(std::span<char const> const data, size_t const index) noexcept -> uint32_t 
+        {   
+            OptionalHeader const optional_header(data);
+            return optional_header.base_index() + optional_header.size() + index * sizeof(DataStructure);
+        }
     };
 
-    std::ostream & operator<<(std::ostream & ost, SectionHeader const & section_header) 
+    inline std::ostream & operator<<(std::ostream & ost, SectionHeader const & section_header) 
     {
         ost << "name:                   " << section_header.name() << std::endl;
         ost << "virtual_size:           " << section_header.virtual_size() << " (0x" << std::hex << section_header.virtual_size() << std::dec << ")" << std::endl;
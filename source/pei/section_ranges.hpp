@@ -0,0 +1,143 @@
+///
+/// @file:   section_ranges.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Portable Executable File Formant, translation of relative virtual addresses to file offsets
+/// @details: https://docs.microsoft.com/en-us/windows/win32/debug/pe-format#general-concepts
+///
+
+#pragma once
+
+#include "section_table.hpp"
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace pei
+{
+    /// @class pei::SectionRanges
+    ///
+    /// @brief The address ranges of the sections sorted by their virtual address, to find the data of a
+    ///     relative virtual address (RVA) in O(log n)
+    /// @details The tables of the data directories refer to each other with RVAs, the addresses relative
+    ///     to the image base when the image is loaded.
+    ///
+    class SectionRanges final
+    {
+    public:
+        struct Range final
+        {
+            uint32_t virtual_address = 0;
+            /// @brief The size when loaded, the part behind size_of_raw_data is zero-filled
+            uint32_t virtual_size = 0;
+            uint32_t pointer_to_raw_data = 0;
+            uint32_t size_of_raw_data = 0;
+        };
+
+        ///
+        /// @brief constructor
+        /// @param data the complete data of a binary .exe file
+        ///
+        constexpr explicit SectionRanges(std::span<char const> const data)
+            : data_(data)
+        {
+            SectionTable const section_table(data);
+            size_t const count = section_table.number_of_sections();
+            ranges_.reserve(count);
+            for(size_t i = 0; i < count; ++i) {
+                auto const section = section_table.get_section(i);
+                auto const virtual_size = section.virtual_size() != 0 ? section.virtual_size() : section.size_of_raw_data();
+                ranges_.push_back({section.virtual_address(), virtual_size, section.pointer_to_raw_data(),
+                    std::min(section.size_of_raw_data(), virtual_size)});
+            }
+
+            std::ranges::sort(ranges_, {}, &Range::virtual_address);
+        }
+
+        ///
+        /// @brief Returns the file offset of a relative virtual address
+        /// @return std::nullopt if the address is not in a section or in its zero-filled part
+        ///
+        [[nodiscard]] constexpr auto
+        file_offset(uint32_t const rva) const noexcept -> std::optional<size_t>
+        {
+            auto const * const range = find(rva);
+            if(range == nullptr || rva - range->virtual_address >= range->size_of_raw_data) {
+                return std::nullopt;
+            }
+
+            return size_t{range->pointer_to_raw_data} + (rva - range->virtual_address);
+        }
+
+        ///
+        /// @brief Returns the data at a relative virtual address up to the end of its section
+        /// @param size the maximum size of the data
+        /// @return an empty span if the address is not in the data of a section
+        ///
+        [[nodiscard]] constexpr auto
+        data(uint32_t const rva, size_t const size = std::dynamic_extent) const noexcept -> std::span<char const>
+        {
+            auto const * const range = find(rva);
+            if(range == nullptr) {
+                return std::span<char const>();
+            }
+
+            size_t const offset = rva - range->virtual_address;
+            size_t const begin = size_t{range->pointer_to_raw_data} + offset;
+            if(offset >= range->size_of_raw_data || begin >= data_.size()) {
+                return std::span<char const>();
+            }
+
+            size_t const available = std::min<size_t>(range->size_of_raw_data - offset, data_.size() - begin);
+            return data_.subspan(begin, std::min(size, available));
+        }
+
+        ///
+        /// @brief Returns the null terminated string at a relative virtual address
+        /// @return an empty string if the address is not in the data of a section
+        ///
+        [[nodiscard]] constexpr auto
+        string(uint32_t const rva) const noexcept -> std::string_view
+        {
+            auto const bytes = data(rva);
+            size_t size = 0;
+            while(size < bytes.size() && bytes[size] != '\0') {
+                ++size;
+            }
+            return std::string_view(bytes.data(), size);
+        }
+
+        ///
+        /// @brief Returns the section containing a relative virtual address
+        /// @return nullptr if no section contains the address
+        ///
+        [[nodiscard]] constexpr auto
+        find(uint32_t const rva) const noexcept -> Range const *
+        {
+            auto it = std::ranges::upper_bound(ranges_, rva, {}, &Range::virtual_address);
+            if(it == ranges_.begin()) {
+                return nullptr;
+            }
+
+            --it;
+            if(rva - it->virtual_address >= it->virtual_size) {
+                return nullptr;
+            }
+            return &*it;
+        }
+
+        ///
+        /// @brief Returns the sections sorted by their virtual address
+        ///
+        [[nodiscard]] constexpr auto
+        ranges() const noexcept -> std::span<Range const>
+        {
+            return ranges_;
+        }
+
+    private:
+        /// @brief the binary data of a .exe file
+        std::span<char const> data_;
+        std::vector<Range> ranges_;
+    };
+}
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "section_header.hpp"
+#include <algorithm>
 
 namespace pei 
 {   
@@ -53,8 +54,9 @@ namespace pei
         [[nodiscard]] constexpr auto
         find_section(std::string_view const name) const noexcept -> SectionHeader 
         {   
-            for(size_t i = 0; i < number_of_sections(); ++i) {
-                auto const section = get_section(i);
+            size_t const count = number_of_sections();
+            for(size_t i = 0; i < count; ++i) {
+                SectionHeader const section(data_, i);
 
                 if(section.name() == name) {
                     return section;
@@ -64,14 +66,62 @@ namespace pei
             return SectionHeader(data_, 0);
         }
 
+        /// 
+        /// @brief Returns the data of the section with the given name
+        /// @param name the name of the section
+        /// @return the data of the section or an empty span if there is no such section
+        ///
+        [[nodiscard]] constexpr auto
+        find_section_data(std::string_view const name) const noexcept -> std::span<char const> 
+        {   
+            size_t const count = number_of_sections();
+            for(size_t i = 0; i < count; ++i) {
+                SectionHeader const section(data_, i);
+
+                if(section.name() == name) {
+                    return section.data();
+                }
+            }
+
+            return std::span<char const>();
+        }
+
         /// 
         /// @brief Returns the number of sections
+        /// @return the number of section headers inside the data, less than the number in the file header if
+        ///     the file is truncated and 0 if the headers in front of the section table are not inside the data
         ///
         [[nodiscard]] constexpr auto
         number_of_sections() const noexcept -> uint32_t 
         {   
+            OptionalHeader const optional_header(data_);
+            if(!optional_header.is_complete()) {
+                return 0;
+            }
+
+            size_t const begin = size_t{optional_header.base_index()} + optional_header.size();
+            size_t const present = (data_.size() - begin) / sizeof(SectionHeader::DataStructure);
+            FileHeader const file_header(data_);
+            return static_cast<uint32_t>(std::min<size_t>(file_header.number_of_sections(), present));
+        }
+
+        /// 
+        /// @brief Returns true if the headers up to the end of the section table are inside the data
+        /// @details An image starts with the MS-DOS stub "MZ", its address of the new .exe header points to
+        ///     the signature "PE\0\0" in front of the COFF file header. An object file starts with the COFF
+        ///     file header. Check this before the headers of a file of unknown origin are used.
+        ///
+        [[nodiscard]] constexpr auto
+        is_valid() const noexcept -> bool 
+        {
+            DosHeader const dos_header(data_);
+            if(dos_header.is_image() && !dos_header.has_image_signature()) {
+                return false;
+            }
+
+            OptionalHeader const optional_header(data_);
             FileHeader const file_header(data_);
-            return file_header.number_of_sections();
+            return optional_header.is_complete() && number_of_sections() == file_header.number_of_sections();
         }
 
     private:
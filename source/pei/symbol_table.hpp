@@ -0,0 +1,520 @@
+///
+/// @file:   symbol_table.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Portable Executable File Formant, the COFF symbol table
+/// @details: https://docs.microsoft.com/en-us/windows/win32/debug/pe-format#coff-symbol-table
+///
+
+#pragma once
+
+#include "section_table.hpp"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace pei
+{
+    /// @brief The storage classes of a symbol used by the symbol index
+    enum class StorageClass : uint8_t
+    {
+        external = 2,
+        static_ = 3,
+        label = 6,
+        function = 101,
+        file = 103
+    };
+
+    /// @class pei::Symbol
+    ///
+    /// @brief A record of the COFF symbol table, followed by its auxiliary records
+    /// @details The records are 18 bytes long without padding, the offsets of the fields are those of
+    ///     the DataStructure but not its size.
+    ///
+    class Symbol final
+    {
+    public:
+        struct DataStructure final
+        {
+            /// @brief The name of the symbol, 8 null-padded characters, or 4 zero bytes followed by
+            ///     the offset of the name in the string table
+            char name[8];
+            /// @brief The value of the symbol, for a symbol in a section the offset in the section
+            uint32_t value;
+            /// @brief The one-based index of the section, 0 for undefined, -1 for absolute and -2 for
+            ///     debugging symbols
+            int16_t section_number;
+            /// @brief The type, 0x20 in the upper byte for a function
+            uint16_t type;
+            /// @brief The storage class, see pei::StorageClass
+            uint8_t storage_class;
+            /// @brief The number of auxiliary records following this record
+            uint8_t number_of_aux_symbols;
+        };
+        static_assert(std::is_standard_layout_v<DataStructure>);
+
+        /// @brief The size of a record of the symbol table
+        static constexpr size_t record_size = 18;
+
+        ///
+        /// @brief constructor
+        /// @param data the complete data of a binary .exe file
+        /// @param index the index of the record in the symbol table
+        ///
+        constexpr Symbol(std::span<char const> const data, size_t const index) noexcept
+            : data_(data), index_(index), base_index_(read_base_index(data, index)) {}
+
+        ///
+        /// @brief Returns the name of the symbol, short names are stored in the record, long names in the
+        ///     string table
+        ///
+        [[nodiscard]] constexpr auto
+        name() const noexcept -> std::string_view
+        {
+            auto const index = base_index() + offsetof(DataStructure, name);
+            if(!is_valid()) {
+                return std::string_view();
+            }
+
+            if(details::bit_cast<uint32_t>(data_, index) != 0) {
+                size_t size = 0;
+                while(size < sizeof(DataStructure::name) && data_[index + size] != '\0') {
+                    ++size;
+                }
+                return std::string_view(&data_[index], size);
+            }
+
+            // name is located in the string table
+            return string_table_entry(details::bit_cast<uint32_t>(data_, index + 4));
+        }
+
+        ///
+        /// @brief The value of the symbol, for a symbol in a section the offset in the section
+        ///
+        [[nodiscard]] constexpr auto
+        value() const noexcept -> decltype(DataStructure::value)
+        {
+            return read<decltype(DataStructure::value)>(offsetof(DataStructure, value));
+        }
+
+        ///
+        /// @brief The one-based index of the section, 0 for undefined, -1 for absolute and -2 for
+        ///     debugging symbols
+        ///
+        [[nodiscard]] constexpr auto
+        section_number() const noexcept -> decltype(DataStructure::section_number)
+        {
+            return read<decltype(DataStructure::section_number)>(offsetof(DataStructure, section_number));
+        }
+
+        [[nodiscard]] constexpr auto
+        type() const noexcept -> decltype(DataStructure::type)
+        {
+            return read<decltype(DataStructure::type)>(offsetof(DataStructure, type));
+        }
+
+        [[nodiscard]] constexpr auto
+        storage_class() const noexcept -> StorageClass
+        {
+            return static_cast<StorageClass>(read<decltype(DataStructure::storage_class)>(offsetof(DataStructure, storage_class)));
+        }
+
+        [[nodiscard]] constexpr auto
+        number_of_aux_symbols() const noexcept -> decltype(DataStructure::number_of_aux_symbols)
+        {
+            return read<decltype(DataStructure::number_of_aux_symbols)>(offsetof(DataStructure, number_of_aux_symbols));
+        }
+
+        ///
+        /// @brief Returns true if the type of the symbol is a function
+        ///
+        [[nodiscard]] constexpr auto
+        is_function() const noexcept -> bool
+        {
+            return (type() >> 4) == 0x2;
+        }
+
+        ///
+        /// @brief Returns true if the symbol defines a section, a static symbol with an auxiliary record
+        ///     that is not a function
+        ///
+        [[nodiscard]] constexpr auto
+        is_section_definition() const noexcept -> bool
+        {
+            return storage_class() == StorageClass::static_ && number_of_aux_symbols() != 0 && !is_function();
+        }
+
+        ///
+        /// @brief Returns an auxiliary record of the symbol
+        /// @param index the index of the auxiliary record, less than number_of_aux_symbols()
+        /// @return the 18 bytes of the record, empty if there is no such record
+        ///
+        [[nodiscard]] constexpr auto
+        aux_record(size_t const index) const noexcept -> std::span<char const>
+        {
+            size_t const begin = base_index() + (index + 1) * record_size;
+            if(index >= number_of_aux_symbols() || begin + record_size > data_.size()) {
+                return std::span<char const>();
+            }
+
+            return data_.subspan(begin, record_size);
+        }
+
+        ///
+        /// @brief Returns the file name of a file symbol, stored in its auxiliary records
+        ///
+        [[nodiscard]] constexpr auto
+        file_name() const noexcept -> std::string_view
+        {
+            if(storage_class() != StorageClass::file || number_of_aux_symbols() == 0) {
+                return std::string_view();
+            }
+
+            auto const records = aux_record(0);
+            if(records.empty()) {
+                return std::string_view();
+            }
+
+            // long names are located in the string table like the names of symbols
+            if(details::bit_cast<uint32_t>(records, 0) == 0) {
+                return string_table_entry(details::bit_cast<uint32_t>(records, 4));
+            }
+
+            // the name continues over all auxiliary records
+            size_t const begin = base_index() + record_size;
+            size_t const capacity = std::min(size_t{number_of_aux_symbols()} * record_size, data_.size() - begin);
+            size_t size = 0;
+            while(size < capacity && data_[begin + size] != '\0') {
+                ++size;
+            }
+            return std::string_view(&data_[begin], size);
+        }
+
+        ///
+        /// @brief Returns the size of the code of a function, stored in its auxiliary record
+        /// @return 0 if not known, MinGW does not fill the size in
+        ///
+        [[nodiscard]] constexpr auto
+        function_size() const noexcept -> uint32_t
+        {
+            auto const record = aux_record(0);
+            if(!is_function() || record.empty()) {
+                return 0;
+            }
+
+            // tag index, total size
+            return details::bit_cast<uint32_t>(record, 4);
+        }
+
+        ///
+        /// @brief Returns the size of the section of a section definition, stored in its auxiliary record
+        ///
+        [[nodiscard]] constexpr auto
+        section_length() const noexcept -> uint32_t
+        {
+            auto const record = aux_record(0);
+            if(!is_section_definition() || record.empty()) {
+                return 0;
+            }
+
+            return details::bit_cast<uint32_t>(record, 0);
+        }
+
+        ///
+        /// @brief Returns the index of the record in the symbol table
+        ///
+        [[nodiscard]] constexpr auto
+        index() const noexcept -> size_t
+        {
+            return index_;
+        }
+
+        ///
+        /// @brief Returns the index of the next symbol, behind the auxiliary records
+        ///
+        [[nodiscard]] constexpr auto
+        next_index() const noexcept -> size_t
+        {
+            return index_ + 1 + number_of_aux_symbols();
+        }
+
+        ///
+        /// @brief Returns true if the record is within the data
+        ///
+        [[nodiscard]] constexpr auto
+        is_valid() const noexcept -> bool
+        {
+            return base_index_ != 0 && base_index_ + record_size <= data_.size();
+        }
+
+        ///
+        /// @brief Returns the address of the start of the record
+        ///
+        [[nodiscard]] constexpr auto
+        base_index() const noexcept -> size_t
+        {
+            return base_index_;
+        }
+
+    private:
+        /// @brief the binary data of a .exe file
+        std::span<char const> data_;
+        /// @brief the index of the record in the symbol table
+        size_t index_;
+        /// @brief the address of the start of the record
+        size_t base_index_;
+
+        ///
+        /// @brief Returns the null terminated string at an offset of the string table
+        ///
+        [[nodiscard]] constexpr auto
+        string_table_entry(uint32_t const offset) const noexcept -> std::string_view
+        {
+            FileHeader const file_header(data_);
+            size_t const begin = size_t{file_header.string_table_address()} + offset;
+            if(begin >= data_.size()) {
+                return std::string_view();
+            }
+
+            size_t size = 0;
+            while(begin + size < data_.size() && data_[begin + size] != '\0') {
+                ++size;
+            }
+            return std::string_view(&data_[begin], size);
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        read(size_t const offset) const noexcept -> T
+        {
+            if(!is_valid()) {
+                return T();
+            }
+            return details::bit_cast<T>(data_, base_index() + offset);
+        }
+
+        [[nodiscard]] static constexpr auto
+        read_base_index(std::span<char const> const data, size_t const index) noexcept -> size_t
+        {
+            FileHeader const file_header(data);
+            return size_t{file_header.pointer_to_symbol_table()} + index * record_size;
+        }
+    };
+
+    /// @class pei::SymbolTable
+    ///
+    /// @brief The COFF symbol table, iterated symbol by symbol skipping the auxiliary records
+    /// @details Images should not have a symbol table, but the images of MinGW have one.
+    ///
+    class SymbolTable final
+    {
+    public:
+        class Iterator final
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Symbol;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr Iterator() noexcept = default;
+            constexpr Iterator(std::span<char const> const data, size_t const index, size_t const end) noexcept
+                : data_(data), index_(index), end_(end) {}
+
+            [[nodiscard]] constexpr auto
+            operator*() const noexcept -> Symbol
+            {
+                return Symbol(data_, index_);
+            }
+
+            constexpr auto
+            operator++() noexcept -> Iterator &
+            {
+                index_ = Symbol(data_, index_).next_index();
+                return *this;
+            }
+
+            constexpr auto
+            operator++(int) noexcept -> Iterator
+            {
+                auto const res = *this;
+                ++*this;
+                return res;
+            }
+
+            /// @brief Iterators compare by index, an iterator past the end equals end()
+            [[nodiscard]] constexpr auto
+            operator==(Iterator const & other) const noexcept -> bool
+            {
+                return std::min(index_, end_) == std::min(other.index_, other.end_);
+            }
+
+        private:
+            std::span<char const> data_ = {};
+            size_t index_ = 0;
+            /// @brief the number of records of the symbol table
+            size_t end_ = 0;
+        };
+
+        ///
+        /// @brief constructor
+        /// @param data the complete data of a binary .exe file
+        ///
+        constexpr SymbolTable(std::span<char const> const data) noexcept : data_(data) {}
+
+        ///
+        /// @brief Returns the number of records, including the auxiliary records
+        /// @return 0 if there is no symbol table or it or the file header is not within the data
+        ///
+        [[nodiscard]] constexpr auto
+        number_of_symbols() const noexcept -> size_t
+        {
+            FileHeader const file_header(data_);
+            if(!file_header.is_complete()) {
+                return 0;
+            }
+
+            size_t const begin = file_header.pointer_to_symbol_table();
+            size_t const count = file_header.number_of_symbols();
+            if(begin == 0 || begin + count * Symbol::record_size > data_.size()) {
+                return 0;
+            }
+            return count;
+        }
+
+        ///
+        /// @brief Returns the record at an index, which may be an auxiliary record
+        ///
+        [[nodiscard]] constexpr auto
+        get_symbol(size_t const index) const noexcept -> Symbol
+        {
+            return Symbol(data_, index);
+        }
+
+        [[nodiscard]] constexpr auto
+        begin() const noexcept -> Iterator
+        {
+            return Iterator(data_, 0, number_of_symbols());
+        }
+
+        [[nodiscard]] constexpr auto
+        end() const noexcept -> Iterator
+        {
+            auto const count = number_of_symbols();
+            return Iterator(data_, count, count);
+        }
+
+    private:
+        /// @brief the binary data of a .exe file
+        std::span<char const> const data_;
+    };
+
+    /// @class pei::SymbolIndex
+    ///
+    /// @brief The symbols defined in sections sorted by their address, to find the symbol containing an
+    ///     address in O(log n) without debug information
+    /// @details A symbol ends at the next symbol of its section or at the end of the section. Section
+    ///     definitions, files and debugging symbols are not indexed.
+    ///
+    class SymbolIndex final
+    {
+    public:
+        struct Entry final
+        {
+            /// @brief The address of the symbol in the image as linked, with the preferred image base
+            uint64_t address = 0;
+            uint64_t size = 0;
+            /// @brief Points into the data of the image
+            std::string_view name = {};
+            /// @brief The one-based index of the section
+            int16_t section_number = 0;
+            bool is_function = false;
+            bool is_external = false;
+        };
+
+        constexpr SymbolIndex() noexcept = default;
+
+        ///
+        /// @brief Builds the index of all symbols of an image
+        /// @param data the complete data of a binary .exe file
+        ///
+        constexpr explicit SymbolIndex(std::span<char const> const data)
+        {
+            SymbolTable const symbol_table(data);
+            SectionTable const section_table(data);
+            auto const number_of_sections = section_table.number_of_sections();
+            OptionalHeader const optional_header(data);
+            uint64_t const image_base = optional_header.image_base();
+
+            for(Symbol const symbol : symbol_table) {
+                auto const section_number = symbol.section_number();
+                auto const storage_class = symbol.storage_class();
+                bool const is_indexed = storage_class == StorageClass::external || storage_class == StorageClass::static_
+                    || storage_class == StorageClass::label;
+                if(!is_indexed || section_number <= 0 || static_cast<uint32_t>(section_number) > number_of_sections
+                    || symbol.is_section_definition()) {
+                    continue;
+                }
+
+                auto const section = section_table.get_section(static_cast<size_t>(section_number - 1));
+                entries_.push_back({image_base + section.virtual_address() + symbol.value(), 0, symbol.name(), section_number,
+                    symbol.is_function(), storage_class == StorageClass::external});
+            }
+
+            // of symbols at the same address the external one is found
+            std::ranges::sort(entries_, [](Entry const & lhs, Entry const & rhs) {
+                return lhs.address != rhs.address ? lhs.address < rhs.address : lhs.is_external < rhs.is_external;
+            });
+
+            for(size_t i = 0; i < entries_.size(); ++i) {
+                auto const section = section_table.get_section(static_cast<size_t>(entries_[i].section_number - 1));
+                uint64_t end = image_base + section.virtual_address() + std::max(section.virtual_size(), section.size_of_raw_data());
+                for(size_t next = i + 1; next < entries_.size(); ++next) {
+                    if(entries_[next].address != entries_[i].address) {
+                        if(entries_[next].section_number == entries_[i].section_number) {
+                            end = std::min(end, entries_[next].address);
+                        }
+                        break;
+                    }
+                }
+                entries_[i].size = end > entries_[i].address ? end - entries_[i].address : 0;
+            }
+        }
+
+        ///
+        /// @brief Returns the symbol containing an address
+        /// @return nullptr if no symbol contains the address
+        ///
+        [[nodiscard]] constexpr auto
+        find(uint64_t const address) const noexcept -> Entry const *
+        {
+            auto it = std::ranges::upper_bound(entries_, address, {}, &Entry::address);
+            if(it == entries_.begin()) {
+                return nullptr;
+            }
+
+            --it;
+            if(address >= it->address + it->size) {
+                return nullptr;
+            }
+            return &*it;
+        }
+
+        ///
+        /// @brief Returns the indexed symbols sorted by address
+        ///
+        [[nodiscard]] constexpr auto
+        entries() const noexcept -> std::span<Entry const>
+        {
+            return entries_;
+        }
+
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_t
+        {
+            return entries_.size();
+        }
+
+    private:
+        std::vector<Entry> entries_;
+    };
+}
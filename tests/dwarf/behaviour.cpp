@@ -12,8 +12,59 @@
 #include "dwarf/debug_info/unit_header/unit_header.hpp"
 #include "dwarf/debug_info/unit_header/full_and_partial_compilation_unit_header.hpp"
 #include "dwarf/debug_info/debug_info.hpp"
+#include "dwarf/types/type_graph.hpp"
+#include "dwarf/types/type_layout.hpp"
+#include "dwarf/types/column_decoder.hpp"
+#include "dwarf/types/schema.hpp"
+#include "dwarf/image_arena.hpp"
+#include "dwarf/debug_info/die_tree.hpp"
+#include "dwarf/split_dwarf/dwo_resolver.hpp"
+#include "dwarf/split_dwarf/dwarf_package.hpp"
+#include "dwarf/debug_info/type_signature_index.hpp"
+#include "dwarf/section_cache.hpp"
+#include "dwarf/debug_info/unit_stream.hpp"
+#include "dwarf/debug_info/incremental_index.hpp"
+#include "dwarf/symbolizer/symbolizer_server.hpp"
+#include "dwarf/dump/dwarf_dump.hpp"
+#include "dwarf/debug_macro/debug_macro.hpp"
+#include "dwarf/debug_info/traversal.hpp"
+#include "dwarf/debug_line/line_program.hpp"
+#include "dwarf_fixture.hpp"
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <ranges>
+#include <sstream>
+#include <thread>
+
+namespace compile_time
+{
+    // The layout of the example program extracted at compile time
+    constexpr std::span<char const> example(tests_example_program_example_program_exe);
+
+    constexpr auto color_printer = dwarf::static_layout<dwarf::static_layout_size(example, "ColorPrinter")>(example, "ColorPrinter");
+    static_assert(color_printer.size() == 1);
+    static_assert(color_printer[0].path() == "color_");
+    static_assert(color_printer[0].offset == 0);
+    static_assert(color_printer[0].byte_size == 1);
+    static_assert(color_printer[0].encoding == dwarf::BaseTypeAttributeEncoding::dw_ate_unsigned_char);
+
+    constexpr auto colors = dwarf::enumerators<dwarf::enumerator_count(example, "Color")>(example, "Color");
+    static_assert(colors.size() == 3);
+    static_assert(colors[0].name == "red" && colors[0].value == 0);
+    static_assert(colors[1].name == "green" && colors[1].value == 1);
+    static_assert(colors[2].name == "blue" && colors[2].value == 2);
+
+    static_assert(dwarf::symbol_address(example, "color_printer") == 0x1400090a0);
+
+    static_assert(dwarf::form_table[static_cast<uint8_t>(dwarf::Form::dw_form_data4)].size_class == dwarf::FormSizeClass::fixed);
+    static_assert(dwarf::form_table[static_cast<uint8_t>(dwarf::Form::dw_form_data4)].size == 4);
+    static_assert(dwarf::form_table[static_cast<uint8_t>(dwarf::Form::dw_form_exprloc)].size_class == dwarf::FormSizeClass::block);
+    static_assert(dwarf::form_table[static_cast<uint8_t>(dwarf::Form::dw_form_reserved1)].decode == nullptr);
+    static_assert(dwarf::form_table[0xff].size_class == dwarf::FormSizeClass::invalid);
+}
 
 constexpr auto
 tests() noexcept -> bool
@@ -42,6 +93,16 @@ tests() noexcept -> bool
             std::cout << parser << std::endl;
         };
 
+        // the tags of GNU extensions, e.g. DW_TAG_GNU_template_parameter_pack, take 3 bytes
+        ut::Given() = [&]() noexcept {
+            constexpr std::array<char, 8> table = {1, char(0x87), char(0x82), 0x01, 0, 0, 0, 0};
+            dwarf::DebugAbbrevTable const abbrev_table(table, 0);
+            ut::Then() = [&]() noexcept {
+                ut::check(abbrev_table.find(1) != nullptr);
+                ut::check(abbrev_table.find(1)->tag() == static_cast<dwarf::Tag>(0x4107));
+            };
+        };
+
         // ut::Given() = [&]() noexcept{
         //     constexpr dwarf::UnitHeader unit_header(debug_info);
 
@@ -111,6 +172,1677 @@ tests() noexcept -> bool
 
     };
 
+    ut::Scenario("type_graph") = []() noexcept
+    {
+        std::span<char const> const data(tests_example_program_example_program_exe);
+        dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+
+        ut::Given() = [&]() noexcept {
+            dwarf::TypeGraph const type_graph(sections);
+
+            ut::Then() = [&]() noexcept {
+                auto const id = type_graph.find("ColorPrinter");
+                ut::check(id != dwarf::invalid_type_id);
+
+                auto const & type = type_graph.node(id);
+                ut::check(type.tag == dwarf::Tag::dw_tag_class_type);
+                ut::check(type.byte_size == 1);
+
+                auto const members = type_graph.members(id);
+                ut::check(members.size() == 1);
+                ut::assert_eq(members[0].name, "color_");
+                ut::check(members[0].value == 0);
+                ut::check(type_graph.node(members[0].type).tag == dwarf::Tag::dw_tag_enumeration_type);
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const statistics = type_graph.statistics();
+                ut::check(statistics.units == 3);
+                ut::check(statistics.types > 0);
+                ut::check(statistics.types < statistics.type_entries);
+                ut::check(statistics.members <= statistics.member_entries);
+            };
+
+            ut::Then() = [&]() noexcept {
+                dwarf::TypeGraph type_graph_twice(sections);
+                for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                    dwarf::Unit const unit(sections, unit_header);
+                    type_graph_twice.add_unit(unit);
+                }
+
+                auto const statistics = type_graph_twice.statistics();
+                ut::check(statistics.units == 6);
+                ut::check(statistics.types == type_graph.size());
+                ut::check(statistics.bytes < statistics.per_unit_bytes);
+
+                auto const id = type_graph.find("ColorPrinter");
+                ut::check(type_graph_twice.find("ColorPrinter") == id);
+            };
+        };
+
+        ut::Given() = [&]() noexcept {
+            auto const data = fixture::make_struct_units({
+                {{"a", "int", 0}, {"b", "int", 4}},
+                {{"a", "int", 0}, {"b", "int", 4}},
+                {{"a", "int", 0}, {"b", "float", 4}},
+                {{"x", "int", 0}},
+                {{"next", "Foo*", 0}, {"b", "int", 8}},
+                {{"next", "Foo*", 0}, {"b", "int", 8}}
+            });
+            dwarf::DebugSections const struct_sections = data.sections();
+
+            std::vector<size_t> struct_offsets = {};
+            for(dwarf::DIE const die : dwarf::dies(struct_sections)) {
+                if(die.tag() == dwarf::Tag::dw_tag_structure_type) {
+                    struct_offsets.push_back(die.offset());
+                }
+            }
+
+            ut::Then() = [&]() noexcept {
+                dwarf::TypeGraph const type_graph(struct_sections);
+                ut::check(struct_offsets.size() == 6);
+
+                std::vector<dwarf::TypeId> ids = {};
+                for(size_t const offset : struct_offsets) {
+                    ids.push_back(type_graph.type_of(offset));
+                }
+
+                // the same definition is stored once, different ones of the same name are kept apart
+                ut::check(ids[0] != dwarf::invalid_type_id);
+                ut::check(ids[1] == ids[0]);
+                ut::check(ids[2] != ids[0]);
+                ut::check(ids[3] != ids[0] && ids[3] != ids[2]);
+                ut::check(ids[4] != ids[0] && ids[4] != ids[2] && ids[4] != ids[3]);
+                ut::check(ids[5] == ids[4]);
+
+                ut::check(type_graph.node(ids[2]).byte_size == 8);
+                ut::check(type_graph.node(type_graph.members(ids[2])[1].type).encoding == dwarf::BaseTypeAttributeEncoding::dw_ate_float_);
+                ut::check(type_graph.node(ids[3]).byte_size == 4);
+                ut::check(type_graph.members(ids[3]).size() == 1);
+
+                auto const next = type_graph.members(ids[4])[0].type;
+                ut::check(type_graph.node(next).tag == dwarf::Tag::dw_tag_pointer_type);
+                ut::check(type_graph.node(next).type == ids[4]);
+
+                ut::check(type_graph.find("Foo") == ids[0]);
+            };
+
+            ut::Then() = [&]() noexcept {
+                dwarf::TypeGraph const type_graph(struct_sections);
+
+                // adds the units in reverse order
+                dwarf::TypeGraph reversed;
+                std::vector<dwarf::UnitHeader> unit_headers = {};
+                for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(struct_sections.debug_info)) {
+                    unit_headers.push_back(unit_header);
+                }
+                for(auto it = unit_headers.rbegin(); it != unit_headers.rend(); ++it) {
+                    dwarf::Unit const unit(struct_sections, *it);
+                    reversed.add_unit(unit);
+                }
+
+                ut::check(reversed.size() == type_graph.size());
+                for(size_t const offset : struct_offsets) {
+                    auto const id = reversed.type_of(offset);
+                    ut::check(id != dwarf::invalid_type_id);
+                    ut::check(reversed.qualified_name(id) == "Foo");
+                    ut::check(reversed.node(id).byte_size == type_graph.node(type_graph.type_of(offset)).byte_size);
+                }
+                ut::check(reversed.type_of(struct_offsets[0]) == reversed.type_of(struct_offsets[1]));
+                ut::check(reversed.type_of(struct_offsets[4]) == reversed.type_of(struct_offsets[5]));
+            };
+        };
+    };
+
+    ut::Scenario("type_layout") = []() noexcept
+    {
+        std::span<char const> const data(tests_example_program_example_program_exe);
+        dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+        dwarf::TypeGraph const type_graph(sections);
+
+        ut::Given() = [&]() noexcept {
+            dwarf::TypeLayouts type_layouts(type_graph);
+
+            ut::Then() = [&]() noexcept {
+                auto const layout = type_layouts.layout("ColorPrinter");
+                ut::check(layout.size() == 1);
+                ut::assert_eq(layout[0].path, "color_");
+                ut::check(layout[0].offset == 0);
+                ut::check(layout[0].byte_size == 1);
+                ut::check(layout[0].encoding == dwarf::BaseTypeAttributeEncoding::dw_ate_unsigned_char);
+
+                std::array<char, 1> const object = {2};
+                ut::check(layout[0].extract(object) == 2);
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const layout = type_layouts.layout("tm");
+                ut::check(layout.size() == 9);
+                ut::assert_eq(layout[8].path, "tm_isdst");
+                ut::check(layout[8].offset == 32);
+                ut::check(layout[8].is_signed());
+
+                std::array<char, 36> object = {};
+                object[32] = -1;
+                object[33] = -1;
+                object[34] = -1;
+                object[35] = -1;
+                ut::check(static_cast<int64_t>(layout[8].extract(object)) == -1);
+
+                // memoized
+                ut::check(type_layouts.layout("tm").data() == layout.data());
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const layout = type_layouts.layout("ColorPrinter");
+
+                std::array<char, 20> const elements = {0, 1, 2, 1, 0, 2, 2, 1, 0, 0, 1, 2, 1, 0, 2, 2, 1, 0, 1, 2};
+                std::array<uint32_t, 20> column = {};
+                ut::check(dwarf::decode_column<uint32_t>(elements, 1, layout[0], column) == 20);
+                for(size_t i = 0; i < elements.size(); ++i) {
+                    ut::check(column[i] == static_cast<uint32_t>(elements[i]));
+                }
+            };
+        };
+
+        ut::Given() = [&]() noexcept {
+            // the offset of the last array type entry
+            auto const last_array = [](dwarf::DebugSections const & struct_sections) {
+                size_t res = 0;
+                for(dwarf::DIE const die : dwarf::dies(struct_sections)) {
+                    if(die.tag() == dwarf::Tag::dw_tag_array_type) {
+                        res = die.offset();
+                    }
+                }
+                return res;
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const data = fixture::make_struct_units({{{"buf", "char[1048576]", 0}}});
+                dwarf::TypeGraph const struct_graph(data.sections());
+                dwarf::TypeLayouts struct_layouts(struct_graph);
+
+                auto const layout = struct_layouts.layout("Foo");
+                ut::check(layout.size() == 1);
+                ut::assert_eq(layout[0].path, "buf[1048576]");
+                ut::check(layout[0].count == 1048576);
+                ut::check(layout[0].stride == 1);
+                ut::check(layout[0].dimensions == 1);
+                ut::assert_eq(layout[0].element_path(1000), "buf[1000]");
+
+                std::array<char, 4> const object = {1, 2, 3, 4};
+                ut::check(layout[0].extract(object, 2) == 3);
+                ut::check(layout[0].extract(object, 4) == 0);
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const data = fixture::make_struct_units({{{"m", "int[2][3]", 0}}}, {"Foo[4]"});
+                dwarf::DebugSections const struct_sections = data.sections();
+                dwarf::TypeGraph const struct_graph(struct_sections);
+                dwarf::TypeLayouts struct_layouts(struct_graph);
+
+                // the arrays of the elements are contiguous
+                auto const layout = struct_layouts.layout(struct_graph.type_of(last_array(struct_sections)));
+                ut::check(layout.size() == 1);
+                ut::assert_eq(layout[0].path, "[4].m[2][3]");
+                ut::check(layout[0].count == 24);
+                ut::check(layout[0].stride == 4);
+                ut::assert_eq(layout[0].element_path(23), "[3].m[1][2]");
+                ut::assert_eq(layout[0].element_path(7), "[1].m[0][1]");
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const data = fixture::make_struct_units({{{"a", "int", 0}, {"m", "int[2][3]", 4}}}, {"Foo[4]"});
+                dwarf::DebugSections const struct_sections = data.sections();
+                dwarf::TypeGraph const struct_graph(struct_sections);
+                dwarf::TypeLayouts struct_layouts(struct_graph);
+
+                // the arrays of an element are repeated for each element
+                auto const layout = struct_layouts.layout(struct_graph.type_of(last_array(struct_sections)));
+                ut::check(layout.size() == 5);
+                ut::assert_eq(layout[0].path, "[4].a");
+                ut::check(layout[0].count == 4);
+                ut::check(layout[0].stride == 28);
+                ut::assert_eq(layout[2].path, "[1].m[2][3]");
+                ut::check(layout[2].offset == 32);
+                ut::check(layout[2].count == 6);
+                ut::assert_eq(layout[2].element_path(4), "[1].m[1][1]");
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const data = fixture::make_struct_units({{{"a", "int", 0}, {"x", "int[4294967295][4294967295][4294967295]", 4}}});
+                dwarf::DebugSections const struct_sections = data.sections();
+                dwarf::TypeGraph const struct_graph(struct_sections);
+                dwarf::TypeLayouts struct_layouts(struct_graph);
+
+                // too many elements
+                auto const layout = struct_layouts.layout("Foo");
+                ut::check(layout.size() == 1);
+                ut::assert_eq(layout[0].path, "a");
+                ut::check(struct_layouts.byte_size(struct_graph.type_of(last_array(struct_sections))) == 0);
+            };
+        };
+    };
+
+    ut::Scenario("image_arena") = []() noexcept
+    {
+        ut::Given() = [&]() noexcept {
+            dwarf::CountingResource upstream;
+            dwarf::ImageArena arena(&upstream, 1024);
+
+            ut::Then() = [&]() noexcept {
+                std::string const name = "color_";
+                auto const first = arena.intern(name);
+                auto const second = arena.intern(std::string_view("color_printer").substr(0, 6));
+                ut::assert_eq(first, "color_");
+                ut::check(first.data() == second.data());
+                ut::check(first.data() != name.data());
+                ut::check(arena.string_count() == 1);
+            };
+
+            ut::Then() = [&]() noexcept {
+                for(size_t i = 0; i < 1000; ++i) {
+                    auto * const p = arena.create<std::pair<uint64_t, uint32_t>>(i, static_cast<uint32_t>(i));
+                    ut::check(p->first == i);
+                }
+                std::pmr::vector<uint32_t> values(arena.resource());
+                values.resize(100);
+
+                ut::check(arena.object_count() == 1000);
+                ut::check(arena.upstream_allocation_count() < 20);
+                ut::check(arena.upstream_allocation_count() == upstream.allocation_count());
+            };
+
+            ut::Then() = [&]() noexcept {
+                arena.release();
+                ut::check(arena.object_count() == 0);
+                ut::check(arena.string_count() == 0);
+                ut::assert_eq(arena.intern("red"), "red");
+            };
+        };
+    };
+
+    ut::Scenario("die_tree") = []() noexcept
+    {
+        std::span<char const> const data(tests_example_program_example_program_exe);
+        dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+
+        ut::Given() = [&]() noexcept {
+            dwarf::DieTree const tree(sections);
+
+            ut::Then() = [&]() noexcept {
+                size_t count = 0;
+                for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                    dwarf::Unit const unit(sections, unit_header);
+                    dwarf::DieCursor cursor(unit);
+                    while(cursor.next()) {
+                        ++count;
+                    }
+                }
+
+                ut::check(tree.size() == count);
+                ut::check(tree.unit_count() == 3);
+                ut::check(tree.abbrevs().size() < tree.size());
+                ut::check(tree.bytes() == tree.size() * (sizeof(dwarf::DieAbbrevIndex) + 3 * sizeof(uint32_t)) + tree.abbrevs().size() * sizeof(dwarf::DieAbbrev));
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const root = tree.unit_root(0);
+                ut::check(tree.tag(root) == dwarf::Tag::dw_tag_compile_unit);
+                ut::check(tree.parent(root) == dwarf::invalid_die_index);
+
+                // the class ColorPrinter is a child of the unit entry
+                auto class_index = dwarf::invalid_die_index;
+                for(auto i = tree.first_child(root); i != dwarf::invalid_die_index; i = tree.next_sibling(i)) {
+                    ut::check(tree.parent(i) == root);
+                    if(tree.tag(i) != dwarf::Tag::dw_tag_class_type) {
+                        continue;
+                    }
+                    tree.die(i).for_each_attribute([&](dwarf::AttributeSpecification const & specification, dwarf::AttributeValue const & value) {
+                        if(specification.attribute == dwarf::Attribute::dw_at_name && value.as_string() == "ColorPrinter") {
+                            class_index = i;
+                        }
+                    });
+                }
+                ut::check(class_index != dwarf::invalid_die_index);
+
+                ut::check(tree.first_child(class_index) == class_index + 1);
+
+                // the member color_ follows the member functions
+                auto member = tree.first_child(class_index);
+                while(member != dwarf::invalid_die_index && tree.tag(member) != dwarf::Tag::dw_tag_member) {
+                    member = tree.next_sibling(member);
+                }
+                ut::check(member != dwarf::invalid_die_index);
+                ut::check(tree.parent(member) == class_index);
+                ut::check(tree.find(tree.offset(member)) == member);
+                ut::check(tree.find(tree.offset(member) + 1) == dwarf::invalid_die_index);
+                ut::check(tree.unit(member).offset() == 0);
+                ut::check(tree.die(member).abbrev()->code() == tree.abbrev_code(member));
+
+                // the code and the tag of every entry are those of its abbreviation
+                for(dwarf::DieIndex i = 0; i < tree.size(); ++i) {
+                    auto const die = tree.die(i);
+                    ut::check(tree.abbrev_code(i) == die.abbrev()->code());
+                    ut::check(tree.tag(i) == die.tag());
+                }
+            };
+
+            ut::Then() = [&]() noexcept {
+                dwarf::ImageArena arena;
+                dwarf::pmr::DieTree const arena_tree(sections, arena.resource());
+                ut::check(arena_tree.size() == tree.size());
+                ut::check(arena_tree.offset(tree.size() - 1) == tree.offset(tree.size() - 1));
+            };
+        };
+    };
+
+    ut::Scenario("die_attribute") = []() noexcept
+    {
+        std::span<char const> const data(tests_example_program_example_program_exe);
+        dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+
+        ut::Given() = [&]() noexcept {
+            dwarf::DieTree const tree(sections);
+
+            ut::Then() = [&]() noexcept {
+                // every attribute read directly equals the attribute read by scanning all attributes
+                for(dwarf::DieIndex i = 0; i < tree.size(); ++i) {
+                    auto const die = tree.die(i);
+                    auto const end_offset = die.for_each_attribute([&](dwarf::AttributeSpecification const & specification, dwarf::AttributeValue const & value) {
+                        auto const direct = die.attribute(specification.attribute);
+                        ut::check(direct.is_valid());
+                        ut::check(direct.form() == value.form());
+                        ut::check(direct.as_unsigned() == value.as_unsigned());
+                        ut::check(direct.as_block().data() == value.as_block().data());
+                    });
+
+                    ut::check(die.end_offset() == end_offset);
+                }
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const root = tree.unit_root(0);
+                auto const die = tree.die(root);
+                ut::check(die.attribute(dwarf::Attribute::dw_at_producer).as_string().starts_with("GNU"));
+                ut::check(!die.attribute(dwarf::Attribute::dw_at_bit_size).is_valid());
+            };
+
+            ut::Then() = [&]() noexcept {
+                // the table based decoder equals the switch based decoder
+                for(dwarf::DieIndex i = 0; i < tree.size(); ++i) {
+                    auto const die = tree.die(i);
+                    auto const & encoding = die.unit().encoding();
+                    size_t index = die.attributes_offset();
+                    size_t index_switch = index;
+
+                    for(auto const & specification : die.abbrev()->attributes()) {
+                        auto const value = dwarf::read_form(sections.debug_info, index, specification.form, specification.implicit_const, encoding);
+                        auto const expected = details::read_form_switch(sections.debug_info, index_switch, specification.form, specification.implicit_const, encoding);
+                        ut::check(index == index_switch);
+                        ut::check(value.form == expected.form);
+                        ut::check(value.value == expected.value);
+                        ut::check(value.block.data() == expected.block.data() && value.block.size() == expected.block.size());
+                    }
+                }
+            };
+        };
+    };
+
+
+    ut::Scenario("split_dwarf") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            auto const directory = std::filesystem::temp_directory_path() / "dwarf_split_dwarf_test";
+            std::filesystem::create_directories(directory / "obj");
+
+            auto const write_file = [](std::filesystem::path const & path, fixture::Bytes const & bytes) {
+                std::ofstream file(path, std::ios::binary);
+                file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            };
+            write_file(directory / "obj" / "a.dwo", fixture::make_dwo(0xa, "a.cpp", "int"));
+            write_file(directory / "obj" / "b.dwo", fixture::make_dwo(0xb, "b.cpp", "char"));
+            write_file(directory / "c.dwo", fixture::make_dwo(0xc, "c.cpp", "bool"));
+            write_file(directory / "wrong_id.dwo", fixture::make_dwo(0xf00, "d.cpp", "long"));
+
+            // the .dwo file of c is moved away from its recorded directory and found in a search directory
+            fixture::DebugSectionsData data;
+            fixture::append_skeleton_unit(data, 0xa, "obj/a.dwo", directory.string());
+            fixture::append_skeleton_unit(data, 0xb, "obj/b.dwo", directory.string());
+            fixture::append_skeleton_unit(data, 0xc, "obj/c.dwo", "/no/such/directory");
+            fixture::append_skeleton_unit(data, 0xd, "wrong_id.dwo", directory.string());
+            fixture::append_skeleton_unit(data, 0xe, "missing.dwo", directory.string());
+
+            dwarf::DebugSections sections = {};
+            sections.debug_info = data.debug_info;
+            sections.debug_abbrev = data.debug_abbrev;
+
+            std::vector<dwarf::Unit> skeletons;
+            for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                skeletons.emplace_back(sections, unit_header);
+            }
+
+            dwarf::DwoResolver resolver(2, {directory});
+
+            auto const name = [](dwarf::DwoFile const & file) {
+                return dwarf::DIE(file.unit(), file.unit().first_die_offset()).attribute(dwarf::Attribute::dw_at_name).as_string();
+            };
+
+            ut::Then() = [&]() noexcept {
+                ut::check(skeletons.size() == 5);
+                ut::check(skeletons[0].unit_type() == dwarf::UnitHeaderUnitType::dw_ut_skeleton);
+                ut::check(skeletons[0].dwo_id() == 0xa);
+            };
+
+            ut::Then() = [&]() noexcept {
+                auto const a = resolver.resolve(skeletons[0]);
+                ut::check(a != nullptr && name(*a) == "a.cpp");
+                ut::check(a != nullptr && a->unit().unit_type() == dwarf::UnitHeaderUnitType::dw_ut_split_compile);
+
+                // the child of the split unit entry
+                if(a != nullptr) {
+                    dwarf::DieCursor cursor(a->unit());
+                    ut::check(cursor.next() && cursor.next());
+                    ut::check(cursor.die().tag() == dwarf::Tag::dw_tag_base_type);
+                    ut::check(cursor.die().attribute(dwarf::Attribute::dw_at_name).as_string() == "int");
+                }
+
+                auto const b = resolver.resolve(skeletons[1]);
+                ut::check(b != nullptr && name(*b) == "b.cpp");
+
+                // a warm lookup returns the same mapping
+                ut::check(resolver.resolve(skeletons[0]) == a);
+                ut::check(resolver.statistics().hits == 1);
+                ut::check(resolver.statistics().misses == 2);
+
+                // c evicts the least recently used b, a stays valid while referenced
+                auto const c = resolver.resolve(skeletons[2]);
+                ut::check(c != nullptr && name(*c) == "c.cpp");
+                ut::check(resolver.size() == 2);
+                ut::check(resolver.statistics().evictions == 1);
+                ut::check(resolver.resolve(skeletons[0]) == a);
+                ut::check(resolver.statistics().hits == 2);
+
+                auto const b2 = resolver.resolve(skeletons[1]);
+                ut::check(b2 != nullptr && b2 != b && name(*b2) == "b.cpp");
+                ut::check(resolver.statistics().misses == 4);
+                ut::check(resolver.statistics().evictions == 2);
+            };
+
+            ut::Then() = [&]() noexcept {
+                // a .dwo file with another dwo_id and a missing .dwo file are not resolved
+                ut::check(resolver.resolve(skeletons[3]) == nullptr);
+                ut::check(resolver.resolve(skeletons[4]) == nullptr);
+                ut::check(resolver.statistics().failures == 2);
+
+                // a unit of a binary without split DWARF is no skeleton unit
+                std::span<char const> const exe(tests_example_program_example_program_exe);
+                dwarf::DebugSections const exe_sections = dwarf::get_debug_sections(exe);
+                dwarf::Unit const unit(exe_sections, *dwarf::DebugInfo(exe_sections.debug_info).begin());
+                ut::check(resolver.resolve(unit) == nullptr);
+            };
+
+            std::filesystem::remove_all(directory);
+        };
+    };
+
+
+    ut::Scenario("dwarf_package") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            // the low bits of the ids collide, the hash table probes with the high bits
+            std::vector<fixture::SplitUnit> units;
+            for(uint64_t i = 0; i < 100; ++i) {
+                units.emplace_back((i << 40) | 7, "unit" + std::to_string(i) + ".cpp", "type" + std::to_string(i));
+            }
+            auto const dwp = fixture::make_dwp(units);
+            dwarf::DwarfPackage const package(dwp);
+
+            fixture::DebugSectionsData data;
+            for(auto const & unit : units) {
+                fixture::append_skeleton_unit(data, std::get<0>(unit), "unit.dwo", "/");
+            }
+            fixture::append_skeleton_unit(data, 0x1234, "unit.dwo", "/");
+
+            dwarf::DebugSections sections = {};
+            sections.debug_info = data.debug_info;
+            sections.debug_abbrev = data.debug_abbrev;
+
+            std::vector<dwarf::Unit> skeletons;
+            for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                skeletons.emplace_back(sections, unit_header);
+            }
+
+            ut::Then() = [&]() noexcept {
+                ut::check(package.is_valid());
+                ut::check(package.cu_index().version() == 5);
+                ut::check(package.cu_index().unit_count() == 100);
+                ut::check(package.cu_index().slot_count() == 256);
+                ut::check(package.cu_index().column(dwarf::SectionIdentifier::dw_sect_abbrev) == 1);
+                ut::check(package.cu_index().column(dwarf::SectionIdentifier::dw_sect_line) == 2);
+                ut::check(!package.tu_index().is_valid());
+            };
+
+            ut::Then() = [&]() noexcept {
+                // every skeleton unit lands on the slice of its split unit
+                for(size_t i = 0; i < units.size(); ++i) {
+                    auto const unit = package.find_split_unit(skeletons[i]);
+                    ut::check(unit.has_value());
+                    if(!unit.has_value()) {
+                        continue;
+                    }
+
+                    ut::check(unit->offset() == 0);
+                    ut::check(unit->end_offset() == unit->sections().debug_info.size());
+                    ut::check(unit->dwo_id() == std::get<0>(units[i]));
+
+                    dwarf::DieCursor cursor(*unit);
+                    ut::check(cursor.next());
+                    ut::check(cursor.die().attribute(dwarf::Attribute::dw_at_name).as_string() == std::get<1>(units[i]));
+                    ut::check(cursor.next());
+                    ut::check(cursor.die().attribute(dwarf::Attribute::dw_at_name).as_string() == std::get<2>(units[i]));
+                }
+            };
+
+            ut::Then() = [&]() noexcept {
+                ut::check(!package.find_split_unit(skeletons.back()).has_value());
+                ut::check(!package.find_unit_sections(0).has_value());
+                ut::check(!package.find_type_unit_sections(std::get<0>(units[0])).has_value());
+
+                // a truncated index is rejected instead of read out of bounds
+                dwarf::UnitIndex const truncated(package.sections().debug_cu_index.first(package.sections().debug_cu_index.size() - 1));
+                ut::check(!truncated.is_valid());
+                ut::check(truncated.find(std::get<0>(units[0])) == 0);
+            };
+        };
+    };
+
+
+    ut::Scenario("type_signature_index") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            std::vector<uint64_t> signatures;
+            for(uint64_t i = 0; i < 100; ++i) {
+                signatures.push_back(i << 48);
+            }
+
+            auto const data = fixture::make_type_units(signatures);
+            dwarf::DebugSections sections = {};
+            sections.debug_info = data.debug_info;
+            sections.debug_abbrev = data.debug_abbrev;
+
+            dwarf::TypeSignatureIndex const index(sections);
+
+            ut::Then() = [&]() noexcept {
+                ut::check(index.size() == signatures.size());
+                ut::check(index.capacity() >= 2 * index.size());
+
+                for(size_t i = 0; i < signatures.size(); ++i) {
+                    auto const * const entry = index.find(signatures[i]);
+                    ut::check(entry != nullptr);
+                    if(entry == nullptr) {
+                        continue;
+                    }
+
+                    dwarf::Unit const unit(sections, dwarf::UnitHeader(sections.debug_info, entry->unit_offset));
+                    ut::check(unit.type_signature() == signatures[i]);
+                    ut::check(entry->type_offset == unit.offset() + unit.type_offset());
+
+                    dwarf::DIE const die(unit, entry->type_offset);
+                    ut::check(die.tag() == dwarf::Tag::dw_tag_structure_type);
+                    ut::check(die.attribute(dwarf::Attribute::dw_at_name).as_string() == "type" + std::to_string(i));
+                }
+
+                ut::check(index.find(1) == nullptr);
+            };
+
+            ut::Then() = [&]() noexcept {
+                // the variables of the compilation unit reference the structures by signature
+                dwarf::Unit const unit(sections, dwarf::UnitHeader(sections.debug_info, index.find(signatures.back())->unit_offset));
+                dwarf::Unit const compile_unit(sections, dwarf::UnitHeader(sections.debug_info, unit.end_offset()));
+                ut::check(compile_unit.unit_type() == dwarf::UnitHeaderUnitType::dw_ut_compile);
+
+                dwarf::DieCursor cursor(compile_unit);
+                size_t variables = 0;
+                while(cursor.next()) {
+                    if(cursor.die().tag() != dwarf::Tag::dw_tag_variable) {
+                        continue;
+                    }
+
+                    auto const value = cursor.die().attribute(dwarf::Attribute::dw_at_type);
+                    ut::check(value.is_type_signature());
+                    ut::check(!value.is_reference());
+                    ut::check(value.as_type_signature() == signatures[variables]);
+
+                    auto const * const entry = index.find(value.as_type_signature());
+                    ut::check(entry != nullptr && index.as_reference(value) == entry->type_offset);
+                    ++variables;
+                }
+                ut::check(variables == signatures.size());
+            };
+
+            ut::Then() = [&]() noexcept {
+                // duplicates keep the first type unit
+                dwarf::TypeSignatureIndex copy = index;
+                ut::check(!copy.insert({signatures[0], 0, 1}));
+                ut::check(copy.insert({1, 0, 1}));
+                ut::check(copy.find(1) != nullptr);
+                ut::check(copy.find(signatures[0])->type_offset == index.find(signatures[0])->type_offset);
+
+                // a binary without type units
+                std::span<char const> const exe(tests_example_program_example_program_exe);
+                dwarf::TypeSignatureIndex const empty(dwarf::get_debug_sections(exe));
+                ut::check(empty.size() == 0);
+                ut::check(empty.find(signatures[0]) == nullptr);
+            };
+        };
+    };
+
+
+#if defined(DWARF_READER_HAS_ZLIB)
+    ut::Scenario("section_cache") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            std::span<char const> const exe(tests_example_program_example_program_exe);
+            dwarf::DebugSections const expected = dwarf::get_debug_sections(exe);
+
+            auto const compressed = fixture::make_debug_object(expected, true);
+            auto const uncompressed = fixture::make_debug_object(expected, false);
+
+            auto const equal = [](std::span<char const> const a, std::span<char const> const b) {
+                return std::ranges::equal(a, b);
+            };
+
+            ut::Then() = [&]() noexcept {
+                // the compressed sections are not visible without the cache
+                ut::check(dwarf::get_debug_sections(compressed).debug_info.empty());
+                ut::check(compressed.size() < uncompressed.size());
+
+                dwarf::SectionCache cache(compressed, 256);
+                ut::check(cache.is_compressed(&dwarf::DebugSections::debug_info));
+                ut::check(cache.size(&dwarf::DebugSections::debug_info) == expected.debug_info.size());
+                ut::check(cache.available(&dwarf::DebugSections::debug_info) == 0);
+
+                // only the requested part is decompressed
+                auto const prefix = cache.prefix(&dwarf::DebugSections::debug_info, 100);
+                ut::check(equal(prefix, expected.debug_info.first(100)));
+                ut::check(cache.available(&dwarf::DebugSections::debug_info) < expected.debug_info.size());
+
+                auto const line_program = cache.unit(&dwarf::DebugSections::debug_line, 0);
+                ut::check(equal(line_program, expected.debug_line.first(line_program.size())));
+                ut::check(line_program.size() < expected.debug_line.size());
+                ut::check(cache.available(&dwarf::DebugSections::debug_line) < expected.debug_line.size());
+
+                // the complete sections, decompressed in parallel
+                dwarf::DebugSections const sections = cache.sections();
+                for(auto const & name : dwarf::debug_section_names) {
+                    ut::check(equal(sections.*name.member, expected.*name.member));
+                }
+                ut::check(cache.available(&dwarf::DebugSections::debug_info) == expected.debug_info.size());
+
+                dwarf::DieTree const tree(sections);
+                ut::check(tree.size() == 1120);
+            };
+
+            ut::Then() = [&]() noexcept {
+                dwarf::SectionCache cache(compressed);
+                dwarf::DebugSections const sections = cache.sections(dwarf::SectionLoading::sequential);
+                ut::check(equal(sections.debug_str, expected.debug_str));
+                ut::check(cache.section(&dwarf::DebugSections::debug_str).data() == sections.debug_str.data());
+
+                dwarf::SectionCache uncompressed_cache(uncompressed);
+                ut::check(!uncompressed_cache.is_compressed(&dwarf::DebugSections::debug_info));
+                ut::check(equal(uncompressed_cache.section(&dwarf::DebugSections::debug_info), expected.debug_info));
+                ut::check(equal(uncompressed_cache.unit(&dwarf::DebugSections::debug_line, 0), cache.unit(&dwarf::DebugSections::debug_line, 0)));
+            };
+
+            ut::Then() = [&]() noexcept {
+                // truncated compressed data
+                auto data = fixture::compress_zdebug(expected.debug_info);
+                data.resize(data.size() / 2);
+
+                dwarf::SectionCache cache(exe);
+                cache.add(&dwarf::DebugSections::debug_info, data, dwarf::read_zdebug_header(data));
+                ut::check(cache.is_compressed(&dwarf::DebugSections::debug_info));
+
+                bool is_thrown = false;
+                try {
+                    static_cast<void>(cache.section(&dwarf::DebugSections::debug_info));
+                }
+                catch(std::range_error const &) {
+                    is_thrown = true;
+                }
+                ut::check(is_thrown);
+
+                // the header of an ELF section with the SHF_COMPRESSED flag
+                std::vector<char> const chdr = {2, 0, 0, 0, 0, 0, 0, 0, 0x10, 0x20, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0};
+                auto const header = dwarf::read_elf_compression_header(chdr);
+                ut::check(header.compression == dwarf::SectionCompression::zstd);
+                ut::check(header.size == 0x2010);
+                ut::check(header.header_size == chdr.size());
+                ut::check(dwarf::read_zdebug_header(chdr).compression == dwarf::SectionCompression::none);
+
+                // a corrupt size is rejected before the buffer is allocated
+                auto const is_rejected = [](std::span<char const> const section, dwarf::CompressionHeader const & corrupt) {
+                    try {
+                        dwarf::CompressedSection const compressed_section(section, corrupt);
+                    }
+                    catch(std::range_error const &) {
+                        return true;
+                    }
+                    return false;
+                };
+                auto const zdebug = fixture::compress_zdebug(expected.debug_info);
+                ut::check(is_rejected(zdebug, {dwarf::SectionCompression::zlib, 12, uint64_t{1} << 40}));
+                ut::check(is_rejected(chdr, {dwarf::SectionCompression::zstd, chdr.size(), uint64_t{1} << 40}));
+                ut::check(!is_rejected(zdebug, dwarf::read_zdebug_header(zdebug)));
+            };
+        };
+    };
+#endif
+
+    ut::Scenario("unit_stream") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            std::span<char const> const exe(tests_example_program_example_program_exe);
+            dwarf::DebugSections const sections = dwarf::get_debug_sections(exe);
+
+            // the section arrives in pieces of a few bytes
+            auto const make_source = [](std::span<char const> const data) {
+                return [data, index = size_t{0}](std::span<char> const buffer) mutable -> size_t {
+                    size_t const count = std::min({buffer.size(), data.size() - index, size_t{7} + index % 13});
+                    std::copy_n(data.data() + index, count, buffer.data());
+                    index += count;
+                    return count;
+                };
+            };
+
+            ut::Then() = [&]() noexcept {
+                dwarf::UnitStream stream(make_source(sections.debug_info), sections, 256);
+
+                size_t units = 0;
+                size_t entries = 0;
+                size_t largest_unit = 0;
+                for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                    dwarf::Unit const expected(sections, unit_header);
+                    auto const streamed_unit = stream.next();
+                    ut::check(streamed_unit.has_value());
+                    ut::check(streamed_unit->offset == expected.offset());
+                    ut::check(std::ranges::equal(streamed_unit->data,
+                        sections.debug_info.subspan(expected.offset(), expected.end_offset() - expected.offset())));
+
+                    // the entries are read from the buffered unit
+                    dwarf::Unit const unit = stream.unit(*streamed_unit);
+                    dwarf::DieCursor cursor(unit);
+                    dwarf::DieCursor expected_cursor(expected);
+                    while(expected_cursor.next()) {
+                        ut::check(cursor.next());
+                        ut::check(cursor.die().tag() == expected_cursor.die().tag());
+                        ut::check(cursor.die().offset() + streamed_unit->offset == expected_cursor.die().offset());
+                        ++entries;
+                    }
+                    ut::check(!cursor.next());
+
+                    largest_unit = std::max(largest_unit, streamed_unit->data.size());
+                    ++units;
+                }
+
+                ut::check(!stream.next().has_value());
+                ut::check(units > 1);
+                ut::check(entries > 0);
+                ut::check(stream.bytes_read() == sections.debug_info.size());
+                ut::check(stream.buffer_size() >= largest_unit);
+                ut::check(stream.buffer_size() < sections.debug_info.size());
+            };
+
+            ut::Then() = [&]() noexcept {
+                // from a std::istream
+                std::istringstream input(std::string(sections.debug_info.data(), sections.debug_info.size()));
+                dwarf::UnitStream stream{dwarf::IstreamSource(input)};
+
+                size_t units = 0;
+                while(auto const streamed_unit = stream.next()) {
+                    dwarf::UnitHeader const unit_header(sections.debug_info, streamed_unit->offset);
+                    ut::check(streamed_unit->data.size() == unit_header.unit_length() + 4);
+                    ++units;
+                }
+                size_t expected_units = 0;
+                for([[maybe_unused]] dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                    ++expected_units;
+                }
+                ut::check(units == expected_units);
+
+                // from a pipe, the source fills the buffer with one call instead of reading single bytes
+                fixture::PipeBuffer pipe_buffer(sections.debug_info);
+                std::istream pipe(&pipe_buffer);
+                size_t calls = 0;
+                dwarf::UnitStream pipe_stream([&, source = dwarf::IstreamSource(pipe)](std::span<char> const buffer) mutable {
+                    ++calls;
+                    return source(buffer);
+                });
+                size_t pipe_units = 0;
+                while(pipe_stream.next()) {
+                    ++pipe_units;
+                }
+                ut::check(pipe_units == expected_units);
+                ut::check(calls <= 3);
+
+                // truncated in the middle of a unit
+                dwarf::UnitStream truncated(make_source(sections.debug_info.first(sections.debug_info.size() - 1)));
+                bool is_thrown = false;
+                try {
+                    while(truncated.next()) {
+                    }
+                }
+                catch(std::range_error const &) {
+                    is_thrown = true;
+                }
+                ut::check(is_thrown);
+
+                // a corrupt 64-bit length is rejected before the buffer is allocated
+                std::vector<char> const corrupt(12, '\xff');
+                dwarf::UnitStream corrupt_stream(make_source(corrupt), {}, 256);
+                is_thrown = false;
+                try {
+                    static_cast<void>(corrupt_stream.next());
+                }
+                catch(std::range_error const &) {
+                    is_thrown = true;
+                }
+                ut::check(is_thrown);
+                ut::check(corrupt_stream.buffer_size() <= 256);
+
+                // units up to the configured maximum
+                size_t largest_unit = 0;
+                for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                    largest_unit = std::max<size_t>(largest_unit, unit_header.unit_length() + 4);
+                }
+                auto const read_all = [&](size_t const max_unit_size) {
+                    dwarf::UnitStream stream(make_source(sections.debug_info), sections, 256, max_unit_size);
+                    try {
+                        while(stream.next()) {
+                        }
+                    }
+                    catch(std::range_error const &) {
+                        return false;
+                    }
+                    return true;
+                };
+                ut::check(read_all(largest_unit));
+                ut::check(!read_all(largest_unit - 1));
+            };
+        };
+    };
+
+
+    ut::Scenario("incremental_index") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            std::vector<fixture::CompileUnit> units;
+            for(size_t i = 0; i < 50; ++i) {
+                units.push_back({"unit" + std::to_string(i), 0x1000 + i * 0x1000, 1 + i % 5, i});
+            }
+            auto const data = fixture::make_compile_units(units);
+            dwarf::IncrementalIndex index(data.sections());
+
+            // the name of an entry at an offset of the .debug_info section
+            auto const name = [](fixture::DebugSectionsData const & data, size_t const offset) {
+                auto const sections = data.sections();
+                for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                    dwarf::Unit const unit(sections, unit_header);
+                    if(offset < unit.end_offset()) {
+                        return std::string(dwarf::DIE(unit, offset).attribute(dwarf::Attribute::dw_at_name).as_string());
+                    }
+                }
+                return std::string();
+            };
+
+            ut::Then() = [&]() noexcept {
+                ut::check(index.units().size() == units.size());
+
+                auto const found = index.find_name("unit7_1");
+                ut::check(found.size() == 1);
+                ut::check(name(data, found[0]) == "unit7_1");
+
+                ut::check(name(data, index.find_address(0x8000 + 0x25)) == "unit7_2");
+                ut::check(index.find_address(0x8000 + 0x30) == 0);
+                ut::check(index.find_address(0x10) == 0);
+                ut::check(index.find_name("no_such_name").empty());
+            };
+
+            ut::Then() = [&]() noexcept {
+                // an identical rebuild
+                dwarf::IncrementalIndex copy = index;
+                auto const update = copy.update(data.sections());
+                ut::check(update.units == units.size());
+                ut::check(update.reused == units.size());
+                ut::check(update.parsed == 0);
+
+                // one unit gets an additional function, the units after it move
+                auto changed_units = units;
+                ++changed_units[10].functions;
+                auto const changed = fixture::make_compile_units(changed_units);
+
+                auto const changed_update = copy.update(changed.sections());
+                ut::check(changed_update.reused == units.size() - 1);
+                ut::check(changed_update.parsed == 1);
+
+                // the same result as a complete rebuild of the index
+                dwarf::IncrementalIndex const expected(changed.sections());
+                for(auto const * const function : {"unit9_0", "unit10_0", "unit10_1", "unit11_0", "unit49_3"}) {
+                    ut::check(copy.find_name(function) == expected.find_name(function));
+                    ut::check(copy.find_name(function).size() == 1);
+                    ut::check(name(changed, copy.find_name(function)[0]) == function);
+                }
+                ut::check(copy.find_name("unit11_0").front() > index.find_name("unit11_0").front());
+                ut::check(index.find_name("unit10_1").empty());
+                ut::check(copy.find_address(0xc000 + 0x10) == expected.find_address(0xc000 + 0x10));
+                ut::check(name(changed, copy.find_address(0xc000 + 0x10)) == "unit11_1");
+            };
+
+            ut::Then() = [&]() noexcept {
+                // only the line number program of a unit changes
+                dwarf::IncrementalIndex copy = index;
+                auto changed_units = units;
+                changed_units[20].line_seed = 1000;
+                auto const changed = fixture::make_compile_units(changed_units);
+
+                auto const update = copy.update(changed.sections());
+                ut::check(update.reused == units.size() - 1);
+                ut::check(update.parsed == 1);
+                ut::check(copy.units()[20].fragment->line_program_hash != index.units()[20].fragment->line_program_hash);
+                ut::check(copy.units()[20].fragment->line_program.size == index.units()[20].fragment->line_program.size);
+            };
+
+            ut::Then() = [&]() noexcept {
+                std::span<char const> const exe(tests_example_program_example_program_exe);
+                dwarf::DebugSections const sections = dwarf::get_debug_sections(exe);
+                dwarf::IncrementalIndex exe_index(sections);
+
+                auto const found = exe_index.find_name("main");
+                ut::check(!found.empty());
+                ut::check(exe_index.units().front().fragment->line_program.size > 0);
+
+                auto const update = exe_index.update(sections);
+                ut::check(update.parsed == 0);
+                ut::check(exe_index.find_name("main") == found);
+            };
+        };
+
+        ut::Given() = []() noexcept {
+            // the names in .debug_str and the addresses of the functions in .debug_addr
+            std::vector<fixture::CompileUnit> units;
+            for(size_t i = 0; i < 10; ++i) {
+                units.push_back({"unit" + std::to_string(i), 0x1000 + i * 0x1000, 3, i, true});
+            }
+            auto const data = fixture::make_compile_units(units);
+            dwarf::IncrementalIndex const index(data.sections());
+
+            ut::Then() = [&]() noexcept {
+                ut::check(index.find_name("unit3_1").size() == 1);
+                ut::check(index.find_address(0x4000 + 0x15) == index.find_name("unit3_1").front());
+
+                // a function is renamed to a name of the same length, only .debug_str changes
+                auto renamed = data;
+                auto const position = std::string_view(renamed.debug_str.data(), renamed.debug_str.size()).find("unit3_1");
+                renamed.debug_str[position + 4] = 'X';
+
+                dwarf::IncrementalIndex copy = index;
+                auto const update = copy.update(renamed.sections());
+                ut::check(renamed.debug_info == data.debug_info);
+                ut::check(update.reused == units.size() - 1);
+                ut::check(update.parsed == 1);
+                ut::check(copy.find_name("unit3_1").empty());
+                ut::check(copy.find_name("unitX_1") == index.find_name("unit3_1"));
+
+                // a function moves, only .debug_addr changes
+                auto moved = data;
+                auto const address = std::ranges::search(moved.debug_addr, std::array<char, 2>{0x10, 0x40});
+                ut::check(!address.empty());
+                address[1] = 0x48;
+
+                dwarf::IncrementalIndex moved_index = index;
+                auto const moved_update = moved_index.update(moved.sections());
+                ut::check(moved_update.reused == units.size() - 1);
+                ut::check(moved_update.parsed == 1);
+                ut::check(moved_index.find_address(0x4800 + 0x15) == index.find_name("unit3_1").front());
+                ut::check(moved_index.find_address(0x4000 + 0x15) != index.find_name("unit3_1").front());
+            };
+        };
+
+        ut::Given() = []() noexcept {
+            // address ranges in .debug_ranges and .debug_rnglists
+            auto const data = fixture::make_range_list_units();
+            dwarf::IncrementalIndex const index(data.sections());
+
+            ut::Then() = [&]() noexcept {
+                auto const unit4 = index.find_name("ranges4.c");
+                auto const split4 = index.find_name("split4");
+                auto const unit5 = index.find_name("ranges5.c");
+                auto const split5 = index.find_name("split5");
+                ut::check(unit4.size() == 1 && split4.size() == 1 && unit5.size() == 1 && split5.size() == 1);
+
+                ut::check(index.find_address(0x10000) == unit4.front());
+                ut::check(index.find_address(0x10015) == split4.front());
+                ut::check(index.find_address(0x10030) == unit4.front());
+                ut::check(index.find_address(0x10045) == split4.front());
+                ut::check(index.find_address(0x100ff) == unit4.front());
+                ut::check(index.find_address(0x10100) == 0);
+                ut::check(index.find_address(0x2007f) == unit4.front());
+                ut::check(index.find_address(0x20080) == 0);
+
+                ut::check(index.find_address(0x30000) == unit5.front());
+                ut::check(index.find_address(0x30025) == split5.front());
+                ut::check(index.find_address(0x30030) == unit5.front());
+                ut::check(index.find_address(0x40015) == split5.front());
+                ut::check(index.find_address(0x4007f) == unit5.front());
+                ut::check(index.find_address(0x40080) == 0);
+                ut::check(index.find_address(0x50000) == 0);
+            };
+
+            ut::Then() = [&]() noexcept {
+                // only a range list changes
+                auto changed = data;
+                changed.debug_rnglists[changed.debug_rnglists.size() - 19] = 0x20;    // the length of DW_RLE_start_length
+
+                dwarf::IncrementalIndex copy = index;
+                auto const update = copy.update(changed.sections());
+                ut::check(update.reused == 1);
+                ut::check(update.parsed == 1);
+                ut::check(copy.find_address(0x30035) == index.find_name("split5").front());
+                ut::check(index.find_address(0x30035) == index.find_name("ranges5.c").front());
+
+                auto changed_ranges = data;
+                changed_ranges.debug_ranges[8] = static_cast<char>(0x80);    // the first range of "ranges4.c" ends at 0x10080
+                changed_ranges.debug_ranges[9] = 0;
+                auto const ranges_update = copy.update(changed_ranges.sections());
+                ut::check(ranges_update.reused == 0);
+                ut::check(ranges_update.parsed == 2);
+                ut::check(copy.find_address(0x100ff) == 0);
+                ut::check(copy.find_address(0x10015) == index.find_name("split4").front());
+            };
+        };
+    };
+
+    ut::Scenario("dwarf_dump") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            std::span<char const> const exe(tests_example_program_example_program_exe);
+            dwarf::DebugSections const sections = dwarf::get_debug_sections(exe);
+
+            ut::Then() = [&]() noexcept {
+                dwarf::BufferedWriter sequential;
+                dwarf::dump_debug_info(sequential, sections, 1);
+                auto const text = sequential.view();
+                ut::check(text.starts_with("Contents of the .debug_info section:\n\n  Compilation Unit @ offset 0:\n"));
+                ut::check(text.find("(DW_TAG_compile_unit)") != std::string_view::npos);
+                ut::check(text.find("DW_AT_language    : 33\t(C++14)") != std::string_view::npos);
+
+                // the units formatted on several threads are written in order
+                dwarf::BufferedWriter parallel;
+                dwarf::dump_debug_info(parallel, sections, 4);
+                ut::check(parallel.view() == text);
+
+                dwarf::BufferedWriter abbrev;
+                dwarf::dump_abbrev(abbrev, sections.debug_abbrev);
+                ut::check(abbrev.view().find("  Number TAG (0)\n   1      DW_TAG_") != std::string_view::npos);
+
+                dwarf::BufferedWriter headers;
+                dwarf::dump_sections(headers, exe);
+                ut::check(headers.view().find(".debug_info") != std::string_view::npos);
+                ut::check(headers.view().find("CONTENTS, ALLOC, LOAD, READONLY, CODE") != std::string_view::npos);
+            };
+        };
+    };
+
+    ut::Scenario("reader_statistics") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            std::span<char const> const exe(tests_example_program_example_program_exe);
+            dwarf::reset_reader_statistics();
+            dwarf::DebugSections const sections = dwarf::get_debug_sections(exe);
+
+            size_t units = 0;
+            size_t entries = 0;
+            for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                dwarf::Unit const unit(sections, unit_header);
+                ++units;
+                for(dwarf::DieCursor cursor(unit); cursor.next();) {
+                    ++entries;
+                    cursor.read_attributes([](auto const &, dwarf::AttributeValue const &) {});
+                }
+            }
+
+            ut::Then() = [&]() noexcept {
+                auto const statistics = dwarf::reader_statistics();
+                ut::check(dwarf::has_reader_statistics);
+                ut::check(statistics[dwarf::ReaderCounter::units] == units);
+                ut::check(statistics[dwarf::ReaderCounter::entries_visited] == entries);
+                ut::check(statistics[dwarf::ReaderCounter::abbrev_tables] >= units);
+                ut::check(statistics[dwarf::ReaderCounter::info_bytes] > 0);
+                ut::check(statistics.leb128_average_length() >= 1.0);
+                ut::check(statistics.stage_calls[static_cast<size_t>(dwarf::ReaderStage::sections)] == 1);
+
+                // the counters of a finished thread are kept
+                std::thread([&sections]() {
+                    dwarf::BufferedWriter writer;
+                    dwarf::dump_debug_info(writer, sections, 1);
+                }).join();
+                ut::check(dwarf::reader_statistics().stage_calls[static_cast<size_t>(dwarf::ReaderStage::dump)] == 1);
+
+                dwarf::reset_reader_statistics();
+                ut::check(dwarf::reader_statistics()[dwarf::ReaderCounter::units] == 0);
+            };
+        };
+    };
+
+    ut::Scenario("pe_directories") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            auto const dll = fixture::make_dll("fixture.dll", {
+                {"add", 0x00},
+                {"", 0x10},
+                {"sub", 0x20},
+                {"alias_of_add", 0x00},
+                {"HeapAlloc", 0, "NTDLL.RtlAllocateHeap"}
+            });
+            uint64_t const text = 0x180001000;
+
+            ut::Then() = [&]() noexcept {
+                pei::SectionRanges const ranges(dll);
+                ut::check(ranges.file_offset(0x1004) == 0x204);
+                ut::check(!ranges.file_offset(0x1100).has_value());
+                ut::check(!ranges.file_offset(0x500).has_value());
+
+                pei::ExportDirectory const directory(dll);
+                ut::check(directory.is_valid());
+                ut::check(directory.name() == "fixture.dll");
+                ut::check(directory.number_of_functions() == 5);
+                ut::check(directory.number_of_names() == 4);
+
+                pei::ExportIndex const exports(dll);
+                ut::check(exports.name() == "fixture.dll");
+                ut::check(exports.size() == 5);
+                ut::check(exports.find(std::string_view("sub")) != nullptr && exports.find(std::string_view("sub"))->address == text + 0x20);
+                ut::check(exports.find(std::string_view("missing")) == nullptr);
+                ut::check(exports.find_ordinal(2) != nullptr && exports.find_ordinal(2)->name.empty());
+                ut::check(exports.find_ordinal(6) == nullptr);
+
+                auto const * const forwarder = exports.find(std::string_view("HeapAlloc"));
+                ut::check(forwarder != nullptr && forwarder->forwarder == "NTDLL.RtlAllocateHeap" && forwarder->address == 0);
+
+                ut::check(exports.find(text + 0x24) == exports.find(std::string_view("sub")));
+                ut::check(exports.find(text + 0x0f) != nullptr && exports.find(text + 0x0f)->address == text);
+                ut::check(exports.find(text + 0x10)->ordinal == 2);
+                ut::check(exports.find(text + 0x100) == nullptr);
+                ut::check(exports.find(text - 1) == nullptr);
+
+                // the imports of the MinGW example program
+                std::span<char const> const exe(tests_example_program_example_program_exe);
+                ut::check(!pei::ExportDirectory(exe).is_valid());
+                pei::ImportDirectory const import_directory(exe);
+                ut::check(import_directory.size() >= 2);
+
+                pei::ImportIndex const imports(exe);
+                auto const * const strlen = imports.find(std::string_view("strlen"));
+                ut::check(strlen != nullptr && strlen->dll == "msvcrt.dll" && strlen->ordinal == 0);
+                ut::check(imports.find(strlen->address) == strlen);
+                ut::check(imports.find(std::string_view("missing")) == nullptr);
+                auto const iat = pei::OptionalHeader(exe).data_directory(pei::DirectoryEntry::import_address_table);
+                auto const iat_begin = pei::OptionalHeader(exe).image_base() + iat.virtual_address;
+                ut::check(std::ranges::all_of(imports.imports(), [&](pei::Import const & import) {
+                    return iat_begin <= import.address && import.address < iat_begin + iat.size;
+                }));
+            };
+
+            // the export table of a file cut off in the MS-DOS stub, behind the COFF file header and in
+            // the section table is empty
+            ut::Then() = [&]() noexcept {
+                std::span<char const> const exe(tests_example_program_example_program_exe);
+                ut::check(dll.size() > 600);
+                for(size_t const size : {100, 300, 600}) {
+                    ut::check(pei::ExportIndex(std::span<char const>(dll).first(size)).size() == 0);
+                    ut::check(pei::ExportIndex(exe.first(size)).size() == 0);
+                    ut::check(pei::ImportIndex(exe.first(size)).imports().empty());
+                }
+            };
+
+            // the build identity of the debug directory
+            ut::Then() = [&]() noexcept {
+                ut::check(pei::DebugDirectory(dll).size() == 0);
+                ut::check(!pei::DebugDirectory(dll).codeview().has_value());
+                auto const header_key = pei::DebugDirectory(dll).key();
+                ut::check(header_key.source == pei::ImageKeySource::header && !header_key.is_stable());
+
+                std::string_view const guid = "0123456789abcdef";
+                auto const build = fixture::make_dll("fixture.dll", {{"add", 0x00}}, text - 0x1000,
+                    fixture::make_codeview(guid, 1, "C:\\build\\fixture.pdb"));
+                pei::DebugDirectory const directory(build);
+                ut::check(directory.size() == 1);
+                ut::check(directory.entry(0).type == pei::DebugType::codeview);
+                ut::check(directory.entry(1).data.empty());
+
+                auto const codeview = directory.codeview();
+                ut::check(codeview.has_value());
+                ut::check(std::string_view(reinterpret_cast<char const *>(codeview->guid.data()), 16) == guid);
+                ut::check(codeview->age == 1);
+                ut::check(codeview->pdb_path == "C:\\build\\fixture.pdb");
+
+                auto const key = directory.key();
+                ut::check(key.is_valid() && key.is_stable());
+                ut::check(key.high == 0x3736353433323130);
+                ut::check(key == pei::DebugDirectory(fixture::make_dll("other.dll", {}, text - 0x1000,
+                    fixture::make_codeview(guid, 1))).key());
+                ut::check(key != pei::DebugDirectory(fixture::make_dll("fixture.dll", {{"add", 0x00}}, text - 0x1000,
+                    fixture::make_codeview(guid, 2))).key());
+
+                // the example program is linked without a build id
+                std::span<char const> const exe(tests_example_program_example_program_exe);
+                ut::check(pei::DebugDirectory(exe).key().source == pei::ImageKeySource::header);
+                ut::check(pei::DebugDirectory(exe).key().high >> 32 == pei::FileHeader(exe).time_date_stamp());
+            };
+        };
+    };
+
+
+    ut::Scenario("debug_macro") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            auto const data = fixture::make_macro_units();
+            auto const sections = data.sections();
+            auto const text = [](dwarf::MacroEntry const * const entry) {
+                return entry != nullptr ? entry->text : std::string_view("undefined");
+            };
+
+            ut::Then() = [&]() noexcept {
+                dwarf::MacroIndex const index(sections);
+                ut::check(index.units().size() == 2);
+                // the predefined macros and a.h are read once for both units
+                ut::check(index.table_count() == 4);
+
+                auto const & a = index.units()[0];
+                ut::check(a.unit_offset() == 0);
+                ut::check(a.files().size() == 4 && a.files()[2] == "/src/a.h");
+                ut::check(a.size() == 8);
+                ut::check(a.find_file("a.h") == 2);
+                ut::check(a.find_file("/src/b.h") == 3);
+                ut::check(!a.find_file("src/m.c").has_value());
+                ut::check(!a.find_file("b.h/").has_value());
+
+                // a definition is in effect behind its line
+                ut::check(text(a.find("A_H_VALUE", 1, 1)) == "undefined");
+                ut::check(text(a.find("A_H_VALUE", 1, 2)) == "A_H_VALUE 1");
+                ut::check(text(a.find("LOCAL", 1, 3)) == "LOCAL 3");
+                ut::check(text(a.find("LOCAL", 1, 4)) == "undefined");
+                ut::check(text(a.find("LOCAL", 1, 5)) == "LOCAL 4");
+                ut::check(text(a.find("B_H", 1, 5)) == "undefined");
+                ut::check(text(a.find("B_H", 1, 6)) == "B_H 2");
+                ut::check(text(a.find("__GNUC__", 1, 1)) == "__GNUC__ 12");
+                ut::check(text(a.find("SHARED", 2, 2)) == "undefined");
+                ut::check(text(a.find("SHARED", 2, 3)) == "SHARED(x) ((x) * 2)");
+                ut::check(text(a.find("LOCAL", 3, 1)) == "LOCAL 4");
+                ut::check(a.find("MAIN_ONLY", 1, 100) == nullptr);
+                ut::check(a.find("LOCAL", 7, 1) == nullptr);
+
+                auto const * const shared = a.find("SHARED", 1, 2);
+                ut::check(shared->name() == "SHARED" && shared->definition() == "((x) * 2)" && shared->line == 2);
+                ut::check(a.find("LOCAL", 1, 5)->definition() == "4");
+
+                auto const macros = a.macros_at(1, 6);
+                ut::check(macros.size() == 6);
+                ut::check(macros.front()->name() == "A_H_VALUE" && macros.back()->name() == "__STDC__");
+                ut::check(a.macros_at(1, 4).size() == 4);
+
+                // the units share the entries of the imported tables
+                auto const & m = index.units()[1];
+                ut::check(index.find_unit(m.unit_offset()) == &m);
+                ut::check(index.find_unit(1) == nullptr);
+                ut::check(m.find("SHARED", 1, 2) == shared);
+                ut::check(text(m.find("MAIN_ONLY", 1, 3)) == "MAIN_ONLY 5");
+                ut::check(text(index.find("MAIN_ONLY", "m.c", 3)) == "MAIN_ONLY 5");
+                ut::check(text(index.find("LOCAL", "a.c", 100)) == "LOCAL 4");
+                ut::check(index.find("LOCAL", "missing.c", 1) == nullptr);
+
+                // the entries of a table in the order of the section
+                dwarf::Unit const unit(sections, *dwarf::DebugInfo(sections.debug_info).begin());
+                dwarf::MacroTable const table(unit, 0);
+                ut::check(table.version() == 5 && !table.line_offset().has_value());
+                ut::check(table.entries().size() == 2);
+                ut::check(table.entries()[0].opcode == dwarf::MacroInformation::dw_macro_define_strp);
+                ut::check(table.entries()[1].text == "__GNUC__ 12");
+                ut::check(dwarf::MacroTable(unit, table.size()).entries()[0].text == "A_H_VALUE 1");
+
+                dwarf::LineHeader const line_header(unit, 0);
+                ut::check(line_header.version() == 5);
+                ut::check(line_header.file_count() == 4);
+                ut::check(line_header.directory(0) == "/src");
+                ut::check(line_header.file(3).name == "b.h" && line_header.file_path(3) == "/src/b.h");
+
+                ut::check(dwarf::MacroIndex(fixture::make_compile_units({{"unit", 0x1000, 1, 1}}).sections()).units().empty());
+            };
+        };
+    };
+
+    ut::Scenario("traversal") = []() noexcept
+    {
+        std::span<char const> const data(tests_example_program_example_program_exe);
+        dwarf::DebugSections const sections = dwarf::get_debug_sections(data);
+
+        ut::Given() = [&]() noexcept {
+            auto const is_main = [](dwarf::DIE const & die) {
+                auto const name = die.attribute(dwarf::Attribute::dw_at_name);
+                return die.tag() == dwarf::Tag::dw_tag_subprogram && name.is_valid() && name.as_string() == "main";
+            };
+
+            ut::Then() = [&]() noexcept {
+                size_t count = 0;
+                size_t unit_count = 0;
+                for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                    dwarf::Unit const unit(sections, unit_header);
+                    for(dwarf::DieCursor cursor(unit); cursor.next();) {
+                        ++count;
+                    }
+                    ++unit_count;
+                }
+
+                ut::check(static_cast<size_t>(std::ranges::distance(dwarf::units(sections))) == unit_count);
+                ut::check(static_cast<size_t>(std::ranges::distance(dwarf::dies(sections))) == count);
+
+                size_t unit_die_count = 0;
+                for(auto const & unit : dwarf::units(sections)) {
+                    auto unit_dies = dwarf::dies(unit);
+                    auto it = unit_dies.begin();
+                    ut::check(it->tag() == dwarf::Tag::dw_tag_compile_unit && it->offset() == unit.first_die_offset());
+                    unit_die_count += 1 + static_cast<size_t>(std::ranges::distance(++it, unit_dies.end()));
+                }
+                ut::check(unit_die_count == count);
+            };
+
+            ut::Then() = [&]() noexcept {
+                // stops at the first match, composes with the views
+                auto all = dwarf::dies(sections);
+                auto const main = std::ranges::find_if(all, is_main);
+                ut::check(main != all.end());
+                ut::check(main->attribute(dwarf::Attribute::dw_at_low_pc).is_valid());
+                auto const low_pc = main->attribute(dwarf::Attribute::dw_at_low_pc).as_address();
+
+                auto subprograms = dwarf::dies(sections)
+                    | std::views::filter([](dwarf::DIE const & die) { return die.tag() == dwarf::Tag::dw_tag_subprogram; })
+                    | std::views::take(2);
+                ut::check(std::ranges::distance(subprograms) == 2);
+
+                // the line number program of the unit of main has a row at its first instruction
+                bool found = false;
+                bool end_sequence = false;
+                for(auto const & unit : dwarf::units(sections)) {
+                    if(std::ranges::none_of(dwarf::dies(unit), is_main)) {
+                        continue;
+                    }
+                    for(auto const & row : dwarf::line_rows(unit)) {
+                        found = found || (row.address == low_pc && row.is_stmt && row.line > 0);
+                        end_sequence = end_sequence || row.end_sequence;
+                    }
+                }
+                ut::check(found);
+                ut::check(end_sequence);
+            };
+        };
+
+        ut::Given() = []() noexcept {
+            auto const data = fixture::make_macro_units();
+            auto const sections = data.sections();
+
+            ut::Then() = [&]() noexcept {
+                dwarf::Unit const unit(sections, *dwarf::DebugInfo(sections.debug_info).begin());
+                std::vector<dwarf::LineRow> rows;
+                std::ranges::copy(dwarf::line_rows(unit), std::back_inserter(rows));
+                ut::check(rows.size() == 4);
+                ut::check(rows[0].address == 0x1000 && rows[0].line == 2 && rows[0].column == 2 && rows[0].is_stmt);
+                ut::check(rows[1].address == 0x1004 && rows[1].line == 5 && rows[1].is_stmt);
+                ut::check(rows[2].address == 0x1006 && rows[2].line == 4 && !rows[2].is_stmt);
+                ut::check(rows[3].address == 0x1008 && rows[3].end_sequence);
+                ut::check(std::ranges::all_of(rows, [](dwarf::LineRow const & row) { return row.file == 1; }));
+
+                ::details::Generator<dwarf::LineRow> empty;
+                ut::check(empty.begin() == empty.end());
+            };
+        };
+    };
+
+#if !defined(_WIN32)
+    ut::Scenario("symbolizer") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            std::span<char const> const exe(tests_example_program_example_program_exe);
+            dwarf::DebugSections const sections = dwarf::get_debug_sections(exe);
+
+            auto const directory = std::filesystem::temp_directory_path() / "dwarf_symbolizer_test";
+            std::filesystem::create_directories(directory);
+            auto const exe_path = directory / "example_program.exe";
+            auto const write_exe = [&]() {
+                std::ofstream file(exe_path, std::ios::binary);
+                file.write(exe.data(), static_cast<std::streamsize>(exe.size()));
+            };
+            write_exe();
+
+            // the address range of main
+            uint64_t low_pc = 0;
+            uint64_t high_pc = 0;
+            std::string unit_name;
+            for(dwarf::UnitHeader const unit_header : dwarf::DebugInfo(sections.debug_info)) {
+                dwarf::Unit const unit(sections, unit_header);
+                dwarf::DieCursor cursor(unit);
+                while(cursor.next() && low_pc == 0) {
+                    auto const & die = cursor.die();
+                    auto const name = die.attribute(dwarf::Attribute::dw_at_name);
+                    if(die.tag() == dwarf::Tag::dw_tag_subprogram && name.is_valid() && name.as_string() == "main"
+                        && die.attribute(dwarf::Attribute::dw_at_low_pc).is_valid()) {
+                        low_pc = die.attribute(dwarf::Attribute::dw_at_low_pc).as_address();
+                        high_pc = low_pc + die.attribute(dwarf::Attribute::dw_at_high_pc).as_unsigned();
+                        unit_name = dwarf::DIE(unit, unit.first_die_offset()).attribute(dwarf::Attribute::dw_at_name).as_string();
+                    }
+                }
+            }
+
+            ut::Then() = [&]() noexcept {
+                ut::check(low_pc != 0);
+
+                dwarf::Symbolizer symbolizer(2);
+                auto const image = symbolizer.image(exe_path);
+                ut::check(image != nullptr);
+                ut::check(image->size() > 0);
+                ut::check(image->symbolize(low_pc).function == "main");
+                ut::check(image->symbolize(high_pc - 1).function == "main");
+                ut::check(image->symbolize(high_pc).function != "main");
+                ut::check(image->symbolize(low_pc + 1).unit == unit_name);
+                ut::check(image->symbolize(0).function.empty());
+
+                // functions without debug information are found in the COFF symbol table
+                pei::SymbolIndex const symbols(exe);
+                auto const * const main_symbol = symbols.find(low_pc + 1);
+                ut::check(main_symbol != nullptr && main_symbol->name == "main" && main_symbol->address == low_pc);
+                auto const startup = std::ranges::find(symbols.entries(), "mainCRTStartup", &pei::SymbolIndex::Entry::name);
+                ut::check(startup != symbols.entries().end() && startup->is_function);
+                ut::check(image->symbolize(startup->address + 1).function == "mainCRTStartup");
+                ut::check(image->symbolize(startup->address + 1).unit.empty());
+
+                // a DLL without debug information and symbols is symbolized by its exports
+                auto const dll_path = directory / "fixture.dll";
+                {
+                    auto const dll = fixture::make_dll("fixture.dll", {{"add", 0x00}, {"sub", 0x20}});
+                    std::ofstream file(dll_path, std::ios::binary);
+                    file.write(dll.data(), static_cast<std::streamsize>(dll.size()));
+                }
+                dwarf::Symbolizer dll_symbolizer;
+                auto const dll_image = dll_symbolizer.image(dll_path);
+                ut::check(dll_image != nullptr && dll_image->size() == 0);
+                ut::check(dll_image->symbolize(0x180001024).function == "sub");
+                ut::check(dll_image->symbolize(0x180001024).low_pc == 0x180001020);
+                ut::check(dll_image->symbolize(0x180000000).function.empty());
+
+                // a copy of a DLL with the same build identity reuses the functions of the loaded image
+                {
+                    auto const dll = fixture::make_dll("fixture.dll", {{"add", 0x00}, {"sub", 0x20}}, 0x180000000,
+                        fixture::make_codeview("0123456789abcdef", 1));
+                    std::ofstream file(dll_path, std::ios::binary);
+                    file.write(dll.data(), static_cast<std::streamsize>(dll.size()));
+                }
+                auto const built = dll_symbolizer.image(dll_path);
+                ut::check(built != dll_image && built->key().is_stable());
+                std::filesystem::last_write_time(dll_path, std::filesystem::last_write_time(dll_path) + std::chrono::seconds(1));
+                auto const copied = dll_symbolizer.image(dll_path);
+                ut::check(copied != built && copied->key() == built->key());
+                ut::check(copied->symbolize(0x180001024).function == "sub");
+                ut::check(dll_symbolizer.statistics().reloads == 2);
+
+                ut::check(symbolizer.image(exe_path) == image);
+                ut::check(symbolizer.image(directory / "missing.exe") == nullptr);
+                ut::check(symbolizer.statistics().hits == 1);
+                ut::check(symbolizer.statistics().failures == 1);
+
+                // a rebuilt file is reloaded, the unchanged units are not parsed again
+                write_exe();
+                std::filesystem::last_write_time(exe_path, std::filesystem::last_write_time(exe_path) + std::chrono::seconds(1));
+                auto const reloaded = symbolizer.image(exe_path);
+                ut::check(reloaded != image);
+                ut::check(symbolizer.statistics().reloads == 1);
+                ut::check(reloaded->index_update().parsed == 0);
+                ut::check(reloaded->symbolize(low_pc).function == "main");
+            };
+
+            ut::Then() = [&]() noexcept {
+                // the requests of a client over the socket
+                dwarf::SymbolizerServer server(directory / "symbolizer.sock", 16, std::chrono::milliseconds(200));
+                std::thread thread([&]() { server.run(); });
+
+                // a connection that sends raw bytes, it waits at most 5 s for an answer
+                auto const connect = [&]() {
+                    auto const address = dwarf::details::make_socket_address(server.socket_path());
+                    int const fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+                    timeval const timeout = {5, 0};
+                    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                    ut::check(::connect(fd, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) == 0);
+                    return fd;
+                };
+                auto const is_closed_by_server = [](int const fd) {
+                    char c = 0;
+                    return ::recv(fd, &c, 1, 0) == 0;
+                };
+
+                {
+                    dwarf::SymbolizerClient client(server.socket_path());
+                    std::vector<uint64_t> const pcs = {low_pc, low_pc + 1, 0, high_pc - 1};
+                    auto const response = client.symbolize(exe_path.string(), pcs);
+                    ut::check(response.status == dwarf::SymbolizerStatus::ok);
+                    ut::check(response.results.size() == pcs.size());
+                    ut::check(response.results[0].function == "main");
+                    ut::check(response.results[0].low_pc == low_pc);
+                    ut::check(response.results[0].unit == unit_name);
+                    ut::check(response.results[1] == response.results[0]);
+                    ut::check(response.results[2].function.empty());
+                    ut::check(response.results[3] == response.results[0]);
+
+                    // a second batch on the same connection, answered from the resident image
+                    auto const second = client.symbolize(exe_path.string(), std::vector<uint64_t>{low_pc});
+                    ut::check(second.results.size() == 1);
+                    ut::check(second.results[0] == response.results[0]);
+
+                    auto const missing = client.symbolize((directory / "missing.exe").string(), pcs);
+                    ut::check(missing.status == dwarf::SymbolizerStatus::image_not_found);
+                    ut::check(missing.results.empty());
+                }
+
+                {
+                    // a request of another version is answered with bad_request
+                    int const fd = connect();
+                    auto request = dwarf::encode_symbolizer_request(exe_path.string(), std::vector<uint64_t>{low_pc});
+                    request[4] = 9;
+                    ut::check(dwarf::details::send_all(fd, request));
+                    std::vector<char> message;
+                    ut::check(dwarf::details::receive_message(fd, message, UINT32_MAX));
+                    ut::check(dwarf::decode_symbolizer_response(message).status == dwarf::SymbolizerStatus::bad_request);
+
+                    // the connection stays open, a message with a wrong magic closes it
+                    request[4] = 1;
+                    request[0] = 'X';
+                    ut::check(dwarf::details::send_all(fd, request));
+                    ut::check(is_closed_by_server(fd));
+                    ::close(fd);
+                }
+
+                {
+                    // clients that stall in the middle of a message or do not read a large response
+                    int const partial_header = connect();
+                    ut::check(dwarf::details::send_all(partial_header, std::vector<char>{'D', 'S'}));
+
+                    int const partial_data = connect();
+                    auto const request = dwarf::encode_symbolizer_request(exe_path.string(), std::vector<uint64_t>{low_pc});
+                    ut::check(dwarf::details::send_all(partial_data, std::span<char const>(request).first(request.size() - 3)));
+
+                    int const unread = connect();
+                    std::vector<uint64_t> const many(200000, low_pc);
+                    ut::check(dwarf::details::send_all(unread, dwarf::encode_symbolizer_request(exe_path.string(), many)));
+
+                    // another client is answered meanwhile
+                    dwarf::SymbolizerClient client(server.socket_path());
+                    ut::check(client.symbolize(exe_path.string(), std::vector<uint64_t>{}).results.empty());
+                    auto const response = client.symbolize(exe_path.string(), std::vector<uint64_t>{low_pc});
+                    ut::check(response.results.size() == 1 && response.results[0].function == "main");
+
+                    // the stalled connections are dropped after the timeout
+                    ut::check(is_closed_by_server(partial_header));
+                    ut::check(is_closed_by_server(partial_data));
+                    ::close(partial_header);
+                    ::close(partial_data);
+                    ::close(unread);
+                }
+
+                {
+                    // files that are not a PE image, or are cut off in the headers, are not loaded
+                    auto const write = [&](std::filesystem::path const & path, std::span<char const> const data) {
+                        std::ofstream file(path, std::ios::binary);
+                        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+                        return path.string();
+                    };
+                    std::string_view const text = "not an image, only a line of text\n";
+                    std::vector<std::string> const paths = {
+                        write(directory / "garbage.bin", text),
+                        write(directory / "truncated_100.exe", exe.first(100)),
+                        write(directory / "truncated_600.exe", exe.first(600)),
+                        write(directory / "truncated_half.exe", exe.first(exe.size() / 2)),
+                    };
+
+                    dwarf::SymbolizerClient client(server.socket_path());
+                    for(auto const & path : paths) {
+                        auto const response = client.symbolize(path, std::vector<uint64_t>{low_pc});
+                        ut::check(response.status != dwarf::SymbolizerStatus::ok || response.results.size() == 1);
+                    }
+                    ut::check(client.symbolize(paths[0], std::vector<uint64_t>{low_pc}).status == dwarf::SymbolizerStatus::image_not_found);
+                    ut::check(client.symbolize(paths[2], std::vector<uint64_t>{low_pc}).status == dwarf::SymbolizerStatus::image_not_found);
+
+                    // the server still answers, on the same and on a new connection
+                    ut::check(client.symbolize(exe_path.string(), std::vector<uint64_t>{low_pc}).results[0].function == "main");
+                    dwarf::SymbolizerClient other(server.socket_path());
+                    ut::check(other.symbolize(exe_path.string(), std::vector<uint64_t>{low_pc}).results[0].function == "main");
+                }
+
+                // stops while a client is connected
+                dwarf::SymbolizerClient idle(server.socket_path());
+                server.stop();
+                thread.join();
+
+                auto const & statistics = server.symbolizer().statistics();
+                // the image cut off behind its headers is loaded, the others are not
+                ut::check(statistics.misses == 2);
+                ut::check(statistics.hits == 6);
+                ut::check(statistics.failures == 6);
+
+                std::filesystem::remove_all(directory);
+            };
+        };
+    };
+#endif
+
     return true;
 }
 
@@ -0,0 +1,157 @@
+///
+/// @file:   column_decoder.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Compares the AVX2 gathers of the column decoder with decoding element by element,
+///          compiled with -mavx2 and skipped on processors without AVX2
+///
+
+#include "ut/ut.hpp"
+#include "dwarf/types/column_decoder.hpp"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    ///
+    /// @brief Decodes a column element by element, the reference for the AVX2 gathers
+    ///
+    template<typename T>
+    [[nodiscard]] auto
+    decode_scalar(std::span<char const> const elements, size_t const stride, dwarf::LayoutLeaf const & leaf, size_t const count) -> std::vector<T>
+    {
+        std::vector<T> res(count);
+        for(size_t i = 0; i < count; ++i) {
+            res[i] = dwarf::details::convert_leaf_value<T>(leaf, leaf.extract(elements.subspan(i * stride, stride)));
+        }
+        return res;
+    }
+
+    [[nodiscard]] auto
+    make_leaf(uint64_t const offset, uint64_t const byte_size, dwarf::BaseTypeAttributeEncoding const encoding,
+        uint32_t const bit_offset = 0, uint32_t const bit_size = 0) -> dwarf::LayoutLeaf
+    {
+        dwarf::LayoutLeaf leaf = {};
+        leaf.offset = offset;
+        leaf.byte_size = byte_size;
+        leaf.encoding = encoding;
+        leaf.bit_offset = bit_offset;
+        leaf.bit_size = bit_size;
+        return leaf;
+    }
+
+    ///
+    /// @brief Decodes a leaf with the AVX2 gathers and with dwarf::decode_column() and compares
+    ///     both with the element by element decoding
+    /// @param gathered true if the gathers must decode at least one element
+    ///
+    template<typename T>
+    [[nodiscard]] auto
+    is_decoded_equal(std::span<char const> const elements, size_t const stride, dwarf::LayoutLeaf const & leaf,
+        bool const gathered) -> bool
+    {
+        size_t const count = elements.size() / stride;
+        auto const expected = decode_scalar<T>(elements, stride, leaf, count);
+
+        std::vector<T> column(count);
+        size_t const decoded = dwarf::details::decode_column_avx2<T>(elements, stride, leaf, column);
+        if(decoded > count || (gathered && decoded == 0) || !std::equal(column.begin(), column.begin() + decoded, expected.begin())) {
+            return false;
+        }
+
+        std::vector<T> full_column(count);
+        return dwarf::decode_column<T>(elements, stride, leaf, full_column) == count && full_column == expected;
+    }
+}
+
+[[nodiscard]] auto
+tests() noexcept -> bool
+{
+    using Encoding = dwarf::BaseTypeAttributeEncoding;
+
+    ut::Scenario("avx2_gathers") = []() noexcept
+    {
+        ut::Given() = []() noexcept {
+            // 37 elements of 24 bytes of random data, so that the last elements are decoded one by one
+            std::vector<char> elements(37 * 24);
+            std::mt19937 random(7);
+            for(auto & c : elements) {
+                c = static_cast<char>(random());
+            }
+            size_t const stride = 24;
+
+            ut::Then() = [&]() noexcept {
+                // 32 bit columns
+                ut::check(is_decoded_equal<int32_t>(elements, stride, make_leaf(4, 4, Encoding::dw_ate_signed_), true));
+                ut::check(is_decoded_equal<uint32_t>(elements, stride, make_leaf(20, 4, Encoding::dw_ate_unsigned_), true));
+                ut::check(is_decoded_equal<int32_t>(elements, stride, make_leaf(3, 2, Encoding::dw_ate_signed_), true));
+                ut::check(is_decoded_equal<uint32_t>(elements, stride, make_leaf(7, 1, Encoding::dw_ate_unsigned_char), true));
+                ut::check(is_decoded_equal<float>(elements, stride, make_leaf(8, 4, Encoding::dw_ate_float_), true));
+            };
+
+            ut::Then() = [&]() noexcept {
+                // 64 bit columns
+                ut::check(is_decoded_equal<int64_t>(elements, stride, make_leaf(16, 8, Encoding::dw_ate_signed_), true));
+                ut::check(is_decoded_equal<uint64_t>(elements, stride, make_leaf(0, 8, Encoding::dw_ate_unsigned_), true));
+                ut::check(is_decoded_equal<int64_t>(elements, stride, make_leaf(12, 4, Encoding::dw_ate_signed_), true));
+                ut::check(is_decoded_equal<uint64_t>(elements, stride, make_leaf(5, 2, Encoding::dw_ate_unsigned_), true));
+                ut::check(is_decoded_equal<double>(elements, stride, make_leaf(8, 8, Encoding::dw_ate_float_), true));
+            };
+
+            ut::Then() = [&]() noexcept {
+                // bit fields, sign extended if signed
+                ut::check(is_decoded_equal<int32_t>(elements, stride, make_leaf(2, 2, Encoding::dw_ate_signed_, 3, 9), true));
+                ut::check(is_decoded_equal<uint32_t>(elements, stride, make_leaf(2, 1, Encoding::dw_ate_unsigned_, 5, 3), true));
+                ut::check(is_decoded_equal<int64_t>(elements, stride, make_leaf(9, 5, Encoding::dw_ate_signed_, 7, 31), true));
+                ut::check(is_decoded_equal<uint64_t>(elements, stride, make_leaf(9, 5, Encoding::dw_ate_unsigned_, 1, 33), true));
+            };
+
+            ut::Then() = [&]() noexcept {
+                // columns the gathers leave to the element by element decoding
+                ut::check(is_decoded_equal<int32_t>(elements, stride, make_leaf(0, 8, Encoding::dw_ate_signed_), false));
+                ut::check(is_decoded_equal<float>(elements, stride, make_leaf(0, 8, Encoding::dw_ate_float_), false));
+                ut::check(is_decoded_equal<int32_t>(elements, stride, make_leaf(8, 4, Encoding::dw_ate_float_), false));
+                ut::check(is_decoded_equal<int16_t>(elements, stride, make_leaf(0, 2, Encoding::dw_ate_signed_), false));
+            };
+
+            ut::Then() = [&]() noexcept {
+                // the last element ends at the end of the data, no gather reads beyond it
+                std::span<char const> const tail = std::span<char const>(elements).first(9 * stride);
+                ut::check(is_decoded_equal<uint32_t>(tail, stride, make_leaf(stride - 4, 4, Encoding::dw_ate_unsigned_), true));
+                ut::check(is_decoded_equal<uint64_t>(tail, stride, make_leaf(stride - 8, 8, Encoding::dw_ate_unsigned_), true));
+
+                // a stride of one byte
+                ut::check(is_decoded_equal<uint32_t>(tail, 1, make_leaf(0, 1, Encoding::dw_ate_unsigned_char), true));
+                ut::check(is_decoded_equal<int64_t>(tail, 1, make_leaf(0, 1, Encoding::dw_ate_signed_char), true));
+            };
+        };
+    };
+
+    return true;
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> int
+{
+#if defined(__AVX2__)
+    if(!__builtin_cpu_supports("avx2")) {
+        std::printf("skipped, the processor does not support AVX2\n");
+        return EXIT_SUCCESS;
+    }
+
+    return tests() ? EXIT_SUCCESS : EXIT_FAILURE;
+#else
+    std::printf("skipped, the compiler does not support -mavx2\n");
+    return EXIT_SUCCESS;
+#endif
+}
@@ -0,0 +1,1116 @@
+///
+/// @file:   dwarf_fixture.hpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Creates small DWARF sections and split DWARF files for tests and benchmarks
+///
+
+#pragma once
+
+#include "dwarf/debug_sections.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(DWARF_READER_HAS_ZLIB)
+#include <zlib.h>
+#endif
+
+namespace fixture
+{
+    /// @brief The content of a file or a section
+    using Bytes = std::vector<char>;
+
+    template<typename T>
+    inline auto
+    append(Bytes & bytes, T const value) -> void
+    {
+        for(size_t i = 0; i < sizeof(T); ++i) {
+            bytes.push_back(static_cast<char>(static_cast<uint64_t>(value) >> (i * 8)));
+        }
+    }
+
+    inline auto
+    append_string(Bytes & bytes, std::string_view const str) -> void
+    {
+        bytes.insert(bytes.end(), str.begin(), str.end());
+        bytes.push_back('\0');
+    }
+
+    /// @class fixture::PipeBuffer
+    ///
+    /// @brief A stream buffer that hands out the data in small pieces and reports no available
+    ///     characters, like the buffer of std::cin reading from a pipe
+    ///
+    class PipeBuffer final : public std::streambuf
+    {
+    public:
+        explicit PipeBuffer(std::span<char const> const data) noexcept
+            : data_(data) {}
+
+    protected:
+        auto
+        underflow() -> int_type override
+        {
+            if(index_ == data_.size()) {
+                return traits_type::eof();
+            }
+
+            auto * const begin = const_cast<char *>(data_.data() + index_);
+            size_t const count = std::min<size_t>(16, data_.size() - index_);
+            setg(begin, begin, begin + count);
+            index_ += count;
+            return traits_type::to_int_type(*begin);
+        }
+
+    private:
+        std::span<char const> data_;
+        size_t index_ = 0;
+    };
+
+    ///
+    /// @brief Sets the unit_length of a 32-bit unit starting at offset
+    ///
+    inline auto
+    finish_unit(Bytes & bytes, size_t const offset) -> void
+    {
+        auto const length = static_cast<uint32_t>(bytes.size() - offset - sizeof(uint32_t));
+        for(size_t i = 0; i < sizeof(uint32_t); ++i) {
+            bytes[offset + i] = static_cast<char>(length >> (i * 8));
+        }
+    }
+
+    ///
+    /// @brief Creates a COFF object file, the format of a .dwo file of a MinGW build
+    /// @param sections the names and the data of the sections
+    ///
+    inline auto
+    make_coff_object(std::vector<std::pair<std::string, Bytes>> const & sections) -> Bytes
+    {
+        size_t const file_header_size = 20;
+        size_t const section_header_size = 40;
+
+        Bytes strings(sizeof(uint32_t), '\0');
+        size_t offset = file_header_size + sections.size() * section_header_size;
+
+        Bytes res;
+        append<uint16_t>(res, 0x8664);                  // machine
+        append<uint16_t>(res, sections.size());         // number_of_sections
+        append<uint32_t>(res, 0);                       // time_date_stamp
+        size_t const pointer_to_symbol_table = res.size();
+        append<uint32_t>(res, 0);                       // pointer_to_symbol_table, the string table follows the data
+        append<uint32_t>(res, 0);                       // number_of_symbols
+        append<uint16_t>(res, 0);                       // size_of_optional_header
+        append<uint16_t>(res, 0);                       // characteristics
+
+        for(auto const & [name, data] : sections) {
+            std::string short_name = name;
+            if(name.size() > 8) {
+                short_name = "/" + std::to_string(strings.size());
+                append_string(strings, name);
+            }
+            short_name.resize(8, '\0');
+
+            res.insert(res.end(), short_name.begin(), short_name.end());
+            append<uint32_t>(res, 0);                   // virtual_size
+            append<uint32_t>(res, 0);                   // virtual_address
+            append<uint32_t>(res, data.size());         // size_of_raw_data
+            append<uint32_t>(res, offset);              // pointer_to_raw_data
+            append<uint32_t>(res, 0);                   // pointer_to_relocations
+            append<uint32_t>(res, 0);                   // pointer_to_linenumbers
+            append<uint16_t>(res, 0);                   // number_of_relocations
+            append<uint16_t>(res, 0);                   // number_of_linenumbers
+            append<uint32_t>(res, 0x42000040);          // characteristics: discardable, readable, initialized data
+            offset += data.size();
+        }
+
+        for(auto const & section : sections) {
+            res.insert(res.end(), section.second.begin(), section.second.end());
+        }
+
+        for(size_t i = 0; i < sizeof(uint32_t); ++i) {
+            res[pointer_to_symbol_table + i] = static_cast<char>(res.size() >> (i * 8));
+            strings[i] = static_cast<char>(strings.size() >> (i * 8));
+        }
+        res.insert(res.end(), strings.begin(), strings.end());
+
+        return res;
+    }
+
+    ///
+    /// @brief Creates a CodeView RSDS record for fixture::make_dll()
+    /// @param guid the 16 bytes of the GUID
+    ///
+    inline auto
+    make_codeview(std::string_view const guid, uint32_t const age, std::string_view const pdb_path = {}) -> Bytes
+    {
+        Bytes res = {'R', 'S', 'D', 'S'};
+        res.insert(res.end(), guid.begin(), guid.end());
+        res.resize(4 + 16, '\0');
+        append<uint32_t>(res, age);
+        append_string(res, pdb_path);
+        return res;
+    }
+
+    /// @class fixture::DllExport
+    ///
+    /// @brief An export of fixture::make_dll(), a forwarder if forwarder is not empty
+    ///
+    struct DllExport final
+    {
+        std::string name;
+        /// @brief The offset of the export in the .text section
+        uint32_t offset = 0;
+        std::string forwarder = {};
+    };
+
+    ///
+    /// @brief Creates a PE32+ DLL with a .text section of at least 0x100 bytes at RVA 0x1000 and an export
+    ///     table in an .edata section behind it
+    /// @param name the name of the DLL in the export table
+    /// @param exports the exports with ordinals starting at 1, an empty name exports by ordinal only
+    /// @param codeview if not empty, a CodeView record of a debug directory behind the export table
+    ///
+    inline auto
+    make_dll(std::string_view const name, std::vector<DllExport> const & exports, uint64_t const image_base = 0x180000000,
+        Bytes const & codeview = {}) -> Bytes
+    {
+        uint32_t const text_rva = 0x1000;
+        uint32_t text_size = 0x100;
+        for(auto const & entry : exports) {
+            text_size = std::max(text_size, (entry.offset + 0x10) & ~0xfu);
+        }
+        uint32_t const text_raw_size = (text_size + 0x1ff) & ~0x1ffu;
+        uint32_t const edata_rva = text_rva + ((text_size + 0xfff) & ~0xfffu);
+        uint32_t const headers_size = 0x200;
+
+        // the export directory table, the export address, name pointer and ordinal tables and the strings
+        std::vector<uint32_t> named;
+        for(uint32_t i = 0; i < exports.size(); ++i) {
+            if(!exports[i].name.empty()) {
+                named.push_back(i);
+            }
+        }
+        std::ranges::sort(named, {}, [&](uint32_t const index) { return exports[index].name; });
+
+        uint32_t const address_table = edata_rva + 40;
+        uint32_t const name_pointers = address_table + 4 * static_cast<uint32_t>(exports.size());
+        uint32_t const ordinals = name_pointers + 4 * static_cast<uint32_t>(named.size());
+        uint32_t const strings_rva = ordinals + 2 * static_cast<uint32_t>(named.size());
+
+        Bytes strings;
+        auto const add_string = [&](std::string_view const str) {
+            auto const rva = strings_rva + static_cast<uint32_t>(strings.size());
+            append_string(strings, str);
+            return rva;
+        };
+
+        Bytes edata;
+        append<uint32_t>(edata, 0);                         // export_flags
+        append<uint32_t>(edata, 0);                         // time_date_stamp
+        append<uint32_t>(edata, 0);                         // major_version, minor_version
+        append<uint32_t>(edata, add_string(name));          // name_rva
+        append<uint32_t>(edata, 1);                         // ordinal_base
+        append<uint32_t>(edata, exports.size());            // address_table_entries
+        append<uint32_t>(edata, named.size());              // number_of_name_pointers
+        append<uint32_t>(edata, address_table);
+        append<uint32_t>(edata, name_pointers);
+        append<uint32_t>(edata, ordinals);
+        for(auto const & entry : exports) {
+            append<uint32_t>(edata, entry.forwarder.empty() ? text_rva + entry.offset : add_string(entry.forwarder));
+        }
+        for(auto const index : named) {
+            append<uint32_t>(edata, add_string(exports[index].name));
+        }
+        for(auto const index : named) {
+            append<uint16_t>(edata, index);
+        }
+        edata.insert(edata.end(), strings.begin(), strings.end());
+        auto const export_size = static_cast<uint32_t>(edata.size());
+
+        // the debug directory with one entry and its CodeView record
+        uint32_t debug_rva = 0;
+        if(!codeview.empty()) {
+            edata.resize((edata.size() + 3) & ~size_t{3}, '\0');
+            debug_rva = edata_rva + static_cast<uint32_t>(edata.size());
+            auto const record = static_cast<uint32_t>(edata.size()) + 28;
+            append<uint32_t>(edata, 0);                     // characteristics
+            append<uint32_t>(edata, 0);                     // time_date_stamp
+            append<uint32_t>(edata, 0);                     // major_version, minor_version
+            append<uint32_t>(edata, 2);                     // type, CodeView
+            append<uint32_t>(edata, codeview.size());       // size_of_data
+            append<uint32_t>(edata, edata_rva + record);    // address_of_raw_data
+            append<uint32_t>(edata, headers_size + text_raw_size + record); // pointer_to_raw_data
+            edata.insert(edata.end(), codeview.begin(), codeview.end());
+        }
+        auto const edata_size = static_cast<uint32_t>(edata.size());
+
+        Bytes res(0x40, '\0');
+        res[0] = 'M';
+        res[1] = 'Z';
+        res[0x3c] = 0x40;                                   // lfanew
+        append_string(res, "PE");
+        append<uint8_t>(res, 0);
+
+        append<uint16_t>(res, 0x8664);                      // machine
+        append<uint16_t>(res, 2);                           // number_of_sections
+        append<uint32_t>(res, 0);                           // time_date_stamp
+        append<uint32_t>(res, 0);                           // pointer_to_symbol_table
+        append<uint32_t>(res, 0);                           // number_of_symbols
+        append<uint16_t>(res, 240);                         // size_of_optional_header
+        append<uint16_t>(res, 0x2022);                      // characteristics: DLL, large address aware, executable
+
+        append<uint16_t>(res, 0x20b);                       // magic, PE32+
+        append<uint16_t>(res, 0);                           // linker version
+        append<uint32_t>(res, text_size);                   // size_of_code
+        append<uint32_t>(res, edata_size);                  // size_of_initialized_data
+        append<uint32_t>(res, 0);                           // size_of_uninitialized_data
+        append<uint32_t>(res, 0);                           // address_of_entry_point
+        append<uint32_t>(res, text_rva);                    // base_of_code
+        append<uint64_t>(res, image_base);
+        append<uint32_t>(res, 0x1000);                      // section_alignment
+        append<uint32_t>(res, 0x200);                       // file_alignment
+        append<uint64_t>(res, 0);                           // operating system and image versions
+        append<uint64_t>(res, 0);                           // subsystem versions, reserved1
+        append<uint32_t>(res, edata_rva + ((edata_size + 0xfff) & ~0xfffu)); // size_of_image
+        append<uint32_t>(res, headers_size);                // size_of_headers
+        append<uint32_t>(res, 0);                           // check_sum
+        append<uint16_t>(res, 3);                           // subsystem, console
+        append<uint16_t>(res, 0);                           // dll_characteristics
+        for(size_t i = 0; i < 4; ++i) {
+            append<uint64_t>(res, 0);                       // stack and heap sizes
+        }
+        append<uint32_t>(res, 0);                           // loader_flags
+        append<uint32_t>(res, 16);                          // number_of_rva_and_sizes
+        append<uint32_t>(res, edata_rva);                   // export table
+        append<uint32_t>(res, export_size);
+        for(size_t i = 1; i < 16; ++i) {
+            append<uint32_t>(res, i == 6 ? debug_rva : 0);  // debug directory
+            append<uint32_t>(res, i == 6 && debug_rva != 0 ? 28 : 0);
+        }
+
+        auto const append_section = [&](std::string name_of_section, uint32_t const rva, uint32_t const size, uint32_t const offset,
+            uint32_t const characteristics) {
+            name_of_section.resize(8, '\0');
+            res.insert(res.end(), name_of_section.begin(), name_of_section.end());
+            append<uint32_t>(res, size);                    // virtual_size
+            append<uint32_t>(res, rva);                     // virtual_address
+            append<uint32_t>(res, (size + 0x1ff) & ~0x1ffu); // size_of_raw_data
+            append<uint32_t>(res, offset);                  // pointer_to_raw_data
+            append<uint32_t>(res, 0);                       // pointer_to_relocations
+            append<uint32_t>(res, 0);                       // pointer_to_linenumbers
+            append<uint32_t>(res, 0);                       // number_of_relocations, number_of_linenumbers
+            append<uint32_t>(res, characteristics);
+        };
+        append_section(".text", text_rva, text_size, headers_size, 0x60000020);
+        append_section(".edata", edata_rva, edata_size, headers_size + text_raw_size, 0x40000040);
+
+        res.resize(headers_size, '\0');
+        res.resize(headers_size + text_raw_size, static_cast<char>(0xc3));
+        edata.resize((edata.size() + 0x1ff) & ~size_t{0x1ff}, '\0');
+        res.insert(res.end(), edata.begin(), edata.end());
+
+        return res;
+    }
+
+    /// @class fixture::DebugSectionsData
+    ///
+    /// @brief The data of the .debug_info, .debug_abbrev, .debug_line, .debug_str, .debug_addr, .debug_macro,
+    ///     .debug_ranges and .debug_rnglists sections
+    ///
+    struct DebugSectionsData final
+    {
+        Bytes debug_info;
+        Bytes debug_abbrev;
+        Bytes debug_line;
+        Bytes debug_str = {};
+        Bytes debug_addr = {};
+        Bytes debug_macro = {};
+        Bytes debug_ranges = {};
+        Bytes debug_rnglists = {};
+
+        [[nodiscard]] auto
+        sections() const noexcept -> dwarf::DebugSections
+        {
+            dwarf::DebugSections res = {};
+            res.debug_info = debug_info;
+            res.debug_abbrev = debug_abbrev;
+            res.debug_line = debug_line;
+            res.debug_str = debug_str;
+            res.debug_addr = debug_addr;
+            res.debug_macro = debug_macro;
+            res.debug_ranges = debug_ranges;
+            res.debug_rnglists = debug_rnglists;
+            return res;
+        }
+    };
+
+    ///
+    /// @brief Appends a DWARF 5 skeleton unit to the sections of a binary file
+    /// @details All skeleton units share one abbreviation table at offset 0
+    ///
+    inline auto
+    append_skeleton_unit(DebugSectionsData & sections, uint64_t const dwo_id, std::string_view const dwo_name,
+        std::string_view const comp_dir) -> void
+    {
+        if(sections.debug_abbrev.empty()) {
+            // 1: DW_TAG_skeleton_unit, no children, DW_AT_dwo_name and DW_AT_comp_dir as DW_FORM_string
+            sections.debug_abbrev = {1, 0x4a, 0, 0x76, 0x08, 0x1b, 0x08, 0, 0, 0};
+        }
+
+        auto & info = sections.debug_info;
+        size_t const offset = info.size();
+        append<uint32_t>(info, 0);          // unit_length
+        append<uint16_t>(info, 5);          // version
+        append<uint8_t>(info, 0x04);        // DW_UT_skeleton
+        append<uint8_t>(info, 8);           // address_size
+        append<uint32_t>(info, 0);          // debug_abbrev_offset
+        append<uint64_t>(info, dwo_id);
+
+        append<uint8_t>(info, 1);
+        append_string(info, dwo_name);
+        append_string(info, comp_dir);
+        finish_unit(info, offset);
+    }
+
+    ///
+    /// @brief Appends a DWARF 5 split compilation unit to the sections of a .dwo file
+    /// @details The unit entry is named name and has one child, a base type named type_name
+    ///
+    inline auto
+    append_split_unit(DebugSectionsData & sections, uint64_t const dwo_id, std::string_view const name,
+        std::string_view const type_name) -> void
+    {
+        size_t const abbrev_offset = sections.debug_abbrev.size();
+        // 1: DW_TAG_compile_unit with children, DW_AT_name as DW_FORM_string
+        // 2: DW_TAG_base_type, no children, DW_AT_name as DW_FORM_string
+        Bytes const abbrev = {1, 0x11, 1, 0x03, 0x08, 0, 0, 2, 0x24, 0, 0x03, 0x08, 0, 0, 0};
+        sections.debug_abbrev.insert(sections.debug_abbrev.end(), abbrev.begin(), abbrev.end());
+
+        auto & info = sections.debug_info;
+        size_t const offset = info.size();
+        append<uint32_t>(info, 0);          // unit_length
+        append<uint16_t>(info, 5);          // version
+        append<uint8_t>(info, 0x05);        // DW_UT_split_compile
+        append<uint8_t>(info, 8);           // address_size
+        append<uint32_t>(info, abbrev_offset);
+        append<uint64_t>(info, dwo_id);
+
+        append<uint8_t>(info, 1);
+        append_string(info, name);
+        append<uint8_t>(info, 2);
+        append_string(info, type_name);
+        append<uint8_t>(info, 0);
+        finish_unit(info, offset);
+    }
+
+    ///
+    /// @brief Creates a .dwo file with one split unit
+    ///
+    inline auto
+    make_dwo(uint64_t const dwo_id, std::string_view const name, std::string_view const type_name) -> Bytes
+    {
+        DebugSectionsData sections;
+        append_split_unit(sections, dwo_id, name, type_name);
+
+        return make_coff_object({
+            {".debug_info.dwo", sections.debug_info},
+            {".debug_abbrev.dwo", sections.debug_abbrev}
+        });
+    }
+
+    /// @brief The dwo_id, the name and the name of the base type of a split unit
+    using SplitUnit = std::tuple<uint64_t, std::string, std::string>;
+
+    ///
+    /// @brief Creates a DWARF 5 package file of split units with a .debug_cu_index section
+    ///
+    inline auto
+    make_dwp(std::vector<SplitUnit> const & units) -> Bytes
+    {
+        DebugSectionsData package;
+        std::vector<std::pair<uint32_t, uint32_t>> info_contributions;
+        std::vector<std::pair<uint32_t, uint32_t>> abbrev_contributions;
+
+        for(auto const & [dwo_id, name, type_name] : units) {
+            // each unit refers to its own contribution to .debug_abbrev.dwo at offset 0
+            DebugSectionsData unit;
+            append_split_unit(unit, dwo_id, name, type_name);
+
+            info_contributions.emplace_back(package.debug_info.size(), unit.debug_info.size());
+            abbrev_contributions.emplace_back(package.debug_abbrev.size(), unit.debug_abbrev.size());
+            package.debug_info.insert(package.debug_info.end(), unit.debug_info.begin(), unit.debug_info.end());
+            package.debug_abbrev.insert(package.debug_abbrev.end(), unit.debug_abbrev.begin(), unit.debug_abbrev.end());
+        }
+
+        uint32_t slot_count = 1;
+        while(slot_count < 2 * units.size()) {
+            slot_count *= 2;
+        }
+
+        std::vector<uint64_t> signatures(slot_count, 0);
+        std::vector<uint32_t> rows(slot_count, 0);
+        for(size_t i = 0; i < units.size(); ++i) {
+            uint64_t const dwo_id = std::get<0>(units[i]);
+            uint64_t const mask = slot_count - 1;
+            uint64_t slot = dwo_id & mask;
+            uint64_t const step = ((dwo_id >> 32) & mask) | 1;
+            while(rows[slot] != 0) {
+                slot = (slot + step) & mask;
+            }
+            signatures[slot] = dwo_id;
+            rows[slot] = static_cast<uint32_t>(i + 1);
+        }
+
+        Bytes index;
+        append<uint16_t>(index, 5);                 // version
+        append<uint16_t>(index, 0);                 // padding
+        append<uint32_t>(index, 2);                 // section_count
+        append<uint32_t>(index, units.size());      // unit_count
+        append<uint32_t>(index, slot_count);        // slot_count
+        for(auto const signature : signatures) {
+            append<uint64_t>(index, signature);
+        }
+        for(auto const row : rows) {
+            append<uint32_t>(index, row);
+        }
+
+        append<uint32_t>(index, 1);                 // DW_SECT_INFO
+        append<uint32_t>(index, 3);                 // DW_SECT_ABBREV
+        for(size_t i = 0; i < units.size(); ++i) {
+            append<uint32_t>(index, info_contributions[i].first);
+            append<uint32_t>(index, abbrev_contributions[i].first);
+        }
+        for(size_t i = 0; i < units.size(); ++i) {
+            append<uint32_t>(index, info_contributions[i].second);
+            append<uint32_t>(index, abbrev_contributions[i].second);
+        }
+
+        return make_coff_object({
+            {".debug_info.dwo", package.debug_info},
+            {".debug_abbrev.dwo", package.debug_abbrev},
+            {".debug_cu_index", index}
+        });
+    }
+
+    ///
+    /// @brief Creates the .debug_info section of a build with -fdebug-types-section
+    /// @details One type unit per signature, each describing a structure named "type<i>" with
+    ///     byte size i. The type units are followed by a compilation unit with one variable
+    ///     per signature, referencing the structure with DW_FORM_ref_sig8.
+    ///
+    inline auto
+    make_type_units(std::vector<uint64_t> const & signatures) -> DebugSectionsData
+    {
+        DebugSectionsData sections;
+        // 1: DW_TAG_type_unit with children
+        // 2: DW_TAG_structure_type, DW_AT_name as DW_FORM_string, DW_AT_byte_size as DW_FORM_data1
+        // 3: DW_TAG_compile_unit with children, DW_AT_name as DW_FORM_string
+        // 4: DW_TAG_variable, DW_AT_name as DW_FORM_string, DW_AT_type as DW_FORM_ref_sig8
+        sections.debug_abbrev = {
+            1, 0x41, 1, 0, 0,
+            2, 0x13, 0, 0x03, 0x08, 0x0b, 0x0b, 0, 0,
+            3, 0x11, 1, 0x03, 0x08, 0, 0,
+            4, 0x34, 0, 0x03, 0x08, 0x49, 0x20, 0, 0,
+            0};
+
+        auto & info = sections.debug_info;
+        for(size_t i = 0; i < signatures.size(); ++i) {
+            size_t const offset = info.size();
+            append<uint32_t>(info, 0);          // unit_length
+            append<uint16_t>(info, 5);          // version
+            append<uint8_t>(info, 0x02);        // DW_UT_type
+            append<uint8_t>(info, 8);           // address_size
+            append<uint32_t>(info, 0);          // debug_abbrev_offset
+            append<uint64_t>(info, signatures[i]);
+            append<uint32_t>(info, 0);          // type_offset
+
+            append<uint8_t>(info, 1);
+            size_t const type_offset = info.size() - offset;
+            append<uint8_t>(info, 2);
+            append_string(info, "type" + std::to_string(i));
+            append<uint8_t>(info, i);
+            append<uint8_t>(info, 0);
+            finish_unit(info, offset);
+
+            for(size_t j = 0; j < sizeof(uint32_t); ++j) {
+                info[offset + 20 + j] = static_cast<char>(type_offset >> (j * 8));
+            }
+        }
+
+        size_t const offset = info.size();
+        append<uint32_t>(info, 0);              // unit_length
+        append<uint16_t>(info, 5);              // version
+        append<uint8_t>(info, 0x01);            // DW_UT_compile
+        append<uint8_t>(info, 8);               // address_size
+        append<uint32_t>(info, 0);              // debug_abbrev_offset
+
+        append<uint8_t>(info, 3);
+        append_string(info, "main.cpp");
+        for(size_t i = 0; i < signatures.size(); ++i) {
+            append<uint8_t>(info, 4);
+            append_string(info, "variable" + std::to_string(i));
+            append<uint64_t>(info, signatures[i]);
+        }
+        append<uint8_t>(info, 0);
+        finish_unit(info, offset);
+
+        return sections;
+    }
+
+    /// @brief The name, the type and the offset of a data member, the type is "char", "int", "float",
+    ///     "Foo*", a pointer to the structure itself, or an array of them, e.g. "int[2][3]"
+    using StructMember = std::tuple<std::string, std::string, uint8_t>;
+
+    ///
+    /// @brief Creates one compilation unit per list of members, each defining a structure named "Foo"
+    /// @details The byte size of a structure ends after its last member. The array types of the members
+    ///     are followed by the additional array types, e.g. "Foo[4]".
+    ///
+    inline auto
+    make_struct_units(std::vector<std::vector<StructMember>> const & units, std::vector<std::string> const & array_types = {}) 
+        -> DebugSectionsData
+    {
+        DebugSectionsData sections;
+        // 1: DW_TAG_compile_unit with children, DW_AT_name as DW_FORM_string
+        // 2: DW_TAG_structure_type with children, DW_AT_name as DW_FORM_string, DW_AT_byte_size as DW_FORM_data4
+        // 3: DW_TAG_member, DW_AT_name as DW_FORM_string, DW_AT_type as DW_FORM_ref4,
+        //    DW_AT_data_member_location as DW_FORM_data1
+        // 4: DW_TAG_base_type, DW_AT_name as DW_FORM_string, DW_AT_byte_size and DW_AT_encoding as DW_FORM_data1
+        // 5: DW_TAG_pointer_type, DW_AT_byte_size as DW_FORM_data1, DW_AT_type as DW_FORM_ref4
+        // 6: DW_TAG_array_type with children, DW_AT_type as DW_FORM_ref4
+        // 7: DW_TAG_subrange_type, DW_AT_count as DW_FORM_data4
+        sections.debug_abbrev = {
+            1, 0x11, 1, 0x03, 0x08, 0, 0,
+            2, 0x13, 1, 0x03, 0x08, 0x0b, 0x06, 0, 0,
+            3, 0x0d, 0, 0x03, 0x08, 0x49, 0x13, 0x38, 0x0b, 0, 0,
+            4, 0x24, 0, 0x03, 0x08, 0x0b, 0x0b, 0x3e, 0x0b, 0, 0,
+            5, 0x0f, 0, 0x0b, 0x0b, 0x49, 0x13, 0, 0,
+            6, 0x01, 1, 0x49, 0x13, 0, 0,
+            7, 0x21, 0, 0x37, 0x06, 0, 0,
+            0};
+
+        // the element type and the number of elements of each dimension of a type
+        auto const parse = [](std::string const & type_name) {
+            std::vector<uint32_t> extents = {};
+            for(size_t i = type_name.find('['); i != std::string::npos; i = type_name.find('[', i + 1)) {
+                extents.push_back(static_cast<uint32_t>(std::stoul(type_name.substr(i + 1))));
+            }
+            return std::make_pair(type_name.substr(0, type_name.find('[')), extents);
+        };
+
+        auto & info = sections.debug_info;
+        for(size_t i = 0; i < units.size(); ++i) {
+            size_t const offset = info.size();
+            append<uint32_t>(info, 0);          // unit_length
+            append<uint16_t>(info, 5);          // version
+            append<uint8_t>(info, 0x01);        // DW_UT_compile
+            append<uint8_t>(info, 8);           // address_size
+            append<uint32_t>(info, 0);          // debug_abbrev_offset
+
+            append<uint8_t>(info, 1);
+            append_string(info, "unit" + std::to_string(i) + ".c");
+
+            uint64_t byte_size = 0;
+            for(auto const & [name, type_name, member_offset] : units[i]) {
+                auto const [element_name, extents] = parse(type_name);
+                uint64_t size = element_name == "Foo*" ? 8 : element_name == "char" ? 1 : 4;
+                for(uint32_t const extent : extents) {
+                    size *= extent;
+                }
+                byte_size = std::max<uint64_t>(byte_size, member_offset + size);
+            }
+
+            std::vector<std::pair<std::string, size_t>> types = {};
+            types.emplace_back("Foo", info.size() - offset);
+            append<uint8_t>(info, 2);
+            append_string(info, "Foo");
+            append<uint32_t>(info, static_cast<uint32_t>(byte_size));
+
+            std::vector<std::pair<size_t, std::string>> references = {};
+            for(auto const & [name, type_name, member_offset] : units[i]) {
+                append<uint8_t>(info, 3);
+                append_string(info, name);
+                references.emplace_back(info.size(), type_name);
+                append<uint32_t>(info, 0);
+                append<uint8_t>(info, member_offset);
+            }
+            append<uint8_t>(info, 0);
+
+            for(auto const & [name, encoding, size] : {std::tuple("char", 0x06, 1), std::tuple("int", 0x05, 4), std::tuple("float", 0x04, 4)}) {
+                types.emplace_back(name, info.size() - offset);
+                append<uint8_t>(info, 4);
+                append_string(info, name);
+                append<uint8_t>(info, size);
+                append<uint8_t>(info, encoding);    // DW_ATE_signed_char, DW_ATE_signed or DW_ATE_float
+            }
+
+            types.emplace_back("Foo*", info.size() - offset);
+            append<uint8_t>(info, 5);
+            append<uint8_t>(info, 8);
+            append<uint32_t>(info, types.front().second);
+
+            auto const find_type = [&](std::string const & type_name) {
+                return std::ranges::find(types, type_name, &std::pair<std::string, size_t>::first)->second;
+            };
+
+            std::vector<std::string> arrays = {};
+            for(auto const & [name, type_name, member_offset] : units[i]) {
+                if(type_name.find('[') != std::string::npos) {
+                    arrays.push_back(type_name);
+                }
+            }
+            arrays.insert(arrays.end(), array_types.begin(), array_types.end());
+
+            for(auto const & type_name : arrays) {
+                auto const [element_name, extents] = parse(type_name);
+                types.emplace_back(type_name, info.size() - offset);
+                append<uint8_t>(info, 6);
+                append<uint32_t>(info, static_cast<uint32_t>(find_type(element_name)));
+                for(uint32_t const extent : extents) {
+                    append<uint8_t>(info, 7);
+                    append<uint32_t>(info, extent);
+                }
+                append<uint8_t>(info, 0);
+            }
+
+            append<uint8_t>(info, 0);
+            finish_unit(info, offset);
+
+            for(auto const & [position, type_name] : references) {
+                size_t const type = find_type(type_name);
+                for(size_t j = 0; j < sizeof(uint32_t); ++j) {
+                    info[position + j] = static_cast<char>(type >> (j * 8));
+                }
+            }
+        }
+
+        return sections;
+    }
+
+    /// @class fixture::CompileUnit
+    ///
+    /// @brief A compilation unit with functions named "<name>_<i>" of 16 bytes each
+    ///
+    struct CompileUnit final
+    {
+        std::string name;
+        uint64_t low_pc = 0;
+        size_t functions = 0;
+        /// @brief Stands in for the content of the line number program
+        uint64_t line_seed = 0;
+        /// @brief The names are stored in .debug_str and the addresses of the functions in .debug_addr
+        bool is_indirect = false;
+    };
+
+    ///
+    /// @brief Appends a DWARF 5 compilation unit and its line number program
+    /// @details All units share one abbreviation table at offset 0. The line number program is
+    ///     only a header with the line seed, it is not decoded.
+    ///
+    inline auto
+    append_compile_unit(DebugSectionsData & sections, CompileUnit const & unit) -> void
+    {
+        if(sections.debug_abbrev.empty()) {
+            // 1: DW_TAG_compile_unit with children, DW_AT_name as DW_FORM_string, DW_AT_low_pc as
+            //    DW_FORM_addr, DW_AT_high_pc as DW_FORM_data8, DW_AT_stmt_list as DW_FORM_sec_offset
+            // 2: DW_TAG_subprogram, DW_AT_name as DW_FORM_string, DW_AT_low_pc as DW_FORM_addr,
+            //    DW_AT_high_pc as DW_FORM_data4
+            // 3: 1 with DW_AT_name as DW_FORM_strp and DW_AT_addr_base as DW_FORM_sec_offset
+            // 4: 2 with DW_AT_name as DW_FORM_strp and DW_AT_low_pc as DW_FORM_addrx
+            sections.debug_abbrev = {
+                1, 0x11, 1, 0x03, 0x08, 0x11, 0x01, 0x12, 0x07, 0x10, 0x17, 0, 0,
+                2, 0x2e, 0, 0x03, 0x08, 0x11, 0x01, 0x12, 0x06, 0, 0,
+                3, 0x11, 1, 0x03, 0x0e, 0x11, 0x01, 0x12, 0x07, 0x10, 0x17, 0x73, 0x17, 0, 0,
+                4, 0x2e, 0, 0x03, 0x0e, 0x11, 0x1b, 0x12, 0x06, 0, 0,
+                0};
+        }
+
+        auto & line = sections.debug_line;
+        size_t const line_offset = line.size();
+        append<uint32_t>(line, 0);              // unit_length
+        append<uint16_t>(line, 5);              // version
+        append<uint64_t>(line, unit.line_seed);
+        finish_unit(line, line_offset);
+
+        auto & info = sections.debug_info;
+        size_t const offset = info.size();
+        append<uint32_t>(info, 0);              // unit_length
+        append<uint16_t>(info, 5);              // version
+        append<uint8_t>(info, 0x01);            // DW_UT_compile
+        append<uint8_t>(info, 8);               // address_size
+        append<uint32_t>(info, 0);              // debug_abbrev_offset
+
+        auto const append_name = [&](std::string_view const name) {
+            if(unit.is_indirect) {
+                append<uint32_t>(info, sections.debug_str.size());
+                append_string(sections.debug_str, name);
+            }
+            else {
+                append_string(info, name);
+            }
+        };
+
+        // a DWARF 5 address table of the functions
+        size_t const addr_offset = sections.debug_addr.size();
+        if(unit.is_indirect) {
+            append<uint32_t>(sections.debug_addr, 4 + unit.functions * 8);  // unit_length
+            append<uint16_t>(sections.debug_addr, 5);                       // version
+            append<uint8_t>(sections.debug_addr, 8);                        // address_size
+            append<uint8_t>(sections.debug_addr, 0);                        // segment_selector_size
+            for(size_t i = 0; i < unit.functions; ++i) {
+                append<uint64_t>(sections.debug_addr, unit.low_pc + i * 16);
+            }
+        }
+
+        append<uint8_t>(info, unit.is_indirect ? 3 : 1);
+        append_name(unit.name);
+        append<uint64_t>(info, unit.low_pc);
+        append<uint64_t>(info, unit.functions * 16);
+        append<uint32_t>(info, line_offset);
+        if(unit.is_indirect) {
+            append<uint32_t>(info, addr_offset + 8);    // DW_AT_addr_base
+        }
+        for(size_t i = 0; i < unit.functions; ++i) {
+            append<uint8_t>(info, unit.is_indirect ? 4 : 2);
+            append_name(unit.name + "_" + std::to_string(i));
+            if(unit.is_indirect) {
+                append<uint8_t>(info, i);               // ULEB128 index into .debug_addr
+            }
+            else {
+                append<uint64_t>(info, unit.low_pc + i * 16);
+            }
+            append<uint32_t>(info, 16);
+        }
+        append<uint8_t>(info, 0);
+        finish_unit(info, offset);
+    }
+
+    ///
+    /// @brief Creates the sections of a binary with one compilation unit per entry
+    ///
+    inline auto
+    make_compile_units(std::vector<CompileUnit> const & units) -> DebugSectionsData
+    {
+        DebugSectionsData sections;
+        for(auto const & unit : units) {
+            append_compile_unit(sections, unit);
+        }
+        return sections;
+    }
+
+    ///
+    /// @brief Creates a DWARF 4 and a DWARF 5 compilation unit whose address ranges are range lists
+    /// @details The DWARF 4 unit "ranges4.c" with base address 0x10000 covers [0x10000, 0x10100) and
+    ///     [0x20000, 0x20080) in .debug_ranges, its function "split4" [0x10010, 0x10020) and [0x10040, 0x10050).
+    ///     The DWARF 5 unit "ranges5.c" with base address 0x30000 covers [0x30000, 0x30100) and
+    ///     [0x40000, 0x40080) in .debug_rnglists, referenced by DW_FORM_rnglistx, its function "split5"
+    ///     [0x30020, 0x30030) and [0x40010, 0x40020).
+    ///
+    inline auto
+    make_range_list_units() -> DebugSectionsData
+    {
+        DebugSectionsData sections;
+        // 1: DW_TAG_compile_unit with children, DW_AT_name as DW_FORM_string, DW_AT_low_pc as DW_FORM_addr,
+        //    DW_AT_ranges as DW_FORM_sec_offset
+        // 2: DW_TAG_subprogram, DW_AT_name as DW_FORM_string, DW_AT_ranges as DW_FORM_sec_offset
+        // 3: 1 with DW_AT_ranges as DW_FORM_rnglistx and DW_AT_rnglists_base as DW_FORM_sec_offset
+        sections.debug_abbrev = {
+            1, 0x11, 1, 0x03, 0x08, 0x11, 0x01, 0x55, 0x17, 0, 0,
+            2, 0x2e, 0, 0x03, 0x08, 0x55, 0x17, 0, 0,
+            3, 0x11, 1, 0x03, 0x08, 0x11, 0x01, 0x55, 0x23, 0x74, 0x17, 0, 0,
+            0};
+
+        // .debug_ranges, pairs of offsets from the base address, a new base address and the end of the list
+        auto & ranges = sections.debug_ranges;
+        for(uint64_t const value : {0x0, 0x100, -1, 0x20000, 0x0, 0x80, 0x0, 0x0, 0x10, 0x20, 0x40, 0x50, 0x0, 0x0}) {
+            append<uint64_t>(ranges, value);
+        }
+
+        auto & info = sections.debug_info;
+        size_t offset = info.size();
+        append<uint32_t>(info, 0);              // unit_length
+        append<uint16_t>(info, 4);              // version
+        append<uint32_t>(info, 0);              // debug_abbrev_offset
+        append<uint8_t>(info, 8);               // address_size
+
+        append<uint8_t>(info, 1);
+        append_string(info, "ranges4.c");
+        append<uint64_t>(info, 0x10000);
+        append<uint32_t>(info, 0);
+        append<uint8_t>(info, 2);
+        append_string(info, "split4");
+        append<uint32_t>(info, 64);
+        append<uint8_t>(info, 0);
+        finish_unit(info, offset);
+
+        // .debug_rnglists with an offsets table of one list
+        auto & rnglists = sections.debug_rnglists;
+        append<uint32_t>(rnglists, 0);          // unit_length
+        append<uint16_t>(rnglists, 5);          // version
+        append<uint8_t>(rnglists, 8);           // address_size
+        append<uint8_t>(rnglists, 0);           // segment_selector_size
+        append<uint32_t>(rnglists, 1);          // offset_entry_count
+        size_t const rnglists_base = rnglists.size();
+        append<uint32_t>(rnglists, 4);          // the list of the unit, relative to the offsets table
+
+        append<uint8_t>(rnglists, 0x04);        // DW_RLE_offset_pair
+        append<uint8_t>(rnglists, 0x00);
+        append<uint8_t>(rnglists, 0x80);        // 0x100 as ULEB128
+        append<uint8_t>(rnglists, 0x02);
+        append<uint8_t>(rnglists, 0x05);        // DW_RLE_base_address
+        append<uint64_t>(rnglists, 0x40000);
+        append<uint8_t>(rnglists, 0x04);        // DW_RLE_offset_pair
+        append<uint8_t>(rnglists, 0x00);
+        append<uint8_t>(rnglists, 0x80);        // 0x80 as ULEB128
+        append<uint8_t>(rnglists, 0x01);
+        append<uint8_t>(rnglists, 0x00);        // DW_RLE_end_of_list
+
+        size_t const function_list = rnglists.size();
+        append<uint8_t>(rnglists, 0x07);        // DW_RLE_start_length
+        append<uint64_t>(rnglists, 0x30020);
+        append<uint8_t>(rnglists, 0x10);
+        append<uint8_t>(rnglists, 0x06);        // DW_RLE_start_end
+        append<uint64_t>(rnglists, 0x40010);
+        append<uint64_t>(rnglists, 0x40020);
+        append<uint8_t>(rnglists, 0x00);        // DW_RLE_end_of_list
+        finish_unit(rnglists, 0);
+
+        offset = info.size();
+        append<uint32_t>(info, 0);              // unit_length
+        append<uint16_t>(info, 5);              // version
+        append<uint8_t>(info, 0x01);            // DW_UT_compile
+        append<uint8_t>(info, 8);               // address_size
+        append<uint32_t>(info, 0);              // debug_abbrev_offset
+
+        append<uint8_t>(info, 3);
+        append_string(info, "ranges5.c");
+        append<uint64_t>(info, 0x30000);
+        append<uint8_t>(info, 0);               // DW_FORM_rnglistx index as ULEB128
+        append<uint32_t>(info, rnglists_base);
+        append<uint8_t>(info, 2);
+        append_string(info, "split5");
+        append<uint32_t>(info, function_list);
+        append<uint8_t>(info, 0);
+        finish_unit(info, offset);
+
+        return sections;
+    }
+
+    ///
+    /// @brief Creates the sections of a build with -g3 of the units "/src/a.c" and "/src/m.c"
+    /// @details Both units import the table of the predefined macros and the table of "/src/a.h",
+    ///     as GCC does for tables that are equal in several units:
+    ///
+    ///         a.c                     a.h                     b.h                 m.c
+    ///         1 #include "a.h"        1 #define A_H_VALUE 1  1 #define B_H 2    1 #include "a.h"
+    ///         2 #define LOCAL 3      2 #define SHARED(x) ...                     2 #define MAIN_ONLY 5
+    ///         3 #undef LOCAL
+    ///         4 #define LOCAL 4
+    ///         5 #include "b.h"
+    ///
+    /// @param generated the number of additional predefined macros "GENERATED_<i> <i>"
+    ///
+    inline auto
+    make_macro_units(size_t const generated = 0) -> DebugSectionsData
+    {
+        DebugSectionsData sections;
+        // 1: DW_TAG_compile_unit without children, DW_AT_name as DW_FORM_string, DW_AT_stmt_list and
+        //    DW_AT_macros as DW_FORM_sec_offset
+        sections.debug_abbrev = {1, 0x11, 0, 0x03, 0x08, 0x10, 0x17, 0x79, 0x17, 0, 0, 0};
+
+        auto const add_string = [&](std::string_view const str) {
+            auto const offset = static_cast<uint32_t>(sections.debug_str.size());
+            append_string(sections.debug_str, str);
+            return offset;
+        };
+
+        auto & macro = sections.debug_macro;
+        auto const begin_table = [&](std::optional<uint32_t> const line_offset) {
+            auto const offset = static_cast<uint32_t>(macro.size());
+            append<uint16_t>(macro, 5);                     // version
+            append<uint8_t>(macro, line_offset.has_value() ? 0x02 : 0x00); // flags, debug_line_offset_flag
+            if(line_offset.has_value()) {
+                append<uint32_t>(macro, *line_offset);
+            }
+            return offset;
+        };
+        auto const define = [&](uint8_t const line, std::string_view const text) {
+            append<uint8_t>(macro, 0x01);                   // DW_MACRO_define
+            append<uint8_t>(macro, line);
+            append_string(macro, text);
+        };
+        auto const define_strp = [&](uint8_t const opcode, uint8_t const line, std::string_view const text) {
+            append<uint8_t>(macro, opcode);                 // DW_MACRO_define_strp, DW_MACRO_undef_strp
+            append<uint8_t>(macro, line);
+            append<uint32_t>(macro, add_string(text));
+        };
+        auto const start_file = [&](uint8_t const line, uint8_t const file) {
+            append<uint8_t>(macro, 0x03);                   // DW_MACRO_start_file
+            append<uint8_t>(macro, line);
+            append<uint8_t>(macro, file);
+        };
+        auto const end_file = [&]() {
+            append<uint8_t>(macro, 0x04);                   // DW_MACRO_end_file
+        };
+        auto const import = [&](uint32_t const offset) {
+            append<uint8_t>(macro, 0x07);                   // DW_MACRO_import
+            append<uint32_t>(macro, offset);
+        };
+
+        auto const predefined = begin_table(std::nullopt);
+        define_strp(0x05, 0, "__STDC__ 1");
+        define(0, "__GNUC__ 12");
+        for(size_t i = 0; i < generated; ++i) {
+            define_strp(0x05, 0, "GENERATED_" + std::to_string(i) + " " + std::to_string(i));
+        }
+        append<uint8_t>(macro, 0);
+
+        auto const a_h = begin_table(std::nullopt);
+        define_strp(0x05, 1, "A_H_VALUE 1");
+        define(2, "SHARED(x) ((x) * 2)");
+        append<uint8_t>(macro, 0);
+
+        auto const append_unit = [&](std::string_view const name, std::vector<std::string_view> const & files, auto && macros) {
+            // a DWARF 5 line number program with the rows (0x1000, 2), (0x1004, 5), (0x1006, 4) and
+            // the end of the sequence at 0x1008
+            auto & line = sections.debug_line;
+            auto const line_offset = static_cast<uint32_t>(line.size());
+            append<uint32_t>(line, 0);                      // unit_length
+            append<uint16_t>(line, 5);                      // version
+            append<uint8_t>(line, 8);                       // address_size
+            append<uint8_t>(line, 0);                       // segment_selector_size
+            auto const header_length_offset = line.size();
+            append<uint32_t>(line, 0);                      // header_length
+            for(uint8_t const value : {1, 1, 1, 0xfb, 14, 13}) {
+                append<uint8_t>(line, value);               // minimum_instruction_length ... opcode_base
+            }
+            for(uint8_t const length : {0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1}) {
+                append<uint8_t>(line, length);              // standard_opcode_lengths
+            }
+            for(uint8_t const value : {1, 0x01, 0x08, 1}) {
+                append<uint8_t>(line, value);               // DW_LNCT_path as DW_FORM_string, one directory
+            }
+            append_string(line, "/src");
+            for(uint8_t const value : {2, 0x01, 0x08, 0x02, 0x0f}) {
+                append<uint8_t>(line, value);               // DW_LNCT_path, DW_LNCT_directory_index as DW_FORM_udata
+            }
+            append<uint8_t>(line, files.size());
+            for(auto const file : files) {
+                append_string(line, file);
+                append<uint8_t>(line, 0);
+            }
+            finish_unit(line, header_length_offset);
+            append<uint8_t>(line, 0);                       // DW_LNE_set_address
+            append<uint8_t>(line, 9);
+            append<uint8_t>(line, 0x02);
+            append<uint64_t>(line, 0x1000);
+            for(uint8_t const value : {0x05, 2, 0x13, 0x03, 3, 0x02, 4, 0x01, 0x06, 0x2d, 0x02, 2}) {
+                append<uint8_t>(line, value);               // set_column, special, advance_line, advance_pc, copy, ...
+            }
+            for(uint8_t const value : {0, 1, 0x01}) {
+                append<uint8_t>(line, value);               // DW_LNE_end_sequence
+            }
+            finish_unit(line, line_offset);
+
+            auto const macro_offset = begin_table(line_offset);
+            macros();
+            append<uint8_t>(macro, 0);
+
+            auto & info = sections.debug_info;
+            size_t const offset = info.size();
+            append<uint32_t>(info, 0);                      // unit_length
+            append<uint16_t>(info, 5);                      // version
+            append<uint8_t>(info, 0x01);                    // DW_UT_compile
+            append<uint8_t>(info, 8);                       // address_size
+            append<uint32_t>(info, 0);                      // debug_abbrev_offset
+            append<uint8_t>(info, 1);
+            append_string(info, name);
+            append<uint32_t>(info, line_offset);
+            append<uint32_t>(info, macro_offset);
+            finish_unit(info, offset);
+        };
+
+        append_unit("a.c", {"a.c", "a.c", "a.h", "b.h"}, [&]() {
+            import(predefined);
+            start_file(0, 1);
+            start_file(1, 2);
+            import(a_h);
+            end_file();
+            define_strp(0x05, 2, "LOCAL 3");
+            define_strp(0x06, 3, "LOCAL");
+            define(4, "LOCAL 4");
+            start_file(5, 3);
+            define(1, "B_H 2");
+            end_file();
+            end_file();
+        });
+
+        append_unit("m.c", {"m.c", "m.c", "a.h"}, [&]() {
+            import(predefined);
+            start_file(0, 1);
+            start_file(1, 2);
+            import(a_h);
+            end_file();
+            define(2, "MAIN_ONLY 5");
+            end_file();
+        });
+
+        return sections;
+    }
+
+#if defined(DWARF_READER_HAS_ZLIB)
+    ///
+    /// @brief Compresses the data of a section into a GNU .zdebug_ section
+    ///
+    inline auto
+    compress_zdebug(std::span<char const> const data) -> Bytes
+    {
+        uLongf size = compressBound(data.size());
+        Bytes res = {'Z', 'L', 'I', 'B'};
+        for(size_t i = 0; i < sizeof(uint64_t); ++i) {
+            res.push_back(static_cast<char>(static_cast<uint64_t>(data.size()) >> ((7 - i) * 8)));
+        }
+
+        size_t const header_size = res.size();
+        res.resize(header_size + size);
+        compress2(reinterpret_cast<Bytef *>(res.data() + header_size), &size,
+            reinterpret_cast<Bytef const *>(data.data()), data.size(), Z_DEFAULT_COMPRESSION);
+        res.resize(header_size + size);
+
+        return res;
+    }
+
+    ///
+    /// @brief Creates a COFF object with the debug sections of a binary file
+    /// @param compressed stores the sections as .zdebug_ sections, like objcopy --compress-debug-sections=zlib-gnu
+    ///
+    inline auto
+    make_debug_object(dwarf::DebugSections const & sections, bool const compressed) -> Bytes
+    {
+        std::vector<std::pair<std::string, Bytes>> object_sections;
+        for(auto const & [suffix, member] : dwarf::debug_section_names) {
+            auto const data = sections.*member;
+            if(data.empty()) {
+                continue;
+            }
+
+            if(compressed) {
+                object_sections.emplace_back(".zdebug_" + std::string(suffix), compress_zdebug(data));
+            }
+            else {
+                object_sections.emplace_back(".debug_" + std::string(suffix), Bytes(data.begin(), data.end()));
+            }
+        }
+
+        return make_coff_object(object_sections);
+    }
+#endif
+}
@@ -9,6 +9,7 @@
 #include "FileToHeader_exe.h"
 #include "ut/ut.hpp"
 
+#include <array>
 #include <iostream>
 
 constexpr auto
@@ -22,6 +23,7 @@ tests() noexcept -> bool
             constexpr pei::OptionalHeader optional_header(data);
             ut::Then() = [&]() noexcept {
                 ut::check(optional_header.magic() == 0x20b);
+                ut::check(optional_header.image_base() == 0x140000000);
             };
         };
 
@@ -33,6 +35,60 @@ tests() noexcept -> bool
                 ut::check(number_of_sections > 0);
                 constexpr auto name = section_header.name();
                 ut::assert_eq(name, ".text");
+                // IMAGE_SCN_CNT_CODE
+                ut::check((section_header.characteristics() & 0x20) != 0);
+            };
+
+            // the data directories of a PE32+ image
+            ut::Then() = [&]() noexcept {
+                constexpr pei::OptionalHeader optional_header(data);
+                ut::check(optional_header.is_pe32_plus());
+                ut::check(optional_header.number_of_rva_and_sizes() == 16);
+                ut::check(optional_header.data_directory(pei::DirectoryEntry::export_table).size == 0);
+
+                auto const imports = optional_header.data_directory(pei::DirectoryEntry::import_table);
+                ut::check(imports.virtual_address != 0 && imports.size != 0);
+
+                std::span<char const> const image(FileToHeader_exe);
+                pei::SectionRanges const ranges(image);
+                ut::check(ranges.file_offset(section_header.virtual_address() + 4) == section_header.pointer_to_raw_data() + 4);
+                ut::check(!ranges.file_offset(0).has_value());
+
+                pei::ImportDirectory const import_directory(image);
+                ut::check(import_directory.size() == 4);
+                ut::assert_eq(import_directory.dll_name(0), "libgcc_s_seh-1.dll");
+
+                // without a CodeView record the headers identify the build
+                pei::DebugDirectory const debug_directory(image);
+                ut::check(debug_directory.size() == 0);
+                auto const key = debug_directory.key();
+                ut::check(key.source == pei::ImageKeySource::header);
+                ut::check(key.high == (uint64_t{pei::FileHeader(image).time_date_stamp()} << 32 | optional_header.size_of_image()));
+                ut::check(optional_header.size_of_image() % 0x1000 == 0);
+            };
+
+            // MinGW images keep the COFF symbol table
+            ut::Then() = [&]() noexcept {
+                constexpr pei::SymbolTable symbol_table(data);
+                ut::check(symbol_table.number_of_symbols() > 0);
+
+                constexpr pei::Symbol first = symbol_table.get_symbol(0);
+                ut::check(first.storage_class() == pei::StorageClass::file);
+                ut::assert_eq(first.file_name(), "crtexe.c");
+                ut::check(first.next_index() == 2);
+
+                bool is_main_found = false;
+                bool is_long_name_found = false;
+                for(auto it = symbol_table.begin(); it != symbol_table.end() && !is_main_found; ++it) {
+                    pei::Symbol const symbol = *it;
+                    if(symbol.name() == "main") {
+                        is_main_found = symbol.is_function() && symbol.storage_class() == pei::StorageClass::external
+                            && symbol.section_number() == 1 && symbol.value() == 0x834;
+                    }
+                    is_long_name_found |= symbol.name() == "WinMainCRTStartup";
+                }
+                ut::check(is_main_found);
+                ut::check(is_long_name_found);
             };
 
             // std::cout << number_of_sections << std::endl;
@@ -44,6 +100,72 @@ tests() noexcept -> bool
         };
     };
 
+    // a file cut off in the MS-DOS stub, behind the COFF file header and in the section table
+    ut::Scenario("truncated_image") = []() noexcept
+    {
+        ut::Given() = []() noexcept{
+            std::span<char const> const data(FileToHeader_exe);
+            std::array<size_t, 3> const sizes = {100, 300, 600};
+
+            ut::Then() = [&]() noexcept {
+                ut::check(!pei::FileHeader(data.first(100)).is_complete());
+                ut::check(pei::FileHeader(data.first(100)).number_of_symbols() == 0);
+                ut::check(pei::FileHeader(data.first(300)).is_complete());
+
+                for(size_t const size : sizes) {
+                    pei::SymbolTable const symbol_table(data.first(size));
+                    ut::check(symbol_table.number_of_symbols() == 0);
+                    ut::check(symbol_table.begin() == symbol_table.end());
+
+                    pei::SymbolIndex const symbols(data.first(size));
+                    ut::check(symbols.size() == 0);
+                    ut::check(symbols.find(0x140001000) == nullptr);
+                }
+            };
+
+            // only the section headers inside the data are read
+            ut::Then() = [&]() noexcept {
+                pei::OptionalHeader const optional_header(data);
+                size_t const section_table_address = optional_header.base_index() + optional_header.size();
+                ut::check(section_table_address < 600);
+                ut::check(!pei::OptionalHeader(data.first(300)).is_complete());
+                ut::check(pei::OptionalHeader(data.first(300)).image_base() == 0);
+                ut::check(pei::OptionalHeader(data.first(300)).data_directory(pei::DirectoryEntry::import_table).size == 0);
+
+                pei::SectionTable const section_table(data.first(600));
+                ut::check(section_table.number_of_sections() == (600 - section_table_address) / 40);
+                ut::check(section_table.number_of_sections() < pei::SectionTable(data).number_of_sections());
+                ut::assert_eq(section_table.get_section(0).name(), ".text");
+                ut::check(pei::SectionTable(data.first(300)).number_of_sections() == 0);
+
+                for(size_t const size : sizes) {
+                    pei::SectionRanges const ranges(data.first(size));
+                    ut::check(ranges.ranges().size() == pei::SectionTable(data.first(size)).number_of_sections());
+                    ut::check(ranges.data(0x1000).size() <= size);
+                    ut::check(!pei::ExportDirectory(data.first(size)).is_valid());
+
+                    pei::ImportDirectory const imports(data.first(size));
+                    ut::check(imports.size() == 0);
+                }
+            };
+
+            // a build identity probe accepts any file
+            ut::Then() = [&]() noexcept {
+                for(size_t const size : sizes) {
+                    pei::DebugDirectory const debug_directory(data.first(size));
+                    ut::check(debug_directory.size() == 0);
+                    ut::check(!debug_directory.codeview().has_value());
+                }
+                ut::check(pei::DebugDirectory(data.first(0)).key().source == pei::ImageKeySource::none);
+                ut::check(pei::DebugDirectory(data.first(100)).key().source == pei::ImageKeySource::none);
+                ut::check(pei::DebugDirectory(data.first(300)).key().source == pei::ImageKeySource::none);
+
+                // the headers of the build identity are complete in front of the section table
+                ut::check(pei::DebugDirectory(data.first(600)).key() == pei::DebugDirectory(data).key());
+            };
+        };
+    };
+
     return true;
 }
 
@@ -0,0 +1,72 @@
+///
+/// @file:   symbolizerd.cpp
+/// @author: GrandChris
+/// @date:   2026-10-19
+/// @brief:  Serves symbolizer requests on a Unix domain socket until SIGINT or SIGTERM
+/// @details Usage: symbolizerd <socket path> [maximum number of resident binaries]
+///
+
+#include "dwarf/symbolizer/symbolizer_server.hpp"
+
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#if !defined(_WIN32)
+
+namespace
+{
+    dwarf::SymbolizerServer * server = nullptr;
+
+    auto
+    handle_signal(int) -> void
+    {
+        if(server != nullptr) {
+            server->stop();
+        }
+    }
+}
+
+auto
+main(int argc, char * argv[]) -> int
+{
+    if(argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <socket path> [capacity]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    size_t const capacity = argc > 2 ? std::stoul(argv[2]) : 16;
+
+    try {
+        dwarf::SymbolizerServer symbolizer_server(argv[1], capacity);
+        server = &symbolizer_server;
+        std::signal(SIGINT, handle_signal);
+        std::signal(SIGTERM, handle_signal);
+
+        symbolizer_server.run();
+        server = nullptr;
+
+        auto const & statistics = symbolizer_server.symbolizer().statistics();
+        std::cout << "hits: " << statistics.hits << ", misses: " << statistics.misses << ", reloads: "
+            << statistics.reloads << ", evictions: " << statistics.evictions << ", failures: "
+            << statistics.failures << std::endl;
+    }
+    catch(std::exception const & e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+#else
+
+auto
+main() -> int
+{
+    std::cerr << "Unix domain sockets are not supported on this platform" << std::endl;
+    return EXIT_FAILURE;
+}
+
+#endif